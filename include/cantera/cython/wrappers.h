@@ -82,6 +82,7 @@ THERMO_1D(getEntropy_R)
 THERMO_1D(getIntEnergy_RT)
 THERMO_1D(getGibbs_RT)
 THERMO_1D(getCp_R)
+THERMO_1D(getStandardVolumes)
 
 KIN_1D(getFwdRatesOfProgress)
 KIN_1D(getRevRatesOfProgress)
@@ -101,11 +102,13 @@ KIN_1D(getDeltaSSEntropy)
 KIN_1D(getCreationRates)
 KIN_1D(getDestructionRates)
 KIN_1D(getNetProductionRates)
+KIN_1D(getNetProductionRates_ddT)
 
 TRANSPORT_1D(getMixDiffCoeffs)
 TRANSPORT_1D(getMixDiffCoeffsMass)
 TRANSPORT_1D(getMixDiffCoeffsMole)
 TRANSPORT_1D(getThermalDiffCoeffs)
+TRANSPORT_1D(getSpeciesViscosities)
 
 TRANSPORT_2D(getMultiDiffCoeffs)
 TRANSPORT_2D(getBinaryDiffCoeffs)
@@ -13,6 +13,8 @@
 #include "FalloffMgr.h"
 #include "Reaction.h"
 
+#include <functional>
+
 namespace Cantera
 {
 
@@ -47,12 +49,47 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(doublereal* kfwd);
 
+    //! @}
+    //! @name Derivatives of Production Rates
+    //! @{
+
+    //! Derivatives of the species net production rates with respect to the
+    //! species concentrations, at constant temperature.
+    /*!
+     * The derivatives of the mass-action concentration products and of the
+     * third-body concentrations of three-body and falloff reactions are
+     * exact. For falloff reactions, only the Lindemann form is differentiated
+     * with respect to the third-body concentration, and the dependence of the
+     * falloff function (for example, Troe) on the reduced pressure is
+     * neglected. The dependence of P-log and Chebyshev rate constants on
+     * pressure is also neglected. These approximations only affect the
+     * convergence rate of Newton iterations that use the Jacobian, not the
+     * accuracy of the solution.
+     */
+    virtual void getNetProductionRates_ddC(double* dwdot);
+
+    //! Derivatives of the species net production rates with respect to
+    //! temperature, at constant species concentrations.
+    /*!
+     * Evaluated as a forward difference of the full net production rates,
+     * with the temperature perturbed at constant density so that the
+     * concentrations are unchanged. The result therefore includes the
+     * temperature dependence of the rate constants, the equilibrium
+     * constants and the falloff functions.
+     */
+    virtual void getNetProductionRates_ddT(double* dwdot);
+
+    virtual void getNetProductionRates_ddCPattern(
+        std::vector<std::vector<size_t>>& rows);
+    virtual void getNetProductionRates_ddC(SparseMatrix& dwdot);
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
     virtual void init();
     virtual bool addReaction(shared_ptr<Reaction> r);
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
+    virtual void invalidateCache();
     virtual void finalize();
     virtual bool ready() const;
     //@}
@@ -120,6 +157,45 @@ protected:
     //! Update the equilibrium constants in molar units.
     void updateKc();
 
+    //! Set up #m_jacReactants, #m_jacProducts and #m_jacStoich, used by
+    //! getNetProductionRates_ddC().
+    void prepareDerivatives();
+
+    //! Add *drop*, the derivative of the net rate of progress of reaction *i*
+    //! with respect to the concentration of species *j*, to the derivatives
+    //! of the net production rates in *dwdot*.
+    void addRopDerivative(size_t i, size_t j, double drop, double* dwdot) {
+        for (const auto& sp : m_jacStoich[i]) {
+            dwdot[j * m_kk + sp.first] += sp.second * drop;
+        }
+    }
+
+    //! Evaluate the derivatives of the net rates of progress with respect to
+    //! the species concentrations due to the concentration products in the
+    //! rate expressions. For each nonzero derivative, calls `add(i, j, drop)`
+    //! where *drop* is the derivative of the net rate of progress of reaction
+    //! *i* with respect to the concentration of species *j*.
+    void getConcProductDerivatives(
+        const std::function<void(size_t, size_t, double)>& add);
+
+    //! Species indices and reaction orders of the forward concentration
+    //! products of each reaction
+    std::vector<std::vector<std::pair<size_t, double>>> m_jacReactants;
+
+    //! Species indices and reaction orders of the reverse concentration
+    //! products of each reversible reaction
+    std::vector<std::vector<std::pair<size_t, double>>> m_jacProducts;
+
+    //! Species indices and net stoichiometric coefficients of each reaction
+    std::vector<std::vector<std::pair<size_t, double>>> m_jacStoich;
+
+    //! Effective forward rate constants, used by getNetProductionRates_ddC()
+    vector_fp m_kfwd_work;
+
+    //! Work array of length m_kk used to compute the derivatives of the net
+    //! production rates
+    vector_fp m_wdot_work;
+
     bool m_finalized;
 };
 }
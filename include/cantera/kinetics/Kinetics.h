@@ -19,6 +19,8 @@
 namespace Cantera
 {
 
+class SparseMatrix;
+
 /**
  * @defgroup chemkinetics Chemical Kinetics
  */
@@ -569,6 +571,56 @@ public:
      */
     virtual void getNetProductionRates(doublereal* wdot);
 
+    //! Derivatives of the species net production rates with respect to the
+    //! species concentrations, at constant temperature.
+    /*!
+     * @param dwdot  Output matrix, stored in column-major order, where element
+     *     (*k*, *j*) is the derivative of the net production rate of species
+     *     *k* with respect to the concentration of species *j*. Size: m_kk by
+     *     m_kk. [1/s]
+     */
+    virtual void getNetProductionRates_ddC(double* dwdot) {
+        throw NotImplementedError("Kinetics::getNetProductionRates_ddC");
+    }
+
+    //! Derivatives of the species net production rates with respect to
+    //! temperature, at constant species concentrations.
+    /*!
+     * @param dwdot  Output vector of derivatives. Length: m_kk. [kmol/m^3/s/K]
+     */
+    virtual void getNetProductionRates_ddT(double* dwdot) {
+        throw NotImplementedError("Kinetics::getNetProductionRates_ddT");
+    }
+
+    //! Sparsity pattern of the derivatives of the net production rates with
+    //! respect to the species concentrations which are due to the
+    //! concentration products in the rate expressions.
+    /*!
+     * @param rows  Output: for each species *k*, the species *j* such that the
+     *     net production rate of *k* depends on the concentration of *j*
+     *     through the rate expression of a reaction. Length: m_kk.
+     */
+    virtual void getNetProductionRates_ddCPattern(
+        std::vector<std::vector<size_t>>& rows) {
+        throw NotImplementedError("Kinetics::getNetProductionRates_ddCPattern");
+    }
+
+    //! Approximate derivatives of the net production rates with respect to
+    //! the species concentrations, including only the terms due to the
+    //! concentration products in the rate expressions.
+    /*!
+     * The dependence on the concentrations of collision partners, which
+     * couples every species to every other species, is omitted. This keeps
+     * the matrix sparse, making it suitable for constructing preconditioners
+     * for large mechanisms.
+     *
+     * @param dwdot  Output matrix. Its sparsity pattern must include the
+     *     pattern given by getNetProductionRates_ddCPattern(). [1/s]
+     */
+    virtual void getNetProductionRates_ddC(SparseMatrix& dwdot) {
+        throw NotImplementedError("Kinetics::getNetProductionRates_ddC");
+    }
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
@@ -752,6 +804,11 @@ public:
      */
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
 
+    //! Discard any cached values which depend on the thermodynamic properties
+    //! of the species, e.g. after the standard state enthalpy of a species
+    //! has been changed with ThermoPhase::modifyOneHf298SS().
+    virtual void invalidateCache() {}
+
     /**
      * Return the Reaction object for reaction *i*.
      */
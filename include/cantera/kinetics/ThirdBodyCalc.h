@@ -49,6 +49,30 @@ public:
         return m_reaction_index.size();
     }
 
+    //! Index of the *i*-th third-body reaction within the full reaction array
+    size_t reactionIndex(size_t i) const {
+        return m_reaction_index[i];
+    }
+
+    //! The default third-body efficiency of the *i*-th third-body reaction,
+    //! which is the derivative of its third-body concentration with respect to
+    //! the concentration of any species without an enhanced efficiency.
+    double defaultEfficiency(size_t i) const {
+        return m_default[i];
+    }
+
+    //! Indices of the species with enhanced efficiencies in the *i*-th
+    //! third-body reaction
+    const std::vector<size_t>& enhancedSpecies(size_t i) const {
+        return m_species[i];
+    }
+
+    //! Differences between the enhanced and default efficiencies of the
+    //! species given by enhancedSpecies() in the *i*-th third-body reaction
+    const vector_fp& enhancedEfficiencies(size_t i) const {
+        return m_eff[i];
+    }
+
 protected:
     //! Indices of third-body reactions within the full reaction array
     std::vector<size_t> m_reaction_index;
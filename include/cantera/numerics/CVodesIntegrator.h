@@ -51,6 +51,13 @@ public:
     virtual void reinitialize(double t0, FuncEval& func);
     virtual void integrate(double tout);
     virtual doublereal step(double tout);
+    virtual double currentTime() const {
+        return m_time;
+    }
+    virtual bool rootFound() const {
+        return m_rootFound;
+    }
+    virtual void getRootInfo(int* roots);
     virtual double& solution(size_t k);
     virtual double* solution();
     virtual int nEquations() const {
@@ -75,6 +82,44 @@ public:
     }
     virtual double sensitivity(size_t k, size_t p);
 
+    //! Save the state of the integrator.
+    /*!
+     * The state consists of the current time, the step size to be attempted
+     * next, the solution vector and the sensitivities.
+     */
+    virtual std::string saveState();
+
+    //! Restore the state of the integrator saved by saveState().
+    /*!
+     * CVODES does not provide an interface for setting its history array, so
+     * the integration is restarted at first order, using the saved step size
+     * as the initial step size. The solution therefore agrees with an
+     * uninterrupted integration to within the integration tolerances, while
+     * avoiding the small initial steps of a new integration.
+     */
+    virtual void restoreState(const std::string& state);
+
+    //! Prepare for adjoint sensitivity analysis, using the checkpointing
+    //! scheme of CVODES with Hermite interpolation of the solution between
+    //! the checkpoints.
+    virtual void initAdjoint(int steps);
+
+    //! Solve the adjoint equations with CVODES.
+    /*!
+     * The adjoint equations use the Jacobian given by
+     * FuncEval::evalJacobian() with the dense linear solver, independent of
+     * the problem type used for the forward integration, and the
+     * derivatives with respect to the parameters given by
+     * FuncEval::evalParameterAdjoint(). The adjoint variables and the
+     * gradient are integrated with the sensitivity tolerances, where the
+     * absolute tolerance is scaled by the magnitude of the final values of
+     * the adjoint variables.
+     */
+    virtual double solveAdjoint(double tend, const double* lambda,
+                                AdjointIntegrand* g, double* grad);
+
+    virtual void getInterpolatedSolution(double t, double* y);
+
     //! Returns a string listing the weighted error estimates associated
     //! with each solution component.
     //! This information can be used to identify which variables are
@@ -92,6 +137,21 @@ protected:
 private:
     void sensInit(double t0, FuncEval& func);
 
+    //! Update #m_yS to the sensitivities at the current time, if necessary
+    void updateSensitivities();
+
+    //! Set up the root functions of *func* with CVODES
+    void initRoots(FuncEval& func);
+
+    //! Re-enable the root functions and the forward sensitivities after an
+    //! adjoint solution, when the integrator is reinitialized
+    void resetAdjoint();
+
+    //! Rethrow any exception from the evaluation of the root functions, and
+    //! record whether CVodes stopped at a root, given the return value
+    //! *flag* of CVode. A return at a root is changed to CV_SUCCESS.
+    void checkRootError(int& flag);
+
     size_t m_neq;
     void* m_cvode_mem;
     double m_t0;
@@ -117,6 +177,27 @@ private:
     //! Indicates whether the sensitivities stored in m_yS have been updated
     //! for at the current integrator time.
     bool m_sens_ok;
+
+    //! Number of root functions
+    size_t m_nroots;
+
+    //! True if the last call to integrate() or step() stopped at a root
+    bool m_rootFound;
+
+    //! True if the forward integration saves checkpoints for the adjoint
+    //! equations. See initAdjoint().
+    bool m_adjoint;
+
+    //! True if the adjoint memory of CVODES has been allocated
+    bool m_adjointInit;
+
+    //! Identifier of the backward problem in CVODES, or -1 if it hasn't been
+    //! created
+    int m_whichB;
+
+    //! Adjoint variables and quadratures (the gradient, followed by the
+    //! integral of the integrand) of the backward problem
+    N_Vector m_yB, m_qB;
 };
 
 } // namespace
@@ -13,6 +13,10 @@
 
 namespace Cantera
 {
+
+class SparseMatrix;
+class Array2D;
+
 /**
  *  Virtual base class for ODE right-hand-side function evaluators.
  *  Classes derived from FuncEval evaluate the right-hand-side function
@@ -60,6 +64,88 @@ public:
     virtual size_t nparams() {
         return 0;
     }
+
+    //! Evaluate the Jacobian matrix \f$ \partial F_i / \partial y_j \f$,
+    //! used by integrators with a dense linear solver and a user-supplied
+    //! Jacobian.
+    /*!
+     * @param[in] t     time.
+     * @param[in] y     solution vector, length neq()
+     * @param[out] ydot rate of change of solution vector, length neq()
+     * @param[in] p     sensitivity parameter vector, length nparams()
+     * @param[out] j    Jacobian matrix, size neq() by neq().
+     */
+    virtual void evalJacobian(double t, double* y, double* ydot, double* p,
+                              Array2D* j) {
+        throw NotImplementedError("FuncEval::evalJacobian");
+    }
+
+    //! Sparsity pattern of the Jacobian matrix \f$ \partial F_i / \partial y_j
+    //! \f$, used by integrators with a sparse linear solver.
+    /*!
+     * @param[out] rows  For each equation *i*, the indices *j* of the state
+     *     variables which may affect its right-hand side. Length neq().
+     */
+    virtual void getJacobianPattern(std::vector<std::vector<size_t>>& rows) {
+        throw NotImplementedError("FuncEval::getJacobianPattern");
+    }
+
+    //! Evaluate the Jacobian matrix for the sparsity pattern given by
+    //! getJacobianPattern().
+    /*!
+     * @param[in] t     time.
+     * @param[in] y     solution vector, length neq()
+     * @param[in] ydot  right-hand side evaluated at (t, y), length neq()
+     * @param[in] p     sensitivity parameter vector, length nparams()
+     * @param[out] jac  Jacobian matrix. Its sparsity pattern has been set
+     *     from getJacobianPattern().
+     *
+     * When the matrix is only used as a preconditioner for an iterative
+     * linear solver, both the pattern and the values may be approximate.
+     */
+    virtual void evalSparseJacobian(double t, double* y, double* ydot,
+                                    double* p, SparseMatrix& jac) {
+        throw NotImplementedError("FuncEval::evalSparseJacobian");
+    }
+
+    //! Evaluate the product of the transposed derivatives of the
+    //! right-hand-side function with respect to the sensitivity parameters
+    //! with a vector, as needed for adjoint sensitivity analysis.
+    /*!
+     * @param[in] t      time.
+     * @param[in] y      solution vector, length neq()
+     * @param[in] p      sensitivity parameter vector, length nparams()
+     * @param[in] lambda adjoint variables, length neq()
+     * @param[out] out   \f$ \sum_i \lambda_i \partial F_i / \partial p_j \f$
+     *     for each parameter *j*, length nparams()
+     */
+    virtual void evalParameterAdjoint(double t, double* y, double* p,
+                                      const double* lambda, double* out) {
+        throw NotImplementedError("FuncEval::evalParameterAdjoint");
+    }
+
+    //! Number of root functions, whose zeros are located by the integrator.
+    //! The integration stops at each zero that is found.
+    virtual size_t nRootFunctions() {
+        return 0;
+    }
+
+    //! Evaluate the root functions.
+    /*!
+     * @param[in] t  time.
+     * @param[in] y  solution vector, length neq()
+     * @param[out] g values of the root functions, length nRootFunctions()
+     */
+    virtual void evalRootFunctions(double t, double* y, double* g) {
+        throw NotImplementedError("FuncEval::evalRootFunctions");
+    }
+
+    //! Get the directions of the zero crossings of each root function which
+    //! are located: 1 if the root function is increasing, -1 if it is
+    //! decreasing, or 0 for both. Length nRootFunctions().
+    virtual void getRootDirections(int* directions) {
+        std::fill(directions, directions + nRootFunctions(), 0);
+    }
 };
 
 }
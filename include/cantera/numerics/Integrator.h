@@ -13,6 +13,7 @@
 #include "FuncEval.h"
 
 #include "cantera/base/global.h"
+#include "cantera/base/ctexceptions.h"
 
 namespace Cantera
 {
@@ -21,8 +22,14 @@ const int DIAG = 1;
 const int DENSE = 2;
 const int NOJAC = 4;
 const int JAC = 8;
+//! GMRES iterations. Combined with JAC, the iterations are preconditioned
+//! with a sparse LU factorization of the (approximate) Jacobian given by
+//! FuncEval::evalSparseJacobian()
 const int GMRES = 16;
 const int BAND = 32;
+//! Newton iterations using a sparse LU factorization of the Jacobian given by
+//! FuncEval::evalSparseJacobian()
+const int SPARSE = 64;
 
 /**
  * Specifies the method used to integrate the system of equations.
@@ -44,6 +51,25 @@ enum IterType {
     Functional_Iter
 };
 
+//! The integrand *g* of a functional
+//! \f[
+//!     G = \phi(\vec{y}(T)) + \int_{t_0}^T g(t, \vec{y}) dt
+//! \f]
+//! of the solution of an ODE system, used for adjoint sensitivity analysis.
+//! See Integrator::solveAdjoint().
+class AdjointIntegrand
+{
+public:
+    virtual ~AdjointIntegrand() {}
+
+    //! Evaluate the integrand at time *t* for the solution vector *y*
+    virtual double eval(double t, const double* y) = 0;
+
+    //! Get the derivatives *dgdy* of the integrand with respect to the
+    //! components of the solution vector *y*
+    virtual void getGradient(double t, const double* y, double* dgdy) = 0;
+};
+
 //!  Abstract base class for ODE system integrators.
 /*!
  *  @ingroup odeGroup
@@ -128,6 +154,25 @@ public:
         return 0.0;
     }
 
+    //! The time reached by the last call to integrate() or step()
+    virtual double currentTime() const {
+        warn("currentTime");
+        return 0.0;
+    }
+
+    //! Returns `true` if the last call to integrate() or step() stopped at a
+    //! zero of one of the root functions (see FuncEval::nRootFunctions()).
+    virtual bool rootFound() const {
+        return false;
+    }
+
+    //! For each root function, get 0 if no zero was found by the last call
+    //! to integrate() or step(), or the direction of the zero crossing (1 or
+    //! -1) otherwise. Length FuncEval::nRootFunctions().
+    virtual void getRootInfo(int* roots) {
+        warn("getRootInfo");
+    }
+
     //! The current value of the solution of equation k.
     virtual doublereal& solution(size_t k) {
         warn("solution");
@@ -200,6 +245,64 @@ public:
         return 0.0;
     }
 
+    //! Save the state of the integrator, including the solution, the
+    //! sensitivities and the current step size, as a binary string which
+    //! can be passed to restoreState().
+    virtual std::string saveState() {
+        throw NotImplementedError("Integrator::saveState");
+    }
+
+    //! Restore the state of the integrator saved by saveState(). The
+    //! integrator must have been initialized for a system with the same
+    //! number of equations and sensitivity parameters.
+    virtual void restoreState(const std::string& state) {
+        throw NotImplementedError("Integrator::restoreState");
+    }
+
+    //! Prepare for adjoint sensitivity analysis. Call after initialize() or
+    //! reinitialize() and before integrating the system.
+    /*!
+     * The solution is saved every *steps* time steps during the following
+     * calls to integrate() and step(), so that the adjoint equations can be
+     * solved backwards in time with solveAdjoint(). The root functions and
+     * the forward sensitivities are disabled until the integrator is
+     * reinitialized.
+     */
+    virtual void initAdjoint(int steps) {
+        throw NotImplementedError("Integrator::initAdjoint");
+    }
+
+    //! Integrate the adjoint equations from time *tend* back to the initial
+    //! time, to find the gradient of a functional of the solution with
+    //! respect to the sensitivity parameters.
+    /*!
+     * The functional is
+     * \f[
+     *     G = \phi(\vec{y}(T)) + \int_{t_0}^T g(t, \vec{y}) dt
+     * \f]
+     * where *T* = *tend*, which must be in the range covered by the calls to
+     * integrate() and step() since initAdjoint() was called.
+     *
+     * @param tend    end time of the functional
+     * @param lambda  derivatives of \f$ \phi \f$ with respect to the
+     *     components of \f$ \vec{y}(T) \f$, length nEquations()
+     * @param g       integrand *g*, or NULL if the functional has no
+     *     integral part. The integrand may not depend on the parameters.
+     * @param[out] grad  derivatives of *G* with respect to the sensitivity
+     *     parameters, length nSensParams()
+     * @returns the integral of *g*
+     */
+    virtual double solveAdjoint(double tend, const double* lambda,
+                                AdjointIntegrand* g, double* grad) {
+        throw NotImplementedError("Integrator::solveAdjoint");
+    }
+
+    //! Get the solution *y* at a time *t* within the last time step taken by
+    //! the integrator, by interpolation.
+    virtual void getInterpolatedSolution(double t, double* y) {
+        throw NotImplementedError("Integrator::getInterpolatedSolution");
+    }
+
 private:
     doublereal m_dummy;
     void warn(const std::string& msg) const {
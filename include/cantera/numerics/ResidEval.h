@@ -69,7 +69,7 @@ public:
     }
 
     virtual bool isAlgebraic(const int k) {
-        return (m_alg[k] == 1);
+        return (k < (int) m_alg.size() && m_alg[k] == 1);
     }
 
     /**
@@ -0,0 +1,170 @@
+/**
+ *  @file SparseMatrix.h
+ *  Sparse matrices with a fixed sparsity pattern, and their LU factorization
+ *  (see \ref numerics and class \link Cantera::SparseMatrix
+ *  SparseMatrix\endlink).
+ */
+
+#ifndef CT_SPARSEMATRIX_H
+#define CT_SPARSEMATRIX_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! A square sparse matrix with a fixed sparsity pattern, stored in
+//! compressed sparse row format, which can be factored in place.
+/*!
+ * The sparsity pattern is set once by setPattern(). The diagonal is always
+ * part of the pattern. The first call to factor() chooses an elimination
+ * order for the unknowns using a minimum degree ordering, which limits the
+ * fill-in caused by dense rows and columns, and determines the pattern of
+ * the LU factors by symbolic elimination. Later factorizations reuse this
+ * pattern and only repeat the numerical elimination.
+ *
+ * The rows and columns are permuted symmetrically and no pivoting is done,
+ * so the diagonal elements are used as the pivots. This is suitable for the
+ * Newton iteration matrices \f$ I - \gamma J \f$ used by implicit
+ * integrators, which are dominated by the identity matrix for small
+ * step sizes.
+ *
+ * @ingroup numerics
+ */
+class SparseMatrix
+{
+public:
+    SparseMatrix();
+
+    //! Set the sparsity pattern. All values are set to zero.
+    /*!
+     * @param rows  The column indices of the nonzero entries in each row.
+     *     The number of rows (and columns) is `rows.size()`. The column
+     *     indices in each row need not be sorted, and the diagonal element is
+     *     added if it is missing.
+     */
+    void setPattern(const std::vector<std::vector<size_t>>& rows);
+
+    //! Number of rows and columns
+    size_t nRows() const {
+        return m_n;
+    }
+
+    //! Number of entries in the sparsity pattern
+    size_t nNonzeros() const {
+        return m_cols.size();
+    }
+
+    //! Number of entries in the LU factors, including fill-in. Zero if the
+    //! matrix has not been factored yet.
+    size_t nFactorNonzeros() const {
+        return m_luCols.size();
+    }
+
+    //! Position of element (*i*, *j*) in the array returned by data(), or
+    //! #npos if this element is not part of the sparsity pattern.
+    size_t index(size_t i, size_t j) const;
+
+    //! Reference to element (*i*, *j*). Throws an exception if this element
+    //! is not part of the sparsity pattern.
+    double& value(size_t i, size_t j);
+
+    //! Value of element (*i*, *j*), or zero if this element is not part of
+    //! the sparsity pattern.
+    double value(size_t i, size_t j) const;
+
+    //! Values of the entries in the sparsity pattern, by row
+    double* data() {
+        return m_values.data();
+    }
+
+    //! Position in data() of the first entry of each row, with one additional
+    //! entry giving the total number of entries
+    const std::vector<size_t>& rowStart() const {
+        return m_rowStart;
+    }
+
+    //! Column index of each entry in data()
+    const std::vector<size_t>& columns() const {
+        return m_cols;
+    }
+
+    //! Set all values to zero
+    void zero();
+
+    //! Set this matrix to \f$ I - \gamma A \f$
+    /*!
+     * @param gamma  Scale factor
+     * @param A      Matrix with the same sparsity pattern as this matrix
+     */
+    void setIdentityMinus(double gamma, const SparseMatrix& A);
+
+    //! Factor the matrix into lower and upper triangular factors.
+    /*!
+     * The values of the matrix are not modified, so it can be refactored
+     * after changing some of its values.
+     *
+     * @returns 0 on success, or *i*+1 if the pivot in row *i* is zero or not
+     *     finite. The factorization may not be used after a failure.
+     */
+    int factor();
+
+    //! Solve the linear system \f$ A x = b \f$ using the LU factors.
+    /*!
+     * @param[in,out] b  On input, the right-hand side. On output, the
+     *     solution. Length nRows().
+     */
+    void solve(double* b) const;
+
+protected:
+    //! Determine the elimination order of the unknowns (#m_perm)
+    void orderUnknowns();
+
+    //! Determine the pattern of the LU factors, including fill-in
+    void analyze();
+
+    //! Number of rows and columns
+    size_t m_n;
+
+    //! Start of each row in #m_cols and #m_values
+    std::vector<size_t> m_rowStart;
+
+    //! Column indices of the entries, sorted within each row
+    std::vector<size_t> m_cols;
+
+    //! Values of the entries
+    vector_fp m_values;
+
+    //! Elimination order: m_perm[i] is the unknown eliminated in step *i*
+    std::vector<size_t> m_perm;
+
+    //! Inverse of #m_perm
+    std::vector<size_t> m_iperm;
+
+    //! Start of each row in #m_luCols and #m_lu. The rows and columns of the
+    //! factors are in the elimination order.
+    std::vector<size_t> m_luStart;
+
+    //! Column indices of the entries of the LU factors, sorted within each
+    //! row
+    std::vector<size_t> m_luCols;
+
+    //! Position of the diagonal element of each row in #m_lu
+    std::vector<size_t> m_luDiag;
+
+    //! Position in #m_lu of each entry of #m_values
+    std::vector<size_t> m_luMap;
+
+    //! LU factors. The unit diagonal of L is not stored.
+    vector_fp m_lu;
+
+    //! Work array used to assemble a single row of the factors
+    vector_fp m_work;
+
+    //! True if #m_lu holds a valid factorization
+    bool m_factored;
+};
+
+}
+
+#endif
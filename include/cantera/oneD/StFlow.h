@@ -7,16 +7,19 @@
 
 
 #include "cantera/transport/TransportBase.h"
+#include "cantera/transport/Tortuosity.h"
 #include "Domain1D.h"
 #include "cantera/base/Array.h"
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/numerics/funcs.h"
+#include "cantera/numerics/SquareMatrix.h"
 #include <fstream>
 
 namespace Cantera
 {
 class MultiJac;
+class DustyGasTransport;
 //------------------------------------------
 //   constants
 //------------------------------------------
@@ -496,6 +499,10 @@ protected:
 
 private:
     vector_fp m_ybar;
+
+    //! Work arrays holding the temperature, pressure and mass fractions at
+    //! the midpoints, for evaluating the transport properties
+    vector_fp m_tmid, m_pmid, m_ymid;
 };
 
 /**
@@ -538,7 +545,7 @@ public:
         m_zmid(0.035),m_dzmid(0.002),
         m_adapt(0.1), m_porea(0.1), m_poreb(0.1), 
 	m_porec(0.1), m_pored(0.1), m_diama(0.1), m_diamb(0.1), 
-	m_diamc(0.1), m_diamd(0.1)
+	m_diamc(0.1), m_diamd(0.1), m_dgtran(0)
         {
 	   Tw.resize(points);
 	   dq.resize(points);
@@ -555,6 +562,35 @@ public:
 	
     virtual void restore(const XML_Node& dom, doublereal* soln,
                          int loglevel);
+
+    //! Compute the species diffusive fluxes with the dusty-gas model
+    /*!
+     * When enabled, the fluxes computed from the gas transport manager are
+     * replaced by those of the dusty-gas model, which accounts for Knudsen
+     * diffusion in fine pores. At each grid point, the porosity and
+     * tortuosity of *dgt* are set from the local porosity and the tortuosity
+     * model, and the mean pore radius and particle diameter are set from
+     * the local pore diameter. The H matrix of the dusty-gas model is
+     * factored at each point when the transport properties are updated,
+     * and the fluxes are then found by back-substitution, so that Jacobian
+     * evaluations use the same frozen coefficients as the other transport
+     * properties. The pressure is uniform, so the Darcy term vanishes, and a
+     * correction flux is added so that the mass fluxes sum to zero. Thermal
+     * diffusion is not included.
+     *
+     * @param dgt   Dusty-gas transport manager for a phase with the same
+     *     species as this domain. Its phase is used as a scratch object. Pass
+     *     a null pointer to return to the gas transport manager.
+     * @param tort  Tortuosity model giving the tortuosity as a function of
+     *     the local porosity. This object takes ownership of *tort*. If null,
+     *     the Bruggeman relation with an exponent of 1.5 is used.
+     */
+    void setDustyGasTransport(DustyGasTransport* dgt, Tortuosity* tort=0);
+
+    //! Returns `true` if the dusty-gas model is used for the species fluxes
+    bool dustyGasEnabled() const {
+        return m_dgtran != 0;
+    }
 						 
     //! initialize the solid properties
     double pore1;
@@ -592,6 +628,29 @@ public:
         return "Porous Stagnation";
     }
 private:
+    //! Update the porosity and pore diameter at all grid points
+    void updatePoreProperties();
+
+    //! Factor the dusty-gas H matrix at the midpoints between grid points
+    //! `j0` and `j1`, based on solution `x`
+    void updateDustyGasTransport(const doublereal* x, size_t j0, size_t j1);
+
+    //! Replace the diffusive mass fluxes between grid points `j0` and `j1`
+    //! with those of the dusty-gas model
+    void updateDustyGasFluxes(const doublereal* x, size_t j0, size_t j1);
+
+    //! Dusty-gas transport manager, or null if it is not used
+    DustyGasTransport* m_dgtran;
+
+    //! Tortuosity model used with the dusty-gas model
+    std::unique_ptr<Tortuosity> m_tortuosity;
+
+    //! Factored H matrices of the dusty-gas model at the midpoints
+    std::vector<SquareMatrix> m_dgH;
+
+    //! Work array of length m_nsp
+    vector_fp m_dgwork;
+
     // porous burner
     vector_fp Tw;
     vector_fp pore;
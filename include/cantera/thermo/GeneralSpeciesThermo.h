@@ -11,6 +11,7 @@
 
 #include "SpeciesThermo.h"
 #include "SpeciesThermoInterpType.h"
+#include <set>
 
 namespace Cantera
 {
@@ -22,6 +23,12 @@ namespace Cantera
  * because it recomputes the functions of temperature needed for each species.
  * What it does is to create a vector of SpeciesThermoInterpType objects.
  *
+ * The SpeciesThermoInterpType objects are treated as immutable, and are
+ * shared between copies of the manager and with the Species objects they were
+ * installed from, so copying a phase does not copy the species thermo
+ * parameters. The first call to modifyOneHf298() for a species replaces the
+ * shared object with a private copy, which is then modified in place.
+ *
  * @ingroup mgrsrefcalc
  */
 class GeneralSpeciesThermo : public SpeciesThermo
@@ -87,6 +94,10 @@ private:
     SpeciesThermoInterpType* provideSTIT(size_t k);
     const SpeciesThermoInterpType* provideSTIT(size_t k) const;
 
+    //! Share the species parameterizations of another object. Objects that
+    //! are specific to a phase (STITbyPDSS) are duplicated.
+    void copySTITs(const GeneralSpeciesThermo& b);
+
 protected:
     typedef std::pair<size_t, shared_ptr<SpeciesThermoInterpType> > index_STIT;
     typedef std::map<int, std::vector<index_STIT> > STIT_map;
@@ -112,6 +123,10 @@ protected:
     //! reference pressure (Pa)
     doublereal m_p0;
 
+    //! Indices of the species whose parameterization is owned by this object
+    //! alone, and can be modified in place. See modifyOneHf298().
+    std::set<size_t> m_privateSTITs;
+
     //! Make the class VPSSMgr a friend because we need to access the function
     //! provideSTIT()
     friend class VPSSMgr;
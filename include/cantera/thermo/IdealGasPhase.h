@@ -603,6 +603,14 @@ public:
         return m_cp0_R;
     }
 
+    //! Returns a reference to the vector of standard state chemical
+    //! potentials of the species (J kmol-1)
+    /*!
+     * The values depend only on the temperature and pressure, and are cached
+     * so that they are only recomputed when one of these changes.
+     */
+    const vector_fp& standardChemPotentials() const;
+
     //@}
 
     virtual void initThermo();
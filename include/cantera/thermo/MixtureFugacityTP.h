@@ -467,6 +467,27 @@ public:
     virtual doublereal densityCalc(doublereal TKelvin, doublereal pressure, int phaseRequested,
                                    doublereal rhoguess);
 
+    //! Calculate the densities at a set of temperatures and pressures at the
+    //! current composition.
+    /*!
+     * The base class implementation calls densityCalc() for each state, and
+     * then restores the temperature and density of the object. Derived
+     * classes with a closed-form equation of state should override this with
+     * an implementation that doesn't touch the state at all.
+     *
+     * @param nStates   Number of (T, P) states
+     * @param TKelvin   Temperatures in Kelvin. Length nStates.
+     * @param pressure  Pressures in Pascals. Length nStates.
+     * @param[out] rho  Densities (kg/m^3). Length nStates. For each state,
+     *     the return conventions of densityCalc() apply, i.e. a value of -1
+     *     or -2 indicates that no acceptable density was found.
+     * @param phaseRequested  Phase whose density is requested. A value of
+     *     FLUID_UNDEFINED means that the stable root is accepted.
+     */
+    virtual void getDensities_TP(size_t nStates, const doublereal* TKelvin,
+                                 const doublereal* pressure, doublereal* rho,
+                                 int phaseRequested=FLUID_UNDEFINED);
+
 protected:
     //! Utility routine in the calculation of the saturation pressure
     /*!
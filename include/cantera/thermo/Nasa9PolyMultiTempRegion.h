@@ -103,9 +103,6 @@ protected:
 
     //! Individual temperature region objects
     std::vector<std::unique_ptr<Nasa9Poly1>> m_regionPts;
-
-    //! current region
-    mutable int m_currRegion;
 };
 
 }
@@ -21,6 +21,33 @@ namespace Cantera
 class PDSS_Water;
 class WaterProps;
 
+//! Functions of the state of the solvent which appear in the HKFT standard
+//! state of every species
+/*!
+ * These depend only on the temperature and pressure, and not on the species.
+ * They are computed by PDSS_HKFT::getSolventFunctions(), which allows
+ * VPSSMgr_Water_HKFT to evaluate the water properties and the Born functions
+ * once for all of the HKFT species in a phase.
+ */
+struct HKFTSolventFunctions {
+    //! Value of gstar, its first and second derivatives with respect to
+    //! temperature, and its derivative with respect to pressure (Angstroms)
+    doublereal gstar[4];
+
+    //! Z = -1 / relEpsilon
+    doublereal Z;
+
+    //! Y = dZ/dT = 1/(eps*eps) deps/dT
+    doublereal Y;
+
+    //! X = d2Z/dT2 (as used in the heat capacity)
+    doublereal X;
+
+    //! Q = dZ/dP = 1/(eps*eps) deps/dP
+    doublereal Q;
+};
+
+
 //! Class for pressure dependent standard states corresponding to
 //!  ionic solutes in electrolyte water.
 /*!
@@ -203,6 +230,20 @@ public:
                               doublereal& refPressure) const;
     //@}
 
+    //! Evaluate the functions of the solvent state that are shared by all
+    //! species using the HKFT standard state.
+    /*!
+     * The water standard state is evaluated only once, rather than once for
+     * each derivative of gstar. As a side effect, the state of the water
+     * standard state object is set to the given temperature and pressure.
+     *
+     * @param temp      Temperature (K)
+     * @param pres      Pressure (Pa)
+     * @param[out] sf   Values of gstar and the Born functions
+     */
+    void getSolventFunctions(doublereal temp, doublereal pres,
+                             HKFTSolventFunctions& sf) const;
+
 private:
     //! Main routine that actually calculates the Gibbs free energy difference
     //! between the reference state at Tr, Pr and T,P
@@ -191,6 +191,10 @@ public:
     virtual doublereal satPressure(doublereal t);
 
     //! Get a pointer to a changeable WaterPropsIAPWS object
+    /*!
+     * This can be used to enable the tabulated density and saturation
+     * calculations, see WaterPropsIAPWS::useTables().
+     */
     WaterPropsIAPWS* getWater() {
         return &m_sub;
     }
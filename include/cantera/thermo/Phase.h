@@ -729,6 +729,11 @@ protected:
      */
     mutable ValueCache m_cache;
 
+    //! Natural logarithms of the mole fractions, where each mole fraction is
+    //! limited to be at least SmallNumber. The values are cached, and are only
+    //! recomputed when the composition changes.
+    const vector_fp& logMoleFractions() const;
+
     //! Set the molecular weight of a single species to a given value
     //!     @param k       id of the species
     //!     @param mw      Molecular Weight (kg kmol-1)
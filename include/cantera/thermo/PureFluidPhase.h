@@ -86,6 +86,13 @@ public:
     //! Returns a reference to the substance object
     tpx::Substance& TPX_Substance();
 
+    //! Enable or disable the use of tabulated properties by the substance
+    //! object. See tpx::Substance::useTables().
+    void useTables(bool flag=true);
+
+    //! True if the substance object is using tabulated properties
+    bool usingTables() const;
+
     //@}
     /// @name Properties of the Standard State of the Species in the Solution
     /*!
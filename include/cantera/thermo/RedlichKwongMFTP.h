@@ -84,6 +84,9 @@ public:
      */
     virtual doublereal pressure() const;
 
+    virtual doublereal isothermalCompressibility() const;
+    virtual doublereal thermalExpansionCoeff() const;
+
     // @}
 
 protected:
@@ -227,6 +230,21 @@ public:
     virtual doublereal liquidVolEst(doublereal TKelvin, doublereal& pres) const;
     virtual doublereal densityCalc(doublereal TKelvin, doublereal pressure, int phase, doublereal rhoguess);
 
+    //! Calculate the densities at a set of temperatures and pressures at the
+    //! current composition.
+    /*!
+     * The composition-dependent mixing parameters are evaluated once, and
+     * each state then only requires the evaluation of a(T) and a closed-form
+     * solution of the cubic. The state of the object is not changed.
+     *
+     * The roots are selected, and failures reported, in the same way as in
+     * densityCalc(), with the density guess used by
+     * MixtureFugacityTP::getDensities_TP().
+     */
+    virtual void getDensities_TP(size_t nStates, const doublereal* TKelvin,
+                                 const doublereal* pressure, doublereal* rho,
+                                 int phaseRequested=FLUID_UNDEFINED);
+
     virtual doublereal densSpinodalLiquid() const;
     virtual doublereal densSpinodalGas() const;
     virtual doublereal pressureCalc(doublereal TKelvin, doublereal molarVol) const;
@@ -244,7 +262,9 @@ public:
     /*!
      *  The a and the b parameters depend on the mole fraction and the
      *  temperature. This function updates the internal numbers based on the
-     *  state of the object.
+     *  state of the object. The pair coefficients a_ij are only re-evaluated
+     *  when the temperature has changed, and the mixture sums are taken from
+     *  mixingParameters().
      */
     void updateAB();
 
@@ -259,6 +279,21 @@ public:
      */
     void calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const;
 
+    //! Composition-dependent mixing parameters and critical properties
+    /*!
+     * With \f$ a_{ij}(T) = a^0_{ij} + a^1_{ij} T \f$, the mixture parameter
+     * is \f$ a = \sum_{ij} X_i X_j a^0_{ij} + T \sum_{ij} X_i X_j a^1_{ij} \f$.
+     * The two O(K^2) sums and \f$ b = \sum_i X_i b_i \f$ only depend on the
+     * mole fractions, as do the pseudo-critical properties of the mixture.
+     * They are recomputed only when stateMFNumber() changes, so that changes
+     * in temperature or pressure alone cost O(1) here.
+     *
+     * @returns a vector containing, in order, the T-independent part of
+     *     a_mix, the coefficient of T in a_mix, b_mix, and the critical
+     *     pressure, temperature and molar volume of the mixture.
+     */
+    const vector_fp& mixingParameters() const;
+
     // Special functions not inherited from MixtureFugacityTP
 
     doublereal da_dt() const;
@@ -309,6 +344,9 @@ protected:
     vector_fp a_vec_Curr_;
     vector_fp b_vec_Curr_;
 
+    //! Temperature at which a_vec_Curr_ was last evaluated
+    doublereal m_aTempLast;
+
     Array2D a_coeff_vec;
 
     vector_fp m_pc_Species;
@@ -13,6 +13,7 @@
 #include "Phase.h"
 #include "SpeciesThermo.h"
 #include "cantera/base/global.h"
+#include <set>
 
 namespace Cantera
 {
@@ -175,7 +176,16 @@ public:
      */
     virtual void modifyOneHf298SS(const size_t k, const doublereal Hf298New) {
         m_spthermo->modifyOneHf298(k, Hf298New);
+        modifySpeciesHf298(k, Hf298New);
         m_tlast += 0.0001234;
+        invalidateCache();
+    }
+
+    //! Invalidate any cached values which are normally updated only when a
+    //! change in state is detected. This should be called when the parameters
+    //! of the phase or its species are modified.
+    virtual void invalidateCache() {
+        m_cache.clear();
     }
 
     //! Maximum temperature for which the thermodynamic data for the species
@@ -1661,6 +1671,14 @@ protected:
     virtual void getCsvReportData(std::vector<std::string>& names,
                                   std::vector<vector_fp>& data) const;
 
+    //! Update the Species object returned by species() for a change in the
+    //! 298 K heat of formation of species *k* made by modifyOneHf298SS().
+    /*!
+     * The Species object may be shared with copies of this phase, so the
+     * first modification replaces it with a private copy.
+     */
+    void modifySpeciesHf298(size_t k, doublereal Hf298New);
+
     //! Pointer to the calculation manager for species reference-state
     //! thermodynamic properties
     /*!
@@ -1673,10 +1691,18 @@ protected:
     /*!
      * This is used to access data needed to construct the transport manager and
      * other properties later in the initialization process. We create a copy of
-     * the XML_Node data read in here. Therefore, we own this data.
+     * the XML_Node data read in here, which is held by #m_speciesDataStore.
      */
     std::vector<const XML_Node*> m_speciesData;
 
+    //! Owners of the XML_Node data pointed to by #m_speciesData. The data is
+    //! not modified after it is saved, so it is shared by copies of the phase.
+    std::vector<shared_ptr<const XML_Node> > m_speciesDataStore;
+
+    //! Indices of the species whose Species object has been replaced by a
+    //! copy owned by this phase alone. See modifySpeciesHf298().
+    std::set<size_t> m_privateSpecies;
+
     //! Stored value of the electric potential for this phase. Units are Volts.
     doublereal m_phi;
 
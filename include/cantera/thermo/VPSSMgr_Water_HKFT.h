@@ -20,9 +20,19 @@
 namespace Cantera
 {
 class PDSS_Water;
+class PDSS_HKFT;
+struct HKFTSolventFunctions;
 
 //! Manages standard state thermo properties for real water and a set of
 //! species which have the HKFT equation of state.
+/*!
+ * The parameters of the HKFT species are copied into contiguous arrays when
+ * the phase is initialized. The water properties and the Born functions,
+ * which are the same for all of the HKFT species, are evaluated once for each
+ * temperature and pressure (see PDSS_HKFT::getSolventFunctions()), after
+ * which the standard state properties of all of the HKFT species are
+ * evaluated in a single loop over these arrays.
+ */
 class VPSSMgr_Water_HKFT : public VPSSMgr
 {
 public:
@@ -119,9 +129,62 @@ public:
      */
     virtual void initAllPtrs(VPStandardStateTP* vp_ptr, SpeciesThermo* sp_ptr);
 private:
+    //! Copy the parameters of the HKFT species into the contiguous arrays
+    //! used by evalHKFT()
+    void initHKFTParams() const;
+
+    //! Evaluate the standard state properties of all of the HKFT species
+    /*!
+     * @param T     Temperature (K)
+     * @param P     Pressure (Pa)
+     * @param sf    Solvent functions evaluated at T and P
+     * @param[out] g_RT  Dimensionless Gibbs free energies. Length m_kk;
+     *     only the entries for the HKFT species are set.
+     * @param[out] h_RT  Dimensionless enthalpies
+     * @param[out] s_R   Dimensionless entropies
+     * @param[out] cp_R  Dimensionless heat capacities
+     * @param[out] V     Molar volumes (m3 kmol-1)
+     */
+    void evalHKFT(doublereal T, doublereal P, const HKFTSolventFunctions& sf,
+                  doublereal* g_RT, doublereal* h_RT, doublereal* s_R,
+                  doublereal* cp_R, doublereal* V) const;
+
     //! Shallow pointer to the water object
     PDSS_Water* m_waterSS;
 
+    //! Shallow pointer to the first HKFT species, which is used to evaluate
+    //! the solvent functions shared by all of the HKFT species
+    mutable PDSS_HKFT* m_hkftSS;
+
+    //! @name HKFT Species Parameters
+    //! Contiguous copies of the parameters of the HKFT species, indexed by
+    //! species (the entries for water are unused). See PDSS_HKFT for the
+    //! units of each parameter.
+    //! @{
+    mutable vector_fp m_Mu0_tr_pr;
+    mutable vector_fp m_Entrop_tr_pr;
+    mutable vector_fp m_a1;
+    mutable vector_fp m_a2;
+    mutable vector_fp m_a3;
+    mutable vector_fp m_a4;
+    mutable vector_fp m_c1;
+    mutable vector_fp m_c2;
+    mutable vector_fp m_omega_pr_tr;
+    mutable vector_fp m_charge_j;
+
+    //! Effective electrostatic radius at Tr and Pr
+    mutable vector_fp m_r_e_j_pr_tr;
+
+    //! d(omega_j)/dT at Tr and Pr
+    mutable vector_fp m_domega_jdT_prtr;
+
+    //! Y Born function at Tr and Pr
+    mutable doublereal m_Y_pr_tr;
+
+    //! Z Born function at Tr and Pr
+    mutable doublereal m_Z_pr_tr;
+    //! @}
+
     //! Last reference temperature calculated
     /*!
      * Reference state calculations are totally separated from
@@ -13,6 +13,7 @@
 #define WATERPROPSIAPWS_H
 
 #include "WaterPropsIAPWSphi.h"
+#include "WaterPropsIAPWSTable.h"
 
 namespace Cantera
 {
@@ -153,6 +154,17 @@ namespace Cantera
  * be sure that the underlying state of this object doesn't change except due
  * to the three function calls listed above.
  *
+ * Optionally, density() and psat() can use the tables of
+ * WaterPropsIAPWSTable (see useTables()). The tabulated density is then
+ * used as the starting point of a few undamped Newton iterations on the full
+ * equation of state, so that the converged density satisfies the same
+ * convergence criteria as without tables. In psat(), the interpolated
+ * saturation pressure is corrected by one Newton step on the exact
+ * condition of equal Gibbs functions of the two phases, which reduces its
+ * error (initially bounded by WaterPropsIAPWSTable::maxSaturationError())
+ * to roughly its square. States which are not covered by the tables are
+ * handled by the exact routines.
+ *
  * @ingroup thermoprops
  */
 class WaterPropsIAPWS
@@ -164,6 +176,20 @@ public:
     WaterPropsIAPWS(const WaterPropsIAPWS& right);
     WaterPropsIAPWS& operator=(const WaterPropsIAPWS& right);
 
+    //! Enable or disable the use of the shared tables of density and
+    //! saturation properties
+    /*!
+     * The tables are generated the first time that they are enabled for any
+     * WaterPropsIAPWS object. See WaterPropsIAPWSTable.
+     */
+    void useTables(bool flag = true);
+
+    //! Returns true if the tables of density and saturation properties are
+    //! used
+    bool usingTables() const {
+        return m_table != 0;
+    }
+
     //! Set the internal state of the object wrt temperature and density
     /*!
      * @param temperature   temperature (kelvin)
@@ -436,6 +462,10 @@ private:
 
     //! Current state of the system
     mutable int iState;
+
+    //! Tables used to accelerate density() and psat(), or NULL if the exact
+    //! routines should always be used
+    const WaterPropsIAPWSTable* m_table;
 };
 
 }
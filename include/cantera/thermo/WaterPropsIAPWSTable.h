@@ -0,0 +1,221 @@
+/**
+ * @file WaterPropsIAPWSTable.h
+ * Headers for a tabulated representation of the IAPWS 1995 formulation for
+ * water, used to accelerate the density and saturation calculations of
+ * (see class \link Cantera::WaterPropsIAPWSTable WaterPropsIAPWSTable\endlink).
+ */
+#ifndef WATERPROPSIAPWSTABLE_H
+#define WATERPROPSIAPWSTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! Tabulated density and saturation properties of water, generated from the
+//! IAPWS 1995 formulation.
+/*!
+ * This class holds two tables which are generated once from the exact
+ * WaterPropsIAPWS routines, and are then shared by all WaterPropsIAPWS
+ * objects which have tabulation enabled (see WaterPropsIAPWS::useTables()).
+ *
+ * The first table contains \f$ \ln \rho \f$ as a function of T and
+ * \f$ \ln P \f$ for the stable phase, on a regular grid. At each node, the
+ * exact first derivatives are stored,
+ *
+ * \f[
+ *    \left(\frac{\partial \ln \rho}{\partial T}\right)_P = -\alpha
+ *    \qquad
+ *    \left(\frac{\partial \ln \rho}{\partial \ln P}\right)_T = P \kappa
+ * \f]
+ *
+ * where \f$ \alpha \f$ is the coefficient of thermal expansion and
+ * \f$ \kappa \f$ is the isothermal compressibility. The mixed derivative is
+ * formed by differencing \f$ P\kappa \f$ between neighboring nodes, and
+ * values inside a cell are obtained by bicubic Hermite interpolation.
+ *
+ * The second table contains \f$ \ln P_{sat} \f$ and the logarithms of the
+ * densities of the saturated liquid and gas as functions of T, interpolated
+ * with natural cubic splines.
+ *
+ * When the tables are generated, the interpolants are compared with the
+ * exact values at the center of every cell (or interval), and the relative
+ * error found there is stored as the accuracy bound of that cell. Cells whose
+ * accuracy bound exceeds the tolerance, cells which straddle the saturation
+ * curve, and cells containing a node where the exact density calculation
+ * failed are marked as unusable. The lookup functions return false for
+ * these cells and for states outside of the tables, in which case the caller
+ * should fall back to the exact routine.
+ *
+ * @ingroup thermoprops
+ */
+class WaterPropsIAPWSTable
+{
+public:
+    //! Generate the tables.
+    /*!
+     * @param rtol  Maximum relative error in the interpolated density or
+     *     saturation pressure. Cells with a larger error are not used.
+     */
+    WaterPropsIAPWSTable(doublereal rtol=1.0E-4);
+
+    //! Return the table shared by all WaterPropsIAPWS objects. The table is
+    //! generated on the first call.
+    static const WaterPropsIAPWSTable& defaultTable();
+
+    //! Look up the density of the stable phase at a given temperature and
+    //! pressure.
+    /*!
+     * @param temperature  Temperature (K)
+     * @param pressure     Pressure (Pa)
+     * @param phase        Requested phase (WATER_GAS, WATER_LIQUID or
+     *     WATER_SUPERCRIT), or -1 if no phase was requested
+     * @param rhoguess     Guessed density, or -1.0 if no guess was given.
+     *     Below T_c, this is used to decide which phase is wanted when no
+     *     phase was requested.
+     * @param[out] rho     Interpolated density (kg m-3)
+     * @returns true if the state is covered by the table and the requested
+     *     phase is the stable phase at the given state.
+     */
+    bool density(doublereal temperature, doublereal pressure, int phase,
+                 doublereal rhoguess, doublereal& rho) const;
+
+    //! Look up the saturation pressure and the densities of the saturated
+    //! phases
+    /*!
+     * @param temperature  Temperature (K)
+     * @param[out] psat    Saturation pressure (Pa)
+     * @param[out] rhoLiq  Density of the saturated liquid (kg m-3)
+     * @param[out] rhoGas  Density of the saturated gas (kg m-3)
+     * @returns true if the temperature is covered by the table
+     */
+    bool saturation(doublereal temperature, doublereal& psat,
+                    doublereal& rhoLiq, doublereal& rhoGas) const;
+
+    //! Tolerance used to decide which cells may be used
+    doublereal tolerance() const {
+        return m_rtol;
+    }
+
+    //! Largest relative error of the interpolated density over all usable
+    //! cells of the (T, P) table
+    doublereal maxDensityError() const {
+        return m_maxDensErr;
+    }
+
+    //! Largest relative error of the interpolated saturation pressure and
+    //! saturated densities over all usable intervals of the saturation table
+    doublereal maxSaturationError() const {
+        return m_maxSatErr;
+    }
+
+    //! @name Table Ranges
+    //! @{
+    doublereal minTemp() const {
+        return m_Tmin;
+    }
+    doublereal maxTemp() const {
+        return m_Tmin + (m_nT - 1) * m_dT;
+    }
+    doublereal minPres() const {
+        return std::exp(m_lnPmin);
+    }
+    doublereal maxPres() const {
+        return std::exp(m_lnPmin + (m_nP - 1) * m_dlnP);
+    }
+    doublereal maxSatTemp() const {
+        return m_Tmin + (m_nSat - 1) * m_dTsat;
+    }
+    //! @}
+
+private:
+    //! Fill in the (T, P) table and its accuracy bounds
+    void buildDensityTable();
+
+    //! Fill in the saturation table and its accuracy bounds
+    void buildSaturationTable();
+
+    //! Bicubic Hermite interpolation of ln(rho) within cell (i, j)
+    doublereal interpLnRho(size_t i, size_t j, doublereal u, doublereal v) const;
+
+    //! Evaluate the saturation splines within interval i
+    /*!
+     * @param i   Interval index
+     * @param t   Normalized position within the interval, 0 <= t <= 1
+     * @param[out] vals  ln(Psat), ln(rhoLiq) and ln(rhoGas)
+     */
+    void interpSat(size_t i, doublereal t, doublereal vals[3]) const;
+
+    //! Index of a node in the (T, P) table
+    size_t node(size_t i, size_t j) const {
+        return i * m_nP + j;
+    }
+
+    //! Relative tolerance for the interpolated values
+    doublereal m_rtol;
+
+    //! Lowest temperature in both tables (K)
+    doublereal m_Tmin;
+
+    //! Temperature increment of the (T, P) table (K)
+    doublereal m_dT;
+
+    //! Number of temperature nodes in the (T, P) table
+    size_t m_nT;
+
+    //! ln of the lowest pressure in the (T, P) table
+    doublereal m_lnPmin;
+
+    //! Increment in ln(P) of the (T, P) table
+    doublereal m_dlnP;
+
+    //! Number of pressure nodes in the (T, P) table
+    size_t m_nP;
+
+    //! Values of ln(rho) at the nodes. Length m_nT * m_nP.
+    vector_fp m_lnRho;
+
+    //! Values of d ln(rho) / dT at the nodes
+    vector_fp m_dlnRho_dT;
+
+    //! Values of d ln(rho) / d ln(P) at the nodes
+    vector_fp m_dlnRho_dlnP;
+
+    //! Values of d2 ln(rho) / dT d ln(P) at the nodes
+    vector_fp m_d2lnRho;
+
+    //! Phase of each node: 1 for liquid or dense supercritical fluid, 0 for
+    //! gas or dilute supercritical fluid, -1 if the node is invalid.
+    vector_int m_nodePhase;
+
+    //! Relative error at the center of each cell, or a negative value if the
+    //! cell can't be used. Length (m_nT - 1) * (m_nP - 1), ordered like the
+    //! nodes.
+    vector_fp m_cellErr;
+
+    //! Temperature increment of the saturation table (K)
+    doublereal m_dTsat;
+
+    //! Number of temperature nodes in the saturation table
+    size_t m_nSat;
+
+    //! ln(Psat), ln(rhoLiq) and ln(rhoGas) at the saturation table nodes.
+    //! Length 3 * m_nSat.
+    vector_fp m_satVals;
+
+    //! Second derivatives of the natural cubic splines through m_satVals
+    vector_fp m_satCurv;
+
+    //! Relative error at the center of each saturation interval, or a
+    //! negative value if the interval can't be used
+    vector_fp m_satErr;
+
+    //! Largest error of any usable cell in the (T, P) table
+    doublereal m_maxDensErr;
+
+    //! Largest error of any usable interval in the saturation table
+    doublereal m_maxSatErr;
+};
+
+}
+#endif
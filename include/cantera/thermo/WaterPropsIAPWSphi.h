@@ -116,6 +116,25 @@ public:
      */
     doublereal dfind(doublereal p_red, doublereal tau, doublereal deltaGuess);
 
+    //! Refine an accurate guess of the reduced density with undamped Newton
+    //! iterations
+    /*!
+     * This is intended for guesses which are already close to the solution,
+     * e.g. from a table. Unlike dfind(), no damping or cropping of the update
+     * is done, and no attempt is made to recover from a guess inside the
+     * spinodal curve. The convergence criteria are the same as in dfind().
+     *
+     * @param p_red       Value of the dimensionless pressure
+     * @param tau         Dimensionless temperature = T_c/T
+     * @param deltaGuess  Initial guess for the dimensionless density
+     * @param maxIter     Maximum number of Newton iterations
+     *
+     * @returns the dimensionless density, or 0.0 if the iteration did not
+     *     converge within maxIter iterations.
+     */
+    doublereal dfindNewton(doublereal p_red, doublereal tau, doublereal deltaGuess,
+                           int maxIter = 4);
+
     //! Calculate the dimensionless Gibbs free energy
     doublereal gibbs_RT() const;
 
@@ -230,6 +230,10 @@ public:
     virtual void setParametersFromXML(const XML_Node& eosdata);
 
     //! Get a pointer to a changeable WaterPropsIAPWS object
+    /*!
+     * This can be used to enable the tabulated density and saturation
+     * calculations, see WaterPropsIAPWS::useTables().
+     */
     WaterPropsIAPWS* getWater() {
         return &m_sub;
     }
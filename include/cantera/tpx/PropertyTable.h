@@ -0,0 +1,212 @@
+//! @file PropertyTable.h
+#ifndef TPX_PROPERTYTABLE_H
+#define TPX_PROPERTYTABLE_H
+
+#include "cantera/tpx/Sub.h"
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace tpx
+{
+
+//! Tabulated saturation and single-phase properties of a Substance
+/*!
+ * The tables are generated once from the equation of state of a Substance,
+ * and are used by Substance::Set to avoid most of the iterations of the exact
+ * routines (see Substance::useTables).
+ *
+ * The saturation table holds ln(Psat) and the logarithms of the densities of
+ * the saturated liquid and vapor on a uniform temperature grid, interpolated
+ * with cubic splines. The relative error of each interval is measured
+ * at its midpoint when the table is generated, and intervals with an error
+ * larger than the tolerance (in practice, those close to the critical point)
+ * are not used. Saturation properties are taken directly from this table.
+ *
+ * The single-phase table holds ln(v), h and s on a grid that is uniform in T
+ * and ln(P), together with their first derivatives, for bicubic Hermite
+ * interpolation. Values from this table are only used as initial guesses for
+ * Newton iterations on the equation of state, so states set using the table
+ * satisfy the same tolerances as those set by the exact routines. Cells which
+ * straddle the saturation curve or the critical temperature, or which
+ * contain a node where the equation of state could not be solved, are not
+ * used.
+ */
+class PropertyTable
+{
+public:
+    //! Generate the tables for a substance.
+    /*!
+     * The state of the substance is restored afterwards.
+     *
+     * @param sub   Substance to tabulate
+     * @param rtol  Maximum relative error in the interpolated saturation
+     *     properties
+     */
+    PropertyTable(Substance& sub, double rtol=1.0e-6);
+
+    //! Return tables for the given substance, generating them if no tables
+    //! for a substance with the same name and parameters exist yet. The
+    //! tables are shared by all substances of the same kind.
+    static std::shared_ptr<const PropertyTable> forSubstance(Substance& sub);
+
+    //! Interpolated saturation pressure and saturated liquid and vapor
+    //! densities at temperature *t*. Returns false if *t* is not covered by a
+    //! usable interval of the table.
+    bool saturation(double t, double& psat, double& rhof, double& rhov) const;
+
+    //! Estimate of the single-phase density at temperature *t* and pressure
+    //! *p*. Returns false if the state is not covered by a usable cell.
+    bool density_TP(double t, double p, double& rho) const;
+
+    //! Estimate of the single-phase temperature and density at which the
+    //! property *ifx* (propertyFlag::H or propertyFlag::S) has the value *x*
+    //! at pressure *p*. The value of *x* must not include the energy or
+    //! entropy offset of the substance. Returns false if the state is not
+    //! covered by a usable cell.
+    bool state_XP(propertyFlag::type ifx, double x, double p,
+                  double& t, double& rho) const;
+
+    //! Tolerance for the saturation table
+    double tolerance() const {
+        return m_rtol;
+    }
+
+    //! Largest relative error in any usable interval of the saturation table
+    double maxSaturationError() const {
+        return m_maxSatErr;
+    }
+
+    //! Largest relative error of the initial guesses over all usable cells
+    //! of the single-phase table. For h and s, the error is expressed as the
+    //! corresponding relative error in temperature.
+    double maxGuessError() const {
+        return m_maxCellErr;
+    }
+
+    //! @name Table Ranges
+    //! @{
+    double minTemp() const {
+        return m_Tmin;
+    }
+    double maxTemp() const {
+        return m_Tmin + (m_nT - 1) * m_dT;
+    }
+    double minPres() const {
+        return std::exp(m_lnPmin);
+    }
+    double maxPres() const {
+        return std::exp(m_lnPmin + (m_nP - 1) * m_dlnP);
+    }
+    double minSatTemp() const {
+        return m_Tsat0;
+    }
+    double maxSatTemp() const {
+        return m_nSat ? m_Tsat0 + (m_nSat - 1) * m_dTsat : m_Tsat0;
+    }
+    //! @}
+
+private:
+    //! Fill in the saturation table and its accuracy bounds
+    void buildSaturationTable(Substance& sub);
+
+    //! Fill in the single-phase table and its accuracy bounds
+    void buildPropertyTable(Substance& sub);
+
+    //! Evaluate the pressure, enthalpy and entropy of a single-phase state,
+    //! excluding the energy and entropy offsets
+    static void evalTR(Substance& sub, double t, double rho, double vals[3]);
+
+    //! Solve for the single-phase density at temperature *t* and pressure
+    //! *p*, starting from the initial estimate *rho*. Returns false if the
+    //! iterations do not converge.
+    static bool solveTP(Substance& sub, double t, double p, double& rho);
+
+    //! Compute ln(v), h and s and their derivatives with respect to T and
+    //! ln(P) at a single-phase state. The values are stored in the same order
+    //! as in #m_data, except for the mixed derivatives.
+    static void nodeValues(Substance& sub, double t, double rho,
+                           double vals[12]);
+
+    //! Evaluate the saturation splines within interval i
+    void interpSat(size_t i, double t, double vals[3]) const;
+
+    //! Bicubic Hermite interpolation of quantity q within cell (i, j)
+    double interp(size_t i, size_t j, size_t q, double u, double v) const;
+
+    //! Cubic Hermite interpolation of quantity q along ln(P) at node (i, j)
+    double interpP(size_t i, size_t j, size_t q, double v) const;
+
+    //! Index of quantity q at node (i, j) in #m_data
+    size_t index(size_t i, size_t j, size_t q) const {
+        return 4 * (3 * (i * m_nP + j) + q);
+    }
+
+    //! Index of cell (i, j) in #m_cellErr
+    size_t cell(size_t i, size_t j) const {
+        return i * (m_nP - 1) + j;
+    }
+
+    //! Relative tolerance for the saturation table
+    double m_rtol;
+
+    //! Lowest temperature in the single-phase table (K)
+    double m_Tmin;
+
+    //! Temperature increment of the single-phase table (K)
+    double m_dT;
+
+    //! Number of temperature nodes in the single-phase table
+    size_t m_nT;
+
+    //! ln of the lowest pressure in the single-phase table
+    double m_lnPmin;
+
+    //! Increment in ln(P) of the single-phase table
+    double m_dlnP;
+
+    //! Number of pressure nodes in the single-phase table
+    size_t m_nP;
+
+    //! Values of ln(v), h and s at the nodes of the single-phase table. For
+    //! each node and quantity, the value, the derivatives with respect to T
+    //! and ln(P) and the mixed derivative are stored consecutively.
+    std::vector<double> m_data;
+
+    //! Phase of each node: 0 for vapor, 1 for liquid, 2 for supercritical
+    //! fluid, or -1 if the node is invalid.
+    std::vector<int> m_nodePhase;
+
+    //! Relative error at the center of each cell, or a negative value if the
+    //! cell can't be used
+    std::vector<double> m_cellErr;
+
+    //! Lowest temperature in the saturation table (K)
+    double m_Tsat0;
+
+    //! Temperature increment of the saturation table (K)
+    double m_dTsat;
+
+    //! Number of nodes in the saturation table
+    size_t m_nSat;
+
+    //! ln(Psat), ln(rhof) and ln(rhov) at the saturation table nodes
+    std::vector<double> m_satVals;
+
+    //! Second derivatives of the cubic splines through #m_satVals
+    std::vector<double> m_satCurv;
+
+    //! Relative error at the midpoint of each saturation interval, or a
+    //! negative value if the interval can't be used
+    std::vector<double> m_satErr;
+
+    //! Largest error of any usable interval in the saturation table
+    double m_maxSatErr;
+
+    //! Largest error of any usable cell in the single-phase table
+    double m_maxCellErr;
+};
+
+}
+
+#endif
@@ -4,6 +4,7 @@
 
 #include "cantera/base/ctexceptions.h"
 #include <algorithm>
+#include <memory>
 
 namespace tpx
 {
@@ -27,6 +28,8 @@ enum type { H, S, U, V, P, T };
 
 const double Undef = 999.1234;
 
+class PropertyTable;
+
 /*!
  * Base class from which all pure substances are derived
  */
@@ -216,6 +219,22 @@ public:
     //! second property.
     void Set(PropertyPair::type XY, double x0, double y0);
 
+    //! Enable or disable the use of tabulated properties.
+    /*!
+     * When enabled, saturation properties are interpolated from a table, and
+     * states specified by (T,P), (H,P) or (S,P) are found by Newton
+     * iterations starting from tabulated estimates, falling back to the exact
+     * routines if the state is not covered by the table. The tables are
+     * generated the first time they are requested for a given substance, and
+     * are shared by all substances of the same kind. See PropertyTable.
+     */
+    void useTables(bool flag=true);
+
+    //! True if tabulated properties are being used
+    bool usingTables() const {
+        return m_table != 0;
+    }
+
 protected:
     double T, Rho;
     double Tslast, Rhf, Rhv;
@@ -225,6 +244,9 @@ protected:
     std::string m_name;
     std::string m_formula;
 
+    //! Tabulated properties, if enabled
+    std::shared_ptr<const PropertyTable> m_table;
+
     virtual double ldens()=0;
 
     //! Saturation pressure, Pa
@@ -252,6 +274,8 @@ protected:
     void update_sat();
 
 private:
+    friend class PropertyTable;
+
     void set_Rho(double r0);
     void set_T(double t0);
     void set_v(double v0);
@@ -261,6 +285,12 @@ private:
                 double X, double Y,
                 double atx, double aty, double rtx, double rty);
 
+    //! Set the state for the property pair (*ifx*, P) using Newton iterations
+    //! starting from the tabulated properties, where *ifx* is T, H or S.
+    //! Returns false, leaving the state unchanged, if the state is not
+    //! covered by the table or the iterations do not converge.
+    bool set_xP_table(propertyFlag::type ifx, double X, double Pres);
+
     int kbr;
     double Vmin, Vmax;
     double Pmin, Pmax;
@@ -12,7 +12,7 @@
 
 // Cantera includes
 #include "TransportBase.h"
-#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/SquareMatrix.h"
 
 namespace Cantera
 {
@@ -153,6 +153,19 @@ public:
      */
     void setPermeability(doublereal B);
 
+    //! Get the H matrix at the current state of the phase, in LU-factored
+    //! form.
+    /*!
+     * The molar fluxes for a given driving force are obtained by back-
+     * substitution, \f$ J = -H^{-1} \left( \nabla C + \dots \right) \f$ (see
+     * getMolarFluxes()), using `H.solve()`. The factorization is computed
+     * once for each state of the phase and each set of parameters of the
+     * porous medium, and is copied into *H*.
+     *
+     * @param[out] H  Factored H matrix. See eval_H_matrix().
+     */
+    void getFactoredHMatrix(SquareMatrix& H);
+
     //! Return a reference to the transport manager used to compute the gas
     //! binary diffusion coefficients and the viscosity.
     /*!
@@ -190,9 +203,11 @@ private:
 
     //! Update concentration-dependent quantities within the object
     /*!
-     * The object keeps a value m_temp, which is the temperature at which
-     * quantities were last evaluated at. If the temperature is changed, update
-     * Booleans are set false, triggering recomputation.
+     * The mole fractions are only read from the phase if its composition or
+     * pressure changed since the last call. The Knudsen diffusion
+     * coefficients do not depend on the composition or the pressure, and the
+     * binary diffusion coefficients are only recomputed if the pressure
+     * changed.
      */
     void updateTransport_C();
 
@@ -207,14 +222,19 @@ private:
      * \f]
      *
      * where \f$ \phi \f$ is the porosity of the media and \f$ \tau \f$ is the
-     * tortuosity of the media.
+     * tortuosity of the media. Only the gas-phase coefficients are stored in
+     * #m_d; the factor \f$ \phi / \tau \f$ is applied in eval_H_matrix(), so
+     * that changing the porosity or tortuosity does not require them to be
+     * recomputed.
      */
     void updateBinaryDiffCoeffs();
 
     //! Update the Multicomponent diffusion coefficients that are used in the
     //! approximation
     /*!
-     * This routine updates the H matrix and then inverts it.
+     * This routine updates the H matrix and then computes its LU
+     * factorization. Nothing is done if the state of the phase and the
+     * parameters of the porous medium are the same as in the previous call.
      */
     void updateMultiDiffCoeffs();
 
@@ -248,7 +268,7 @@ private:
      */
     vector_fp m_mw;
 
-    //! binary diffusion coefficients
+    //! gas-phase binary diffusion coefficients
     DenseMatrix m_d;
 
     //! mole fractions
@@ -260,8 +280,14 @@ private:
     //! temperature
     doublereal m_temp;
 
-    //! Multicomponent diffusion coefficients. @see eval_H_matrix()
-    DenseMatrix m_multidiff;
+    //! pressure at which #m_d was evaluated
+    doublereal m_pres;
+
+    //! State number of the phase composition for which #m_x was evaluated
+    int m_iStateMF;
+
+    //! LU factorization of the H matrix. @see eval_H_matrix()
+    SquareMatrix m_multidiff;
 
     //! work space of size m_nsp;
     vector_fp m_spwork;
@@ -278,6 +304,9 @@ private:
     //! Update-to-date variable for Binary diffusion coefficients
     bool m_bulk_ok;
 
+    //! Update-to-date variable for the factored H matrix
+    bool m_H_ok;
+
     //! Porosity
     doublereal m_porosity;
 
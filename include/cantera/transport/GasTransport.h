@@ -107,14 +107,176 @@ public:
      */
     virtual void getMixDiffCoeffsMass(doublereal* const d);
 
+    //! Evaluate the mixture transport properties at a set of states
+    /*!
+     * The properties are evaluated directly from the given states, without
+     * changing the state of the phase. The temperature-dependent species
+     * properties are only recomputed if the temperature differs from that
+     * of the previous point, so points should be grouped by temperature
+     * where possible. See Transport::getMixtureProperties() for a
+     * description of the arguments.
+     */
+    virtual void getMixtureProperties(size_t npoints, const doublereal* T,
+                                      const doublereal* P, const doublereal* X,
+                                      doublereal* visc, doublereal* cond,
+                                      doublereal* diff, doublereal* dtherm=0);
+
+    //! Evaluate the mixture transport properties at a set of states given
+    //! by unnormalized mass fractions, without changing the state of the
+    //! phase. See Transport::getMixtureProperties_NoNorm().
+    virtual void getMixtureProperties_NoNorm(size_t npoints,
+            const doublereal* T, const doublereal* P, const doublereal* Y,
+            doublereal* visc, doublereal* cond, doublereal* diff,
+            doublereal* dtherm=0);
+
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
+    //! Use a table to evaluate the binary diffusion coefficients
+    /*!
+     * When enabled, the binary diffusion coefficients at unit pressure,
+     * divided by \f$ T^{3/2} \f$, are tabulated for each species pair on a
+     * grid which is uniform in ln(T) and covers the temperature range of the
+     * phase. These values are interpolated linearly in ln(T), which is
+     * cheaper than evaluating the polynomial fits (especially for fits in
+     * CK_Mode, which require an exponential for each pair).
+     *
+     * The grid is refined until the largest relative difference between the
+     * interpolated values and the fits, evaluated at the center of each
+     * interval for every species pair, is smaller than *rtol*. At
+     * temperatures outside the range of the table, the fits are used.
+     *
+     * @param flag  True to use the table
+     * @param rtol  Relative tolerance for the interpolated values
+     */
+    void useBinaryDiffTable(bool flag, doublereal rtol=1.0e-5);
+
+    //! Largest relative difference between the tabulated and fitted binary
+    //! diffusion coefficients, measured when the table was generated. Zero if
+    //! the table is not used.
+    doublereal binaryDiffTableError() const {
+        return m_bdiffTableErr;
+    }
+
+    //! Coefficients of the polynomial fit to the viscosity of species *k*
+    /*!
+     * The polynomial is in ln(T), with coefficients in order of increasing
+     * power. In CK_Mode, the fit is to ln(visc); otherwise, it is to
+     * \f$ \sqrt{\mu_k/\sqrt{T}} \f$.
+     */
+    const vector_fp& viscosityPolynomial(size_t k) const {
+        m_thermo->checkSpeciesIndex(k);
+        return m_visccoeffs[k];
+    }
+
+    //! Coefficients of the polynomial fit to the thermal conductivity of
+    //! species *k*
+    /*!
+     * The polynomial is in ln(T), with coefficients in order of increasing
+     * power. In CK_Mode, the fit is to ln(cond); otherwise, it is to
+     * \f$ \lambda_k/\sqrt{T} \f$.
+     */
+    const vector_fp& conductivityPolynomial(size_t k) const {
+        m_thermo->checkSpeciesIndex(k);
+        return m_condcoeffs[k];
+    }
+
+    //! Coefficients of the polynomial fit to the binary diffusion
+    //! coefficient of species *i* and *j* at unit pressure
+    /*!
+     * The polynomial is in ln(T), with coefficients in order of increasing
+     * power. In CK_Mode, the fit is to ln(D_ij); otherwise, it is to
+     * \f$ \mathcal{D}_{ij}/T^{3/2} \f$. These are the same coefficients that
+     * are stored packed by coefficient for all species pairs and used to
+     * evaluate the binary diffusion coefficients and to generate the table
+     * of useBinaryDiffTable().
+     */
+    const vector_fp& binDiffusivityPolynomial(size_t i, size_t j) const;
+
+    //! Set the directory used to cache the polynomial fits of the transport
+    //! properties
+    /*!
+     * Generating the fits of the collision integrals and of the species and
+     * binary transport properties takes most of the time needed to
+     * initialize a GasTransport object. When a cache directory is set, the
+     * fits are stored in a binary file in this directory, named after a hash
+     * of the species transport parameters, molecular weights, heat
+     * capacities at the fit temperatures, temperature range and fitting
+     * options. Later initializations with the same inputs, including those
+     * by other processes, read the fits from this file instead of generating
+     * them again. Files which can't be read or whose inputs don't match are
+     * ignored and replaced.
+     *
+     * @param dir  Existing directory to use for the cache, or an empty string
+     *     (the default) to disable caching.
+     */
+    static void setFitCacheDirectory(const std::string& dir);
+
+    //! The directory used to cache the fits, or an empty string if caching
+    //! is disabled. See setFitCacheDirectory().
+    static std::string fitCacheDirectory();
+
 protected:
     GasTransport(ThermoPhase* thermo=0);
 
+    //! Update the temperature-dependent quantities if the temperature of the
+    //! phase has changed
     virtual void update_T();
+
+    //! Update the concentration-dependent quantities if the composition of
+    //! the phase has changed
     virtual void update_C() = 0;
 
+    //! Update the temperature-dependent quantities for temperature *T*, if
+    //! this differs from the temperature of the last update
+    virtual void updateTemperature(doublereal T);
+
+    //! Set the mole fractions used to evaluate the mixture properties, and
+    //! mark the composition-dependent quantities as out of date
+    /*!
+     * @param x  Normalized mole fractions. Length m_nsp. Values smaller than
+     *     *Tiny* are replaced by *Tiny*.
+     */
+    virtual void updateMoleFractions(const doublereal* const x);
+
+    //! Evaluate the mixture properties for point *i* of a batch, at
+    //! temperature *T*, pressure *P* and mole fractions *x* with mean
+    //! molecular weight *mmw*. Used by getMixtureProperties() and
+    //! getMixtureProperties_NoNorm().
+    void evalMixtureProperties(size_t i, doublereal T, doublereal P,
+                               const doublereal* x, doublereal mmw,
+                               doublereal* visc, doublereal* cond,
+                               doublereal* diff, doublereal* dtherm);
+
+    //! @name Property evaluation at the internal state
+    //!
+    //! These methods evaluate the properties at the temperature and mole
+    //! fractions set by the last calls to updateTemperature() and
+    //! updateMoleFractions(), without reference to the state of the phase.
+    //! @{
+
+    //! Mixture viscosity (Pa s). See viscosity().
+    doublereal evalViscosity();
+
+    //! Mixture-averaged diffusion coefficients (m^2/s). See
+    //! getMixDiffCoeffs().
+    /*!
+     * @param p    Pressure (Pa)
+     * @param mmw  Mean molecular weight (kg/kmol)
+     * @param[out] d  Mixture-averaged diffusion coefficients. Length m_nsp.
+     */
+    void evalMixDiffCoeffs(doublereal p, doublereal mmw, doublereal* const d);
+
+    //! Mixture thermal conductivity (W/m/K). See thermalConductivity().
+    virtual doublereal evalThermalConductivity() {
+        throw NotImplementedError("GasTransport::evalThermalConductivity");
+    }
+
+    //! Thermal diffusion coefficients (kg/m/s). See getThermalDiffCoeffs().
+    virtual void evalThermalDiffCoeffs(doublereal* const dt) {
+        throw NotImplementedError("GasTransport::evalThermalDiffCoeffs");
+    }
+    //! @}
+
     //! Update the temperature-dependent viscosity terms.
     /**
      * Updates the array of pure species viscosities, and the weighting
@@ -141,6 +303,29 @@ protected:
      */
     virtual void updateDiff_T();
 
+    //! Evaluate a set of polynomial fits in ln(T)
+    /*!
+     * @param coeffs  Fit coefficients, stored in the layout of #m_viscFit
+     * @param n       Number of fitted quantities
+     * @param logT    Natural logarithm of the temperature
+     * @param[out] out  Values of the polynomials. Length *n*.
+     */
+    void evalPolyFits(const vector_fp& coeffs, size_t n, doublereal logT,
+                      doublereal* const out) const;
+
+    //! Evaluate the fits for the binary diffusion coefficients of all species
+    //! pairs at unit pressure, divided by \f$ T^{3/2} \f$
+    /*!
+     * @param T  Temperature (K)
+     * @param[out] f  Values for each species pair, ordered as in
+     *     #m_diffcoeffs
+     */
+    void evalDiffFits(doublereal T, doublereal* const f) const;
+
+    //! Build the table of binary diffusion coefficients. See
+    //! useBinaryDiffTable().
+    void buildBinaryDiffTable();
+
     //! @name Initialization
     //! @{
 
@@ -204,6 +389,37 @@ protected:
      */
     void fitProperties(MMCollisionInt& integrals);
 
+    //! Set up the rearranged coefficients used to evaluate the fits of the
+    //! species and binary transport properties, and the binary diffusion
+    //! coefficient table if it is enabled.
+    void prepareFits();
+
+    //! Values which determine the results of fitCollisionIntegrals() and
+    //! fitProperties(), used to identify the fits in the cache
+    /*!
+     * @param tstar_min  Lower bound of the reduced temperature range of the
+     *     collision integral fits
+     * @param tstar_max  Upper bound of the reduced temperature range of the
+     *     collision integral fits
+     */
+    vector_fp fitCacheKey(doublereal tstar_min, doublereal tstar_max);
+
+    //! Read the fits from a cache file written by saveFits()
+    /*!
+     * @param fname  Name of the cache file
+     * @param key    Inputs of the fits, from fitCacheKey()
+     * @returns true if the file exists, was generated from the same inputs,
+     *     and was read successfully. Otherwise, no fits are changed.
+     */
+    bool loadFits(const std::string& fname, const vector_fp& key);
+
+    //! Write the fits to a cache file. Failures are ignored.
+    /*!
+     * @param fname  Name of the cache file
+     * @param key    Inputs of the fits, from fitCacheKey()
+     */
+    void saveFits(const std::string& fname, const vector_fp& key) const;
+
     //! Second-order correction to the binary diffusion coefficients
     /*!
      * Calculate second-order corrections to binary diffusion coefficient pair
@@ -273,18 +489,18 @@ protected:
     //! Local copy of the species molecular weights.
     vector_fp m_mw;
 
-    //! Holds square roots of molecular weight ratios
+    //! Holds molecular weight ratios used in Wilke's rule
     /*!
      *  @code
-     *  m_wratjk(j,k)  = sqrt(mw[j]/mw[k])        j < k
-     *  m_wratjk(k,j)  = sqrt(sqrt(mw[j]/mw[k]))  j < k
+     *  m_wratjk(j,k)  = mw[k]/mw[j]              j < k
+     *  m_wratjk(k,j)  = sqrt(sqrt(mw[j]/mw[k]))  j <= k
      *  @endcode
      */
     DenseMatrix m_wratjk;
 
-    //! Holds square roots of molecular weight ratios
+    //! Holds the molecular weight factors of the denominator in Wilke's rule
     /*!
-     *  `m_wratjk1(j,k)  = sqrt(1.0 + mw[k]/mw[j])        j < k`
+     *  `m_wratkj1(k,j)  = 1.0 / sqrt(8.0 * (1.0 + mw[k]/mw[j]))        j <= k`
      */
     DenseMatrix m_wratkj1;
 
@@ -345,6 +561,46 @@ protected:
      */
     std::vector<vector_fp> m_condcoeffs;
 
+    //! Coefficients of the viscosity fits in #m_visccoeffs, stored by
+    //! coefficient rather than by species: coefficient n for species k is
+    //! `m_viscFit[n*m_nsp + k]`. This allows the fits for all species to be
+    //! evaluated together in vectorizable loops.
+    vector_fp m_viscFit;
+
+    //! Coefficients of the conductivity fits in #m_condcoeffs, in the layout
+    //! of #m_viscFit
+    vector_fp m_condFit;
+
+    //! Coefficients of the binary diffusion coefficient fits in
+    //! #m_diffcoeffs, in the layout of #m_viscFit with one entry per species
+    //! pair
+    vector_fp m_diffFit;
+
+    //! Work space for the binary diffusion coefficients of each species pair,
+    //! ordered as in #m_diffcoeffs
+    vector_fp m_bdiffPairs;
+
+    //! Tabulated binary diffusion coefficients at unit pressure divided by
+    //! \f$ T^{3/2} \f$. The value for pair ic (ordered as in #m_diffcoeffs)
+    //! at node n is `m_bdiffTable[n*npairs + ic]`. Empty if the table is
+    //! not used. See useBinaryDiffTable().
+    vector_fp m_bdiffTable;
+
+    //! ln(T) at the first node of #m_bdiffTable
+    doublereal m_bdiffTableLogTmin;
+
+    //! Spacing in ln(T) of the nodes of #m_bdiffTable
+    doublereal m_bdiffTableDlogT;
+
+    //! Number of nodes in #m_bdiffTable
+    size_t m_bdiffTableNT;
+
+    //! Relative tolerance for #m_bdiffTable
+    doublereal m_bdiffTableRtol;
+
+    //! Largest relative error of the values interpolated from #m_bdiffTable
+    doublereal m_bdiffTableErr;
+
     //! Indices for the (i,j) interaction in collision integral fits
     /*!
      *  m_poly[i][j] contains the index for (i,j) interactions in
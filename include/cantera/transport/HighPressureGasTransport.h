@@ -10,6 +10,7 @@
 #include "GasTransport.h"
 #include "cantera/numerics/DenseMatrix.h"
 #include "cantera/transport/MultiTransport.h"
+#include "cantera/base/ValueCache.h"
 
 namespace Cantera
 {
@@ -22,6 +23,12 @@ namespace Cantera
  * averaging rules for the mixture properties, and the Lucas method for the
  * viscosity of a high-pressure gas mixture.
  *
+ * The critical properties of the pure species are evaluated once. The
+ * pseudo-critical properties of each species pair are cached for each
+ * composition, and the Takahashi correction factors, viscosity and thermal
+ * conductivity are cached for each state. The Takahashi correction factors
+ * can optionally be interpolated from a table (see useCorrectionTable()).
+ *
  * @ingroup tranprops
  */
 class HighPressureGasTransport : public MultiTransport
@@ -64,6 +71,73 @@ public:
 
     virtual doublereal viscosity();
 
+    //! Evaluate the mixture transport properties at a set of states.
+    //! The high-pressure corrections depend on the state of the phase, so
+    //! this uses the general implementation in Transport, which sets the
+    //! state of the phase for each point.
+    virtual void getMixtureProperties(size_t npoints, const doublereal* T,
+                                      const doublereal* P, const doublereal* X,
+                                      doublereal* visc, doublereal* cond,
+                                      doublereal* diff, doublereal* dtherm=0) {
+        Transport::getMixtureProperties(npoints, T, P, X, visc, cond, diff,
+                                        dtherm);
+    }
+
+    virtual void getMixtureProperties_NoNorm(size_t npoints,
+            const doublereal* T, const doublereal* P, const doublereal* Y,
+            doublereal* visc, doublereal* cond, doublereal* diff,
+            doublereal* dtherm=0) {
+        Transport::getMixtureProperties_NoNorm(npoints, T, P, Y, visc, cond,
+                                               diff, dtherm);
+    }
+
+    //! Evaluate the high-pressure viscosity, thermal conductivity and binary
+    //! diffusion coefficients at a set of states.
+    /*!
+     * The state of the phase is set to each point in turn, and restored
+     * afterwards. When consecutive points have the same composition, only
+     * the temperature and pressure are changed, so that the pseudo-critical
+     * properties of the species pairs are reused.
+     *
+     * @param npoints  Number of states
+     * @param T        Temperatures [K]. length = npoints
+     * @param P        Pressures [Pa]. length = npoints
+     * @param X        Mole fractions, with the species in the inner loop.
+     *                 length = npoints * m_nsp
+     * @param visc     Viscosities [Pa-s], or null if not needed.
+     *                 length = npoints
+     * @param cond     Thermal conductivities [W/m/K], or null if not needed.
+     *                 length = npoints
+     * @param bdiff    Binary diffusion coefficients [m^2/s] as returned by
+     *                 getBinaryDiffCoeffs() with ld = m_nsp, or null if not
+     *                 needed. length = npoints * m_nsp * m_nsp
+     */
+    void getHighPressureProperties(size_t npoints, const doublereal* T,
+                                   const doublereal* P, const doublereal* X,
+                                   doublereal* visc, doublereal* cond,
+                                   doublereal* bdiff);
+
+    //! Enable or disable interpolation of the Takahashi correction factors
+    //! from a table.
+    /*!
+     * The correction factor at each of the reduced pressures of the
+     * Takahashi chart is tabulated on a grid which is uniform in ln(Tr), for
+     * 0.5 <= Tr <= 100. The number of intervals is doubled until the
+     * interpolation error at the midpoints of all intervals, relative to
+     * max(1, |value|), is below *rtol*. The exact expressions are used outside
+     * of the range of the table.
+     *
+     * @param flag  If true, build the table; otherwise, discard it.
+     * @param rtol  Tolerance for the interpolation error.
+     */
+    void useCorrectionTable(bool flag, doublereal rtol=1.0e-4);
+
+    //! Largest interpolation error in the table of Takahashi correction
+    //! factors, or zero if the table is not used
+    doublereal correctionTableError() const {
+        return m_pcorrTableErr;
+    }
+
     friend class TransportFactory;
 
 protected:
@@ -80,6 +154,66 @@ protected:
     virtual doublereal FQ_i(doublereal Q, doublereal Tr, doublereal MW);
 
     virtual doublereal setPcorr(doublereal Pr, doublereal Tr);
+
+    //! Store the pure-species critical properties and quantum parameters,
+    //! if this has not been done yet
+    void updateCriticalProperties();
+
+    //! Pseudo-critical temperatures and pressures of the species pairs
+    /*!
+     * Returns the mole-fraction-weighted critical temperatures (first
+     * m_nsp * m_nsp entries) and pressures (last m_nsp * m_nsp entries) for
+     * each pair, in column-major order. Evaluated once for each composition.
+     */
+    const vector_fp& pairCriticalProperties();
+
+    //! Takahashi correction factors of the binary diffusion coefficients
+    //! for each species pair, in column-major order. Evaluated once for each
+    //! state.
+    const vector_fp& pressureCorrections();
+
+    //! Takahashi correction factor at the given reduced pressure and
+    //! temperature, using the table if it is available. Equivalent to
+    //! setPcorr().
+    doublereal correctionFactor(doublereal Pr, doublereal Tr);
+
+    //! Build the table used by correctionFactor()
+    void buildCorrectionTable(doublereal rtol);
+
+    //! Critical temperature of each species
+    vector_fp m_Tcrit;
+
+    //! Critical pressure of each species
+    vector_fp m_Pcrit;
+
+    //! Critical volume of each species
+    vector_fp m_Vcrit;
+
+    //! Critical compressibility of each species
+    vector_fp m_Zcrit;
+
+    //! Quantum parameter of each species used in the viscosity correction,
+    //! or 0 for species without a quantum correction
+    vector_fp m_quantumQ;
+
+    //! Cache for the pair properties and the mixture properties
+    ValueCache m_cache;
+
+    //! Takahashi correction factors at the table nodes. The values for all
+    //! reduced pressures of the chart at a node are stored consecutively.
+    vector_fp m_pcorrTable;
+
+    //! ln(Tr) at the first node of the correction table
+    doublereal m_pcorrLogTrMin;
+
+    //! Increment in ln(Tr) of the correction table
+    doublereal m_pcorrDlogTr;
+
+    //! Number of intervals of the correction table
+    size_t m_pcorrNT;
+
+    //! Largest interpolation error of the correction table
+    doublereal m_pcorrTableErr;
 };
 }
 #endif
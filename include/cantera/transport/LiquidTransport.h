@@ -6,7 +6,7 @@
 #define CT_LIQUIDTRAN_H
 
 #include "TransportBase.h"
-#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/SquareMatrix.h"
 #include "LiquidTransportParams.h"
 
 namespace Cantera
@@ -571,6 +571,37 @@ public:
      */
     virtual void getSpeciesFluxesExt(size_t ldf, doublereal* fluxes);
 
+    //! Return the species diffusive mass fluxes at several states
+    /*!
+     * Equivalent to setting the state of the phase to each of the given
+     * states in turn and calling getSpeciesFluxesES() with `ndim` equal to
+     * the number of dimensions of this object. The Stefan-Maxwell matrix is
+     * factored once for each state, with one right-hand side for each
+     * dimension. The state of the phase is restored afterwards.
+     *
+     * units = kg/m2/s
+     *
+     * @param npoints   Number of states
+     * @param T         Temperatures [K]. length = npoints
+     * @param P         Pressures [Pa]. length = npoints
+     * @param X         Mole fractions, with the species in the inner loop.
+     *                  length = npoints * m_nsp
+     * @param grad_T    Temperature gradients. length = npoints * ndim
+     * @param grad_X    Gradients of the mole fractions, laid out for each
+     *                  state as for getSpeciesFluxesES() with ldx = m_nsp.
+     *                  length = npoints * ndim * m_nsp
+     * @param grad_Phi  Gradients of the electrostatic potential.
+     *                  length = npoints * ndim
+     * @param fluxes    Output of the diffusive mass fluxes, laid out like
+     *                  grad_X.
+     */
+    void getSpeciesFluxesESMulti(size_t npoints, const doublereal* T,
+                                 const doublereal* P, const doublereal* X,
+                                 const doublereal* grad_T,
+                                 const doublereal* grad_X,
+                                 const doublereal* grad_Phi,
+                                 doublereal* fluxes);
+
 protected:
     //! Returns true if temperature has changed, in which case flags are set to
     //! recompute transport properties.
@@ -659,9 +690,20 @@ protected:
      * One of the Stefan Maxwell equations is replaced by the appropriate
      * definition of the mass-averaged velocity, the mole-averaged velocity or
      * the specification that velocities are relative to that of one species.
+     *
+     * The matrix of the system only depends on the state, so its
+     * factorization is kept (see updateStefanMaxwellMatrix()) and each call
+     * only requires a back-substitution for the current gradients.
      */
     void stefan_maxwell_solve();
 
+    //! Form and factor the matrix of the Stefan-Maxwell equations
+    /*!
+     * Nothing is done if the temperature, pressure, composition and velocity
+     * basis are unchanged since the last factorization.
+     */
+    void updateStefanMaxwellMatrix();
+
     //! Updates the array of pure species viscosities internally.
     /*!
      * The flag m_visc_ok is set to true.
@@ -1124,8 +1166,11 @@ private:
     //! RHS to the Stefan-Maxwell equation
     DenseMatrix m_B;
 
-    //! Matrix for the Stefan-Maxwell equation.
-    DenseMatrix m_A;
+    //! Matrix for the Stefan-Maxwell equation, in LU-factored form.
+    SquareMatrix m_A;
+
+    //! Velocity basis used to form #m_A
+    VelocityBasis m_velocityBasis_A;
 
     //! Current Temperature -> locally stored. This is used to test whether new
     //! temperature computations should be performed.
@@ -1219,7 +1264,8 @@ private:
     //! the concentration
     bool m_radi_conc_ok;
 
-    //! Boolean indicating that mixture diffusion coeffs are current
+    //! Boolean indicating that the factored Stefan-Maxwell matrix #m_A is
+    //! current
     bool m_diff_mix_ok;
 
     //! Boolean indicating that binary diffusion coeffs are current
@@ -120,9 +120,9 @@ public:
     //! Update the internal parameters whenever the temperature has changed
     /*!
      * This is called whenever a transport property is requested if the
-     * temperature has changed since the last call to update_T().
+     * temperature has changed since the last update.
      */
-    virtual void update_T();
+    virtual void updateTemperature(doublereal T);
 
     //! Update the internal parameters whenever the concentrations have changed
     /*!
@@ -131,6 +131,8 @@ public:
      */
     virtual void update_C();
 
+    virtual void updateMoleFractions(const doublereal* const x);
+
     //! Get the species diffusive mass fluxes wrt to the mass averaged velocity,
     //! given the gradients in mole fraction and temperature
     /*!
@@ -158,6 +160,10 @@ public:
 
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
+protected:
+    virtual doublereal evalThermalConductivity();
+    virtual void evalThermalDiffCoeffs(doublereal* const dt);
+
 private:
     //! Calculate the pressure from the ideal gas law
     doublereal pressure_ig() const {
@@ -192,6 +198,10 @@ private:
     //! Update boolean for the mixture rule for the mixture thermal conductivity
     bool m_condmix_ok;
 
+    //! State number of the mole fractions used to compute the mixture
+    //! properties. See Phase::stateMFNumber().
+    int m_iStateMF;
+
     //! Debug flag - turns on more printing
     bool m_debug;
 };
@@ -113,14 +113,40 @@ public:
 
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
+    //! Choose the method used to solve the L-matrix equation for the thermal
+    //! conductivity and thermal diffusion coefficients
+    /*!
+     * By default, the equation is solved by LU factorization of the L-matrix
+     * at each state, which takes O(K^3) operations. If *iterative* is true,
+     * the equation is instead solved with GMRES, preconditioned with the LU
+     * factorization of the L-matrix at an earlier state and started from
+     * the previous solution. Each iteration takes O(K^2) operations, so this
+     * is much faster when the properties are evaluated at a sequence of
+     * similar states, for example at neighboring grid points. The
+     * factorization is only updated if the iterations fail to converge.
+     *
+     * @param iterative  True to use the iterative solver
+     * @param rtol  Relative tolerance on the residual of the L-matrix
+     *     equation
+     * @param maxIterations  Maximum number of iterations before the
+     *     factorization is updated
+     */
+    void useIterativeSolver(bool iterative, doublereal rtol=1.0e-8,
+                            size_t maxIterations=20);
+
 protected:
     //! Update basic temperature-dependent quantities if the temperature has
     //! changed.
-    void update_T();
+    virtual void updateTemperature(doublereal T);
 
     //! Update basic concentration-dependent quantities if the concentrations
     //! have changed.
-    void update_C();
+    virtual void update_C();
+
+    virtual void updateMoleFractions(const doublereal* const x);
+
+    virtual doublereal evalThermalConductivity();
+    virtual void evalThermalDiffCoeffs(doublereal* const dt);
 
     //! Update the temperature-dependent terms needed to compute the thermal
     //! conductivity and thermal diffusion coefficients.
@@ -152,6 +178,23 @@ protected:
     // L matrix quantities
     DenseMatrix m_Lmatrix;
     SquareMatrix m_aa;
+
+    //! True if the L-matrix equation is solved iteratively. See
+    //! useIterativeSolver().
+    bool m_iterative;
+
+    //! Relative tolerance for the iterative L-matrix solver
+    doublereal m_iter_rtol;
+
+    //! Maximum number of iterations of the iterative L-matrix solver
+    size_t m_iter_max;
+
+    //! LU factorization of the L-matrix at an earlier state, used as the
+    //! preconditioner for the iterative solver
+    SquareMatrix m_Lprec;
+
+    //! True if #m_Lprec holds a valid factorization
+    bool m_Lprec_ok;
     vector_fp m_a;
     vector_fp m_b;
 
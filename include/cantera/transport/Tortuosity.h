@@ -43,6 +43,8 @@ public:
     Tortuosity(double setPower = 1.5) : expBrug_(setPower) {
     }
 
+    virtual ~Tortuosity() {}
+
     //! The tortuosity factor models the effective increase in the
     //! diffusive transport length.
     /**
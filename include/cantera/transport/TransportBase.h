@@ -655,6 +655,65 @@ public:
         throw NotImplementedError("Transport::getMixDiffCoeffsMass");
     }
 
+    //! Evaluate the mixture transport properties at a set of states
+    /*!
+     * The results are the same as those obtained by setting the state of the
+     * phase to each of the given states in turn and calling viscosity(),
+     * thermalConductivity(), getMixDiffCoeffs() and getThermalDiffCoeffs().
+     * The state of the phase is the same before and after the call.
+     *
+     * This implementation sets the state of the phase for each point and
+     * restores it at the end. Derived classes may override it to evaluate
+     * the properties without changing the state of the phase.
+     *
+     * @param npoints    Number of states
+     * @param T          Temperatures (K). Length npoints.
+     * @param P          Pressures (Pa). Length npoints.
+     * @param X          Mole fractions. The mole fractions at point i start
+     *                   at X[i*m_nsp]. Length npoints * m_nsp.
+     * @param[out] visc  Mixture viscosities (Pa s), or NULL if not needed.
+     *                   Length npoints.
+     * @param[out] cond  Mixture thermal conductivities (W/m/K), or NULL if
+     *                   not needed. Length npoints.
+     * @param[out] diff  Mixture-averaged diffusion coefficients (m^2/s), as
+     *                   returned by getMixDiffCoeffs(), or NULL if not
+     *                   needed. Stored like X.
+     * @param[out] dtherm  Thermal diffusion coefficients (kg/m/s), or NULL if
+     *                   not needed. Stored like X.
+     */
+    virtual void getMixtureProperties(size_t npoints, const doublereal* T,
+                                      const doublereal* P, const doublereal* X,
+                                      doublereal* visc, doublereal* cond,
+                                      doublereal* diff, doublereal* dtherm=0);
+
+    //! Evaluate the mixture transport properties at a set of states given
+    //! by unnormalized mass fractions
+    /*!
+     * This is the same as getMixtureProperties(), except that the
+     * composition at each point is given by mass fractions, which are used
+     * as in Phase::setMassFractions_NoNorm(): they are neither clipped nor
+     * normalized, and the mean molecular weight is \f$ 1 / \sum_k Y_k / W_k
+     * \f$. This is the form used by the one-dimensional flow domains, where
+     * the solution may contain slightly negative mass fractions.
+     *
+     * @param npoints    Number of states
+     * @param T          Temperatures (K). Length npoints.
+     * @param P          Pressures (Pa). Length npoints.
+     * @param Y          Mass fractions. The mass fractions at point i start
+     *                   at Y[i*m_nsp]. Length npoints * m_nsp.
+     * @param[out] visc  Mixture viscosities (Pa s), or NULL if not needed.
+     * @param[out] cond  Mixture thermal conductivities (W/m/K), or NULL if
+     *                   not needed.
+     * @param[out] diff  Mixture-averaged diffusion coefficients (m^2/s), or
+     *                   NULL if not needed. Stored like Y.
+     * @param[out] dtherm  Thermal diffusion coefficients (kg/m/s), or NULL if
+     *                   not needed. Stored like Y.
+     */
+    virtual void getMixtureProperties_NoNorm(size_t npoints,
+            const doublereal* T, const doublereal* P, const doublereal* Y,
+            doublereal* visc, doublereal* cond, doublereal* diff,
+            doublereal* dtherm=0);
+
     //! Set model parameters for derived classes
     /*!
      * This method may be derived in subclasses to set model-specific
@@ -39,10 +39,13 @@ public:
     virtual void updateState(doublereal* y);
 
     //! Return the index in the solution vector for this reactor of the
-    //! component named *nm*. Possible values for *nm* are "mass", "enthalpy",
-    //! the name of a homogeneous phase species, or the name of a surface
-    //! species.
+    //! component named *nm*. Possible values for *nm* are "mass", "enthalpy"
+    //! (or "temperature", if temperatureState() is `true`), the name of a
+    //! homogeneous phase species, or the name of a surface species.
     virtual size_t componentIndex(const std::string& nm) const;
+
+protected:
+    vector_fp m_hk; //!< Species partial molar enthalpies
 };
 
 }
@@ -28,6 +28,12 @@ public:
 
     virtual void setThermoMgr(ThermoPhase& thermo);
 
+    //! The temperature is always the energy state variable of this reactor.
+    virtual void setTemperatureState(bool tstate=true);
+    virtual bool temperatureState() const {
+        return true;
+    }
+
     //! @deprecated Use getState instead. To be removed after Cantera 2.3.
     virtual void getInitialConditions(doublereal t0, size_t leny,
                                       doublereal* y);
@@ -39,14 +45,38 @@ public:
 
     virtual void updateState(doublereal* y);
 
+    //! Returns `true` if chemistry is enabled and the kinetics manager is a
+    //! GasKinetics object, which provides the derivatives of the production
+    //! rates.
+    virtual bool hasChemistryJacobian() const;
+
+    //! Derivatives of the reaction terms in the species and energy equations.
+    //! The variation of the specific heat capacity with temperature is
+    //! neglected.
+    virtual void getChemistryJacobian(double* params, Array2D& jac);
+
+    //! The derivatives with respect to the reaction rate multipliers are
+    //! evaluated analytically, and the remaining ones by finite differences.
+    virtual void evalParameterAdjoint(double t, double* y, double* params,
+                                      const double* lambda, double* out);
+
+    virtual bool hasPreconditioner() const;
+    virtual void getPreconditionerPattern(
+        std::vector<std::vector<size_t>>& rows);
+
+    //! Sparse approximation to the reaction terms of getChemistryJacobian().
+    //! The derivatives with respect to the concentrations of collision
+    //! partners, and those due to the dependence of the density on the mean
+    //! molecular weight, are neglected.
+    virtual void evalPreconditioner(double* params, SparseMatrix& jac,
+                                    size_t start);
+
     //! Return the index in the solution vector for this reactor of the
     //! component named *nm*. Possible values for *nm* are "mass",
     //! "temperature", the name of a homogeneous phase species, or the name of a
     //! surface species.
     virtual size_t componentIndex(const std::string& nm) const;
 
-protected:
-    vector_fp m_hk; //!< Species molar enthalpies
 };
 }
 
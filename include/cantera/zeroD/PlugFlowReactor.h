@@ -0,0 +1,231 @@
+//! @file PlugFlowReactor.h
+
+#ifndef CT_PLUGFLOWREACTOR_H
+#define CT_PLUGFLOWREACTOR_H
+
+#include "cantera/numerics/ResidJacEval.h"
+#include "cantera/numerics/Func1.h"
+
+namespace Cantera
+{
+
+class ThermoPhase;
+class Kinetics;
+class InterfaceKinetics;
+class SurfPhase;
+class IDA_Solver;
+
+//! Steady, one-dimensional flow of an ideal gas through a duct of variable
+//! cross-sectional area, with gas-phase and surface reactions, integrated in
+//! the axial distance as a system of differential-algebraic equations.
+/*!
+ * The solution vector at each axial position *z* is [*u*, *rho*, *P*, *T*,
+ * *Y_1*, ..., *Y_K*, *theta*], where *u* is the axial velocity and *theta*
+ * are the coverages of the species on each of the surfaces added with
+ * addSurface(). The governing equations are
+ *
+ * \f[
+ *     u \rho' + \rho u' + \rho u A'/A = \dot{m}_s
+ * \f]
+ * \f[
+ *     \rho u u' + P' = -u \dot{m}_s
+ * \f]
+ * \f[
+ *     \rho u c_p T' = -\sum_k \bar{h}_k \dot{\omega}_k
+ * \f]
+ * \f[
+ *     \rho u Y_k' = W_k (\dot{\omega}_k + \dot{s}_k) - Y_k \dot{m}_s
+ * \f]
+ *
+ * where \f$ \dot{s}_k \f$ is the production rate of gas species *k* by all
+ * surfaces per unit volume, and \f$ \dot{m}_s = \sum_k W_k \dot{s}_k \f$.
+ * The equation of state is included in differentiated form, so that all of
+ * the gas-phase variables are differential. The coverages of the surface
+ * species are algebraic variables, determined by the condition that the
+ * net production rates of the surface species are zero.
+ *
+ * The solution is found using IDA_Solver. The state of the ThermoPhase
+ * object (and of the surface phases) is set to the local state of the
+ * reactor at each output station. Instead of storing the solution, solve()
+ * calls a user-provided function at each station, so that long reactors can
+ * be computed with fine output in constant memory.
+ *
+ * @ingroup ZeroD
+ */
+class PlugFlowReactor : public ResidJacEval
+{
+public:
+    //! Create a reactor for the gas *thermo* with reactions given by *kin*.
+    //! The inlet state is the state of *thermo* when initialize() is called.
+    PlugFlowReactor(ThermoPhase& thermo, Kinetics& kin);
+    virtual ~PlugFlowReactor();
+    PlugFlowReactor(const PlugFlowReactor&) = delete;
+    PlugFlowReactor& operator=(const PlugFlowReactor&) = delete;
+
+    //! Add reactions on a surface, whose area per unit volume of the reactor
+    //! is *areaToVolume* [1/m]. The first phase of *kin* must be the gas
+    //! phase of this reactor. The initial coverages are used as the initial
+    //! guess for the coverages at the inlet.
+    void addSurface(InterfaceKinetics& kin, double areaToVolume);
+
+    //! Number of surfaces added with addSurface()
+    size_t nSurfaces() const {
+        return m_surfaces.size();
+    }
+
+    //! Set the mass flow rate through the reactor [kg/s]
+    void setMassFlowRate(double mdot);
+
+    //! Set a constant cross-sectional area [m^2]. The default is 1.0.
+    void setArea(double area);
+
+    //! Set the cross-sectional area [m^2] as a function of the axial
+    //! distance [m]. The function is not owned by the reactor and must
+    //! remain valid while the reactor is used.
+    void setArea(Func1& area);
+
+    //! Cross-sectional area [m^2] at the axial position *z* [m]
+    double area(double z) const;
+
+    //! Enable or disable the solution of the energy equation. If disabled,
+    //! the temperature is held at its inlet value.
+    void setEnergy(bool energy) {
+        m_energy = energy;
+        m_init = false;
+    }
+
+    //! Returns `true` if the energy equation is solved
+    bool energyEnabled() const {
+        return m_energy;
+    }
+
+    //! Set the relative and absolute tolerances of the integrator. The
+    //! absolute tolerance applies to the mass fractions and coverages, and is
+    //! scaled by the inlet values for the other variables.
+    void setTolerances(double rtol, double atol);
+
+    //! Relative tolerance of the integrator
+    double rtol() const {
+        return m_rtol;
+    }
+
+    //! Absolute tolerance of the integrator
+    double atol() const {
+        return m_atol;
+    }
+
+    //! Set the function called by solve() at each output station. The
+    //! function is called with the axial distance [m] as its argument, while
+    //! the states of the phases are set to the local state of the reactor.
+    //! Its return value is ignored. The function is not owned by the reactor.
+    void setOutputCallback(Func1* callback) {
+        m_callback = callback;
+    }
+
+    //! Set up the integrator, starting from the current state of the phases
+    //! at the axial position *z0*. The coverages are initialized by solving
+    //! for their steady state values. Called automatically by advance() and
+    //! solve() if necessary.
+    void initialize(double z0=0.0);
+
+    //! Integrate to the axial position *z* [m], and set the states of the
+    //! phases to the solution there.
+    void advance(double z);
+
+    //! Integrate from the current position to the axial position *length*
+    //! [m], calling the output callback (see setOutputCallback()) at the
+    //! current position and at every multiple of *dz* [m] from there up to
+    //! *length*. No part of the solution is stored.
+    void solve(double length, double dz);
+
+    //! Current axial position [m]
+    double distance() const {
+        return m_z;
+    }
+
+    //! Axial velocity at the current position [m/s]
+    double velocity() const {
+        return m_y[0];
+    }
+
+    //! Mass flow rate at the current position [kg/s]. May differ from the
+    //! inlet value due to surface reactions.
+    double massFlowRate() const {
+        return m_y[0] * m_y[1] * area(m_z);
+    }
+
+    //! Get the coverages of the species of surface *n* at the current
+    //! position.
+    void getCoverages(size_t n, double* theta) const;
+
+    // overloaded methods of class ResidJacEval
+    virtual int evalResidNJ(const doublereal t, const doublereal delta_t,
+                            const doublereal* const y,
+                            const doublereal* const ydot,
+                            doublereal* const resid,
+                            const ResidEval_Type_Enum evalType = Base_ResidEval,
+                            const int id_x = -1,
+                            const doublereal delta_x = 0.0);
+
+    virtual int getInitialConditions(const doublereal t0, doublereal* const y,
+                                     doublereal* const ydot);
+
+protected:
+    //! Surface reactions added with addSurface()
+    struct Surface {
+        InterfaceKinetics* kin;
+        SurfPhase* phase;
+        double areaToVolume;
+        size_t start; //!< offset of the coverages in the solution vector
+        size_t kinStart; //!< offset of the surface species in *kin*
+    };
+
+    //! Set the states of the phases to the solution vector *y* at position
+    //! *z*.
+    void updateState(double z, const double* y);
+
+    //! Evaluate the production rates of the gas phase species per unit volume
+    //! due to surface reactions (#m_sdot), and return their total mass
+    //! production rate per unit volume, after calling updateState() for the
+    //! solution vector *y*. If *resid* is not NULL, also evaluate the
+    //! residuals of the coverage equations.
+    double evalSurfaces(const double* y, double* resid);
+
+    //! Derivative of the cross-sectional area at position *z*
+    double dAdz(double z) const;
+
+    //! Rethrow an exception from a residual evaluation, if any, after an
+    //! error in the integrator.
+    void checkResidError();
+
+    ThermoPhase* m_thermo;
+    Kinetics* m_kin;
+    std::vector<Surface> m_surfaces;
+    std::unique_ptr<IDA_Solver> m_solver;
+    Func1* m_area;
+    Func1* m_callback;
+
+    size_t m_nsp;
+    double m_mdot;
+    double m_areaConst;
+    bool m_energy;
+    bool m_init;
+    double m_rtol, m_atol;
+
+    //! Current position and solution
+    double m_z;
+    vector_fp m_y;
+
+    vector_fp m_wdot; //!< gas phase net production rates [kmol/m^3/s]
+    vector_fp m_sdot; //!< surface production rates of gas species [kmol/m^3/s]
+    vector_fp m_hk; //!< partial molar enthalpies
+    vector_fp m_work; //!< production rates of the species of one surface
+
+    //! Exception thrown by evalResidNJ(), which can't be propagated through
+    //! the integrator
+    std::exception_ptr m_residError;
+};
+
+}
+
+#endif
@@ -7,6 +7,8 @@
 
 #include "ReactorBase.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/base/Array.h"
+#include "cantera/numerics/SparseMatrix.h"
 
 namespace Cantera
 {
@@ -61,9 +63,19 @@ public:
         }
     }
 
+    //! Return a reference to the Kinetics object of the reactor
+    Kinetics& kinetics() {
+        if (!m_kin) {
+            throw CanteraError("Reactor::kinetics", "Kinetics manager not "
+                               "set for reactor '{}'.", m_name);
+        }
+        return *m_kin;
+    }
+
     //! Disable changes in reactor composition due to chemical reactions.
     void disableChemistry() {
         m_chem = false;
+        std::fill(m_wdot.begin(), m_wdot.end(), 0.0);
     }
 
     //! Enable changes in reactor composition due to chemical reactions.
@@ -71,6 +83,31 @@ public:
         m_chem = true;
     }
 
+    //! Returns `true` if changes in reactor composition due to chemical
+    //! reactions are enabled.
+    bool chemistryEnabled() const {
+        return m_chem;
+    }
+
+    //! Disable the terms due to walls, inlets and outlets, which couple the
+    //! reactor to its surroundings, leaving only the reaction terms. Used by
+    //! ReactorNet to integrate the reaction terms of each reactor separately
+    //! (see ReactorNet::setSplitting()).
+    void disableCoupling() {
+        m_coupled = false;
+    }
+
+    //! Enable the terms due to walls, inlets and outlets.
+    void enableCoupling() {
+        m_coupled = true;
+    }
+
+    //! Returns `true` if the terms due to walls, inlets and outlets are
+    //! enabled.
+    bool couplingEnabled() const {
+        return m_coupled;
+    }
+
     //! Set the energy equation on or off.
     void setEnergy(int eflag = 1) {
         if (eflag > 0) {
@@ -85,6 +122,29 @@ public:
         return m_energy;
     }
 
+    //! Use the temperature as the energy state variable, instead of the total
+    //! internal energy (or the total enthalpy, for ConstPressureReactor).
+    /*!
+     * With the temperature as a state variable, setting the state of the
+     * reactor does not require an iterative solution for the temperature,
+     * which is done for every evaluation of the governing equations. Instead,
+     * the rate of change of the temperature is found from the energy
+     * equation using the partial molar internal energies (or enthalpies) and
+     * volumes of the species, and the thermal expansion coefficient and
+     * isothermal compressibility of the phase, which must be implemented by
+     * the ThermoPhase object. The energy is then conserved to within the
+     * integrator tolerances rather than exactly; the default formulation
+     * should be used where exact conservation matters. The ideal gas
+     * reactors always use this formulation.
+     */
+    virtual void setTemperatureState(bool tstate=true);
+
+    //! Returns `true` if the temperature is the energy state variable. See
+    //! setTemperatureState().
+    virtual bool temperatureState() const {
+        return m_tempState;
+    }
+
     //! Number of equations (state variables) for this reactor
     virtual size_t neq() {
         return m_nv;
@@ -120,6 +180,69 @@ public:
     virtual void evalEqs(doublereal t, doublereal* y,
                          doublereal* ydot, doublereal* params);
 
+    //! Returns `true` if getChemistryJacobian() is implemented for this
+    //! reactor and its current contents.
+    virtual bool hasChemistryJacobian() const {
+        return false;
+    }
+
+    //! Evaluate the derivatives of the terms of the governing equations which
+    //! are due to reactions in the homogeneous phase, with respect to the
+    //! state variables of this reactor. Called by ReactorNet after
+    //! updateState().
+    /*!
+     * Together with a finite difference Jacobian of the governing equations
+     * with chemistry disabled, this gives the full Jacobian of the reactor
+     * equations at a fraction of the cost of perturbing the reaction rates
+     * for each state variable.
+     *
+     * @param[in] params sensitivity parameter vector, length ReactorNet::nparams()
+     * @param[out] jac  Matrix of size neq() by neq(), where element (*i*, *j*)
+     *     is the derivative of the reaction terms in equation *i* with respect
+     *     to state variable *j*.
+     */
+    virtual void getChemistryJacobian(double* params, Array2D& jac) {
+        throw NotImplementedError("Reactor::getChemistryJacobian");
+    }
+
+    //! Returns `true` if this reactor provides the approximate Jacobian given
+    //! by evalPreconditioner(), which ReactorNet uses instead of finite
+    //! differences with the "GMRES" linear solver.
+    virtual bool hasPreconditioner() const {
+        return false;
+    }
+
+    //! Sparsity pattern of the matrix computed by evalPreconditioner().
+    /*!
+     * @param[out] rows  For each state variable *i* of this reactor, the
+     *     state variables *j* of this reactor for which element (*i*, *j*)
+     *     may be nonzero. Length neq().
+     */
+    virtual void getPreconditionerPattern(
+        std::vector<std::vector<size_t>>& rows) {
+        throw NotImplementedError("Reactor::getPreconditionerPattern");
+    }
+
+    //! Evaluate a sparse approximation to the Jacobian of the governing
+    //! equations of this reactor, for use as a preconditioner. Called by
+    //! ReactorNet after updateState().
+    /*!
+     * The approximation only needs to capture the stiff part of the
+     * equations, which is usually due to the reaction terms. Couplings to
+     * other reactors are neglected.
+     *
+     * @param[in] params sensitivity parameter vector, length ReactorNet::nparams()
+     * @param[in,out] jac  Jacobian of the reactor network. The derivatives are
+     *     added to the elements in rows and columns *start* to *start* +
+     *     neq(), which include the pattern given by getPreconditionerPattern().
+     * @param[in] start  Offset of the state variables of this reactor in the
+     *     state vector of the reactor network
+     */
+    virtual void evalPreconditioner(double* params, SparseMatrix& jac,
+                                    size_t start) {
+        throw NotImplementedError("Reactor::evalPreconditioner");
+    }
+
     virtual void syncState();
 
     //! Set the state of the reactor to correspond to the state vector *y*.
@@ -133,6 +256,34 @@ public:
     //! (in the homogeneous phase).
     virtual void addSensitivityReaction(size_t rxn);
 
+    //! Add a sensitivity parameter associated with the enthalpy of formation
+    //! of species *k* (in the homogeneous phase).
+    /*!
+     * Like the reaction parameters, the parameter has a nominal value of 1.
+     * Since the enthalpy of formation may be zero, the parameter is additive:
+     * a change of the parameter by 1 changes the enthalpy of formation by
+     * \f$ R T_0 \f$, where \f$ T_0 \f$ = 298.15 K. The equilibrium constants
+     * of the reactions are changed accordingly.
+     */
+    virtual void addSensitivitySpeciesEnthalpy(size_t k);
+
+    //! Evaluate the product of the transposed derivatives of the governing
+    //! equations with respect to the sensitivity parameters of this reactor
+    //! with the vector *lambda*. Used by ReactorNet for adjoint sensitivity
+    //! analysis. Called after updateState().
+    /*!
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] params sensitivity parameter vector, length nSensParams()
+     * @param[in] lambda adjoint variables, length neq()
+     * @param[out] out \f$ \sum_i \lambda_i \partial \dot{y}_i / \partial p_j
+     *     \f$ for each parameter *j*, length nSensParams()
+     *
+     * The default implementation uses finite differences of evalEqs().
+     */
+    virtual void evalParameterAdjoint(double t, double* y, double* params,
+                                      const double* lambda, double* out);
+
     //! Return a vector specifying the ordering of objects to use when
     //! determining sensitivity parameter indices.
     /*!
@@ -148,8 +299,8 @@ public:
 
     //! Return the index in the solution vector for this reactor of the
     //! component named *nm*. Possible values for *nm* are "mass", "volume",
-    //! "int_energy", the name of a homogeneous phase species, or the name of a
-    //! surface species.
+    //! "int_energy" (or "temperature", if temperatureState() is `true`), the
+    //! name of a homogeneous phase species, or the name of a surface species.
     virtual size_t componentIndex(const std::string& nm) const;
 
 protected:
@@ -159,6 +310,18 @@ protected:
     //! Reset the reaction rate multipliers
     virtual void resetSensitivity(double* params);
 
+    //! Evaluate the part of evalParameterAdjoint() for the sensitivity
+    //! parameters with indices *start* and higher by finite differences of
+    //! evalEqs().
+    void evalParameterAdjointFD(double t, double* y, double* params,
+                                const double* lambda, double* out,
+                                size_t start);
+
+    //! Evaluate the part of evalParameterAdjoint() for the reaction
+    //! parameters, given the derivatives *a* of \f$ \sum_i \lambda_i
+    //! \dot{y}_i \f$ with respect to the net production rates of the species.
+    void getReactionAdjoint(double* params, const double* a, double* out);
+
     //! Return the index in the solution vector for this reactor of the species
     //! named *nm*, in either the homogeneous phase or a surface phase, relative
     //! to the start of the species terms. Used to implement componentIndex for
@@ -195,15 +358,43 @@ protected:
     vector_fp m_sdot;
 
     vector_fp m_wdot; //!< Species net molar production rates
+
+    //! Derivatives of the species net production rates with respect to the
+    //! species concentrations, used by getChemistryJacobian()
+    vector_fp m_dwdot_dC;
+
+    //! Derivatives of the species net production rates with respect to
+    //! temperature, used by getChemistryJacobian()
+    vector_fp m_dwdot_dT;
+
+    //! Sparse derivatives of the species net production rates with respect to
+    //! the species concentrations, used by evalPreconditioner()
+    SparseMatrix m_dwdot_dC_sparse;
+
     vector_fp m_uk; //!< Species molar internal energies
+    vector_fp m_vk; //!< Species partial molar volumes
     bool m_chem;
+    bool m_coupled; //!< see disableCoupling()
     bool m_energy;
+
+    //! `true` if the temperature is the energy state variable. See
+    //! setTemperatureState().
+    bool m_tempState;
     size_t m_nv;
 
     size_t m_nsens;
     std::vector<size_t> m_pnum;
     std::vector<size_t> m_nsens_wall;
     vector_fp m_mult_save;
+
+    //! Species whose enthalpies of formation are sensitivity parameters
+    std::vector<size_t> m_sensSpecies;
+
+    //! Nominal enthalpies of formation of the species in #m_sensSpecies
+    vector_fp m_hf298_save;
+
+    //! Work arrays used by evalParameterAdjoint()
+    vector_fp m_adjYdot, m_adjParams;
 };
 }
 
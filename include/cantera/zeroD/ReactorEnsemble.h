@@ -0,0 +1,224 @@
+//! @file ReactorEnsemble.h
+
+#ifndef CT_REACTORENSEMBLE_H
+#define CT_REACTORENSEMBLE_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <atomic>
+
+namespace Cantera
+{
+
+class XML_Node;
+
+//! Integrate many independent reactors, differing only in their initial
+//! states, in parallel.
+/*!
+ * This class is intended for parameter sweeps such as the calculation of
+ * tables of ignition delay times. Each case consists of a single reactor of
+ * the type set by setReactorType(), containing the phase from the input file
+ * with the initial temperature, pressure and composition given by
+ * setInitialStates(). Each case is integrated from time zero to the end time
+ * set by setEndTime().
+ *
+ * The cases are distributed over a number of worker threads. Each thread
+ * creates its own ThermoPhase, Kinetics, Reactor and ReactorNet objects once,
+ * from the XML tree of the phase which is parsed once and shared by all of
+ * the threads, and reuses them (including the integrator) for each of the
+ * cases it processes.
+ *
+ * The results are stored in contiguous arrays. The state of the reactor is
+ * represented by the vector [*T*, *P*, *Y_1*, ..., *Y_K*] of length
+ * stateSize().
+ *
+ * @ingroup ZeroD
+ */
+class ReactorEnsemble
+{
+public:
+    //! Create an ensemble for the phase *phaseid* in the file *infile*. If
+    //! *phaseid* is empty, the first phase in the file is used.
+    ReactorEnsemble(const std::string& infile, const std::string& phaseid="");
+
+    //! Set the type of reactor used for each case, e.g. "IdealGasReactor"
+    //! (the default) or "IdealGasConstPressureReactor".
+    void setReactorType(const std::string& type);
+
+    //! The type of reactor used for each case
+    const std::string& reactorType() const {
+        return m_reactorType;
+    }
+
+    //! Set the time at which each integration ends [s]
+    void setEndTime(double tend);
+
+    //! The time at which each integration ends [s]
+    double endTime() const {
+        return m_tend;
+    }
+
+    //! Set the relative and absolute tolerances for the integrator. Negative
+    //! values leave the corresponding tolerance unchanged.
+    void setTolerances(double rtol, double atol);
+
+    //! Relative tolerance of the integrator
+    double rtol() const {
+        return m_rtol;
+    }
+
+    //! Absolute tolerance of the integrator
+    double atol() const {
+        return m_atol;
+    }
+
+    //! Set the maximum time step of the integrator. Zero means no limit.
+    void setMaxTimeStep(double maxstep) {
+        m_maxstep = maxstep;
+    }
+
+    //! Set the criterion used to determine the ignition delay time.
+    /*!
+     * - "temperature-rise": The time at which the temperature first exceeds
+     *   the initial temperature by *value* [K]. Interpolated linearly
+     *   between the time steps of the integrator.
+     * - "max-dTdt": The time at which the rate of change of the temperature
+     *   is largest.
+     * - "max-species": The time at which the mole fraction of the species
+     *   named *species* is largest.
+     *
+     * If the criterion is not met, the ignition delay is NaN.
+     */
+    void setIgnitionCriterion(const std::string& type, double value=400.0,
+                              const std::string& species="");
+
+    //! Set the times at which the state of each reactor is saved. The times
+    //! must be increasing and no later than the end time. Pass an empty
+    //! vector (the default) to disable the saving of the time histories.
+    void setOutputTimes(const vector_fp& times);
+
+    //! The times at which the state of each reactor is saved
+    const vector_fp& outputTimes() const {
+        return m_outputTimes;
+    }
+
+    //! Set the number of worker threads. Zero (the default) means the number
+    //! of hardware threads.
+    void setNumThreads(size_t n) {
+        m_nthreads = n;
+    }
+
+    //! The number of worker threads. Zero means the number of hardware
+    //! threads.
+    size_t numThreads() const {
+        return m_nthreads;
+    }
+
+    //! Number of species in the phase
+    size_t nSpecies() const {
+        return m_nsp;
+    }
+
+    //! Length of the state vector of each reactor, [*T*, *P*, *Y*]
+    size_t stateSize() const {
+        return m_nsp + 2;
+    }
+
+    //! Set the initial states of the cases, discarding the results of any
+    //! previous calculation.
+    /*!
+     * @param n  Number of cases
+     * @param T  Initial temperatures [K]. Length *n*.
+     * @param P  Initial pressures [Pa]. Length *n*.
+     * @param X  Initial mole fractions. Array of size *n* by nSpecies(), with
+     *     the mole fractions for each case stored contiguously.
+     */
+    void setInitialStates(size_t n, const double* T, const double* P,
+                          const double* X);
+
+    //! Number of cases
+    size_t nCases() const {
+        return m_T0.size();
+    }
+
+    //! Integrate all of the cases. Cases for which the integration fails have
+    //! NaN results and an error message given by errorMessage().
+    void solve();
+
+    //! Ignition delay time of each case [s]. Length nCases().
+    const vector_fp& ignitionDelays() const {
+        return m_ignitionDelays;
+    }
+
+    //! State of each reactor at the end time. Array of size nCases() by
+    //! stateSize().
+    const vector_fp& finalStates() const {
+        return m_finalStates;
+    }
+
+    //! State of each reactor at each of the output times. Array of size
+    //! nCases() by outputTimes().size() by stateSize().
+    const vector_fp& histories() const {
+        return m_histories;
+    }
+
+    //! The error message for case *i*, or an empty string if the integration
+    //! succeeded.
+    const std::string& errorMessage(size_t i) const {
+        return m_errors.at(i);
+    }
+
+    //! Number of cases for which the integration failed
+    size_t nFailures() const;
+
+protected:
+    //! Types of ignition criteria. See setIgnitionCriterion().
+    enum IgnitionCriterion {
+        TemperatureRise, MaxTemperatureSlope, MaxSpecies
+    };
+
+    //! Process cases, taking the next unprocessed case from #m_next until
+    //! all of the cases are done. Run by each worker thread.
+    void runWorker();
+
+    //! Phase definition shared by all of the worker threads
+    XML_Node* m_phaseNode;
+
+    std::string m_reactorType;
+    double m_tend;
+    double m_rtol;
+    double m_atol;
+    double m_maxstep;
+
+    IgnitionCriterion m_criterion;
+    double m_criterionValue;
+    size_t m_criterionSpecies;
+
+    vector_fp m_outputTimes;
+    size_t m_nthreads;
+    size_t m_nsp;
+
+    //! Names of the species in the phase
+    std::vector<std::string> m_speciesNames;
+
+    //! Initial temperatures
+    vector_fp m_T0;
+
+    //! Initial pressures
+    vector_fp m_P0;
+
+    //! Initial mole fractions
+    vector_fp m_X0;
+
+    vector_fp m_ignitionDelays;
+    vector_fp m_finalStates;
+    vector_fp m_histories;
+    std::vector<std::string> m_errors;
+
+    //! Index of the next case to be processed by a worker thread
+    std::atomic<size_t> m_next;
+};
+
+}
+
+#endif
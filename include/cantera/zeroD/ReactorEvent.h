@@ -0,0 +1,220 @@
+//! @file ReactorEvent.h
+
+#ifndef CT_REACTOREVENT_H
+#define CT_REACTOREVENT_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/numerics/Func1.h"
+
+namespace Cantera
+{
+
+class Reactor;
+
+//! An event during the integration of a ReactorNet, which occurs at the zeros
+//! of an event function of the state of the network.
+/*!
+ * The zeros of the event functions of all of the events added to a
+ * ReactorNet (see ReactorNet::addEvent()) are located by the root finding
+ * capability of the integrator while integrating the network. If the event
+ * is *terminal*, ReactorNet::advance() stops at the time of the event.
+ *
+ * Most events depend on a single component of the state vector of one of
+ * the reactors in the network, given by the reactor and the name of the
+ * component (see Reactor::componentIndex()). New types of events can be
+ * defined by overriding eval().
+ *
+ * @ingroup ZeroD
+ */
+class ReactorEvent
+{
+public:
+    //! @param reactor  Reactor whose state is used by the event function
+    //! @param component  Name of the component of the state of *reactor* used
+    //!     by the event function, or an empty string if the event does not
+    //!     depend on a single component
+    ReactorEvent(Reactor& reactor, const std::string& component="") :
+        m_reactor(&reactor),
+        m_component(component),
+        m_index(npos),
+        m_direction(0),
+        m_terminal(true)
+    {
+    }
+
+    virtual ~ReactorEvent() {}
+    ReactorEvent(const ReactorEvent&) = delete;
+    ReactorEvent& operator=(const ReactorEvent&) = delete;
+
+    //! Evaluate the event function.
+    /*!
+     * @param t  time [s]
+     * @param y  state vector of the reactor network
+     * @param ydot  time derivative of the state vector
+     * @param ydot2  second time derivative of the state vector. Only
+     *     calculated if needsSecondDerivatives() returns `true`.
+     */
+    virtual double eval(double t, const double* y, const double* ydot,
+                        const double* ydot2) = 0;
+
+    //! Returns `true` if eval() uses the second time derivatives of the
+    //! state vector, which are approximated by finite differences.
+    virtual bool needsSecondDerivatives() const {
+        return false;
+    }
+
+    //! The reactor whose state is used by the event function
+    Reactor& reactor() {
+        return *m_reactor;
+    }
+
+    //! The name of the component of the reactor state used by the event
+    //! function
+    const std::string& component() const {
+        return m_component;
+    }
+
+    //! Index of the component in the state vector of the reactor network.
+    //! Set by ReactorNet when it is initialized.
+    size_t stateIndex() const {
+        return m_index;
+    }
+
+    void setStateIndex(size_t index) {
+        m_index = index;
+    }
+
+    //! Direction of the zero crossings of the event function which are
+    //! located: 1 if the event function is increasing, -1 if it is
+    //! decreasing, or 0 for both.
+    int direction() const {
+        return m_direction;
+    }
+
+    void setDirection(int direction) {
+        m_direction = (direction > 0) - (direction < 0);
+    }
+
+    //! Returns `true` if the integration stops when the event occurs
+    bool terminal() const {
+        return m_terminal;
+    }
+
+    void setTerminal(bool terminal) {
+        m_terminal = terminal;
+    }
+
+    //! Times at which the event has occurred since the reactor network was
+    //! last initialized
+    const vector_fp& times() const {
+        return m_times;
+    }
+
+    //! Record that the event has occurred at time *t*. Called by ReactorNet.
+    void addTime(double t) {
+        m_times.push_back(t);
+    }
+
+    //! Clear the list of times at which the event has occurred. Called by
+    //! ReactorNet.
+    void clearTimes() {
+        m_times.clear();
+    }
+
+protected:
+    Reactor* m_reactor;
+    std::string m_component;
+    size_t m_index;
+    int m_direction;
+    bool m_terminal;
+    vector_fp m_times;
+};
+
+//! An event which occurs when a component of the state crosses a threshold,
+//! e.g. when the temperature exceeds a specified value. By default, only
+//! increasing crossings are detected.
+class ThresholdEvent : public ReactorEvent
+{
+public:
+    ThresholdEvent(Reactor& reactor, const std::string& component,
+                   double threshold) :
+        ReactorEvent(reactor, component),
+        m_threshold(threshold)
+    {
+        m_direction = 1;
+    }
+
+    virtual double eval(double t, const double* y, const double* ydot,
+                        const double* ydot2) {
+        return y[m_index] - m_threshold;
+    }
+
+    double threshold() const {
+        return m_threshold;
+    }
+
+protected:
+    double m_threshold;
+};
+
+//! An event which occurs at each local maximum of a component of the state,
+//! e.g. the peak of the mass fraction of a radical species.
+class PeakEvent : public ReactorEvent
+{
+public:
+    PeakEvent(Reactor& reactor, const std::string& component) :
+        ReactorEvent(reactor, component)
+    {
+        m_direction = -1;
+    }
+
+    virtual double eval(double t, const double* y, const double* ydot,
+                        const double* ydot2) {
+        return ydot[m_index];
+    }
+};
+
+//! An event which occurs at each local maximum of the rate of change of a
+//! component of the state, e.g. the maximum of dT/dt.
+class MaxRateEvent : public ReactorEvent
+{
+public:
+    MaxRateEvent(Reactor& reactor, const std::string& component) :
+        ReactorEvent(reactor, component)
+    {
+        m_direction = -1;
+    }
+
+    virtual double eval(double t, const double* y, const double* ydot,
+                        const double* ydot2) {
+        return ydot2[m_index];
+    }
+
+    virtual bool needsSecondDerivatives() const {
+        return true;
+    }
+};
+
+//! An event which occurs at the zeros of a user-defined function of a
+//! component of the state.
+class Func1Event : public ReactorEvent
+{
+public:
+    Func1Event(Func1& func, Reactor& reactor, const std::string& component) :
+        ReactorEvent(reactor, component),
+        m_func(&func)
+    {
+    }
+
+    virtual double eval(double t, const double* y, const double* ydot,
+                        const double* ydot2) {
+        return m_func->eval(y[m_index]);
+    }
+
+protected:
+    Func1* m_func;
+};
+
+}
+
+#endif
@@ -6,6 +6,7 @@
 #define CT_REACTORNET_H
 
 #include "Reactor.h"
+#include "ReactorEvent.h"
 #include "cantera/numerics/FuncEval.h"
 #include "cantera/numerics/Integrator.h"
 #include "cantera/base/Array.h"
@@ -13,6 +14,8 @@
 namespace Cantera
 {
 
+class ReactorChemistry;
+
 //! A class representing a network of connected reactors.
 /*!
  *  This class is used to integrate the time-dependent governing equations for
@@ -48,6 +51,167 @@ public:
         m_init = false;
     }
 
+    //! Set the type of linear solver used by the integrator.
+    /*!
+     * - "DENSE": Dense LU factorization of a Jacobian obtained by finite
+     *   differences within the integrator (the default).
+     * - "SPARSE": Sparse LU factorization of a Jacobian whose sparsity
+     *   pattern follows from the connections between the reactors. Reactors
+     *   only depend on reactors which they share a Wall or FlowDevice with, so
+     *   the cost of each Jacobian evaluation is independent of the number of
+     *   reactors in a network of chains or loops. See evalSparseJacobian().
+     * - "GMRES": Iterative solution of the linear systems with GMRES, using a
+     *   preconditioner which only includes the diagonal block of the Jacobian
+     *   for each reactor. For reactors which support it (see
+     *   Reactor::hasPreconditioner()), this block is a sparse approximation
+     *   to the reaction terms, so the cost of the preconditioner grows
+     *   roughly linearly with the size of the reaction mechanism instead of
+     *   with its cube. The blocks for the other reactors are evaluated by
+     *   finite differences.
+     */
+    void setLinearSolverType(const std::string& type);
+
+    //! The type of linear solver used by the integrator. See
+    //! setLinearSolverType().
+    const std::string& linearSolverType() const {
+        return m_linearSolverType;
+    }
+
+    //! Enable or disable the use of analytic derivatives of the reaction
+    //! terms when evaluating the Jacobian.
+    /*!
+     * For reactors which support it (see Reactor::hasChemistryJacobian()),
+     * the derivatives of the reaction terms are calculated from the
+     * derivatives of the species production rates with respect to the
+     * concentrations and temperature. Only the remaining terms, which are
+     * cheap to evaluate, are differentiated by finite differences. With the
+     * "DENSE" linear solver, the Jacobian is then passed to the integrator
+     * instead of letting it form difference quotients of the full equations.
+     */
+    void setAnalyticJacobian(bool analytic);
+
+    //! Returns `true` if analytic derivatives of the reaction terms are used
+    //! in the Jacobian. See setAnalyticJacobian().
+    bool analyticJacobian() const {
+        return m_analyticJac;
+    }
+
+    //! Enable or disable the operator-split integration of the network.
+    /*!
+     * By default, the equations of all of the reactors are integrated
+     * together by a single implicit integrator. In the operator-split mode,
+     * each time step of length *dt* (see setSplitTimeStep()) is split into
+     * three parts (Strang splitting):
+     *
+     * 1. The terms due to walls and flow devices, which couple the reactors,
+     *    are integrated over half of the step for the whole network with an
+     *    explicit, adaptive Runge-Kutta method of order 3(2), using the
+     *    tolerances set with setSplitTolerances().
+     * 2. The reaction terms are integrated over *dt* for each reactor
+     *    separately, with one implicit integrator per reactor. The reactors
+     *    are distributed over a number of threads (see setNumThreads()).
+     *    Reactors which share a ThermoPhase or Kinetics object are
+     *    integrated by the same thread, one after another.
+     * 3. The coupling terms are integrated over the second half of the
+     *    step.
+     *
+     * This is efficient for large networks where the chemistry is stiff, but
+     * the exchange between the reactors is slow. The error of the splitting
+     * is of second order in *dt*, and can be controlled by comparing some
+     * of the steps to the monolithic solution (see
+     * setSplitErrorCheckInterval()).
+     *
+     * Sensitivity parameters, events, checkpoints and surface reactions on
+     * walls are not supported in the operator-split mode.
+     */
+    void setSplitting(bool split) {
+        m_split = split;
+        m_init = false;
+    }
+
+    //! Returns `true` if the operator-split mode is enabled. See
+    //! setSplitting().
+    bool splitting() const {
+        return m_split;
+    }
+
+    //! Set the length of the time steps [s] in the operator-split mode. If
+    //! the error of the splitting is checked (see
+    //! setSplitErrorCheckInterval()), this is the maximum step, and the
+    //! steps are adapted to the error.
+    void setSplitTimeStep(double dt);
+
+    //! Length of the time steps in the operator-split mode. See
+    //! setSplitTimeStep().
+    double splitTimeStep() const {
+        return m_splitStep;
+    }
+
+    //! Set the relative and absolute tolerances used in the operator-split
+    //! mode, by the explicit integration of the coupling terms and to
+    //! compare the split solution to the monolithic solution. A negative
+    //! value leaves the tolerance unchanged.
+    void setSplitTolerances(double rtol, double atol) {
+        if (rtol >= 0.0) {
+            m_splitRtol = rtol;
+        }
+        if (atol >= 0.0) {
+            m_splitAtol = atol;
+        }
+    }
+
+    //! Relative tolerance in the operator-split mode
+    double splitRtol() const {
+        return m_splitRtol;
+    }
+
+    //! Absolute tolerance in the operator-split mode
+    double splitAtol() const {
+        return m_splitAtol;
+    }
+
+    //! Set the number of operator-split time steps between checks of the
+    //! error of the splitting, or zero (the default) to disable the checks.
+    /*!
+     * For the steps which are checked, the network is also integrated over
+     * the same step with the monolithic integrator, and the difference
+     * between the two solutions is measured with the tolerances set with
+     * setSplitTolerances() (see splitError()). If the error is too large,
+     * the step is repeated with a smaller time step. Otherwise, the
+     * monolithic solution is kept, and the time step used for the following
+     * steps is adapted to the error.
+     */
+    void setSplitErrorCheckInterval(size_t n) {
+        m_splitCheckInterval = n;
+    }
+
+    //! Number of steps between the checks of the splitting error. See
+    //! setSplitErrorCheckInterval().
+    size_t splitErrorCheckInterval() const {
+        return m_splitCheckInterval;
+    }
+
+    //! The weighted root-mean-square difference between the split and the
+    //! monolithic solutions found at the last check of the splitting error,
+    //! or NaN if the error hasn't been checked. Values less than 1 are
+    //! within the tolerances.
+    double splitError() const {
+        return m_splitError;
+    }
+
+    //! Set the number of threads used to integrate the reaction terms in the
+    //! operator-split mode. Zero (the default) means the number of hardware
+    //! threads.
+    void setNumThreads(size_t n) {
+        m_nthreads = n;
+    }
+
+    //! Number of threads used in the operator-split mode. See
+    //! setNumThreads().
+    size_t numThreads() const {
+        return m_nthreads;
+    }
+
     //! Set the relative and absolute tolerances for the integrator.
     void setTolerances(doublereal rtol, doublereal atol) {
         if (rtol >= 0.0) {
@@ -98,7 +262,9 @@ public:
 
     /**
      * Advance the state of all reactors in time. Take as many internal
-     * timesteps as necessary to reach *time*.
+     * timesteps as necessary to reach *time*. If a terminal event (see
+     * addEvent()) occurs first, the integration stops at the time of the
+     * event, which is given by time() and lastEvent().
      * @param time Time to advance to (s).
      */
     void advance(doublereal time);
@@ -113,6 +279,27 @@ public:
     //! Add the reactor *r* to this reactor network.
     void addReactor(Reactor& r);
 
+    //! Add an event whose occurrence is located while integrating this
+    //! network. The event is not owned by the network, and must remain valid
+    //! while the network is used.
+    void addEvent(ReactorEvent& event);
+
+    //! Number of events added to this network
+    size_t nEvents() const {
+        return m_events.size();
+    }
+
+    //! Return a reference to the *n*-th event added to this network
+    ReactorEvent& event(size_t n) {
+        return *m_events.at(n);
+    }
+
+    //! Index of the terminal event which stopped the last call to advance()
+    //! or step(), or #npos if no terminal event occurred.
+    size_t lastEvent() const {
+        return m_lastEvent;
+    }
+
     //! Return a reference to the *n*-th reactor in this network. The reactor
     //! indices are determined by the order in which the reactors were added
     //! to the reactor network.
@@ -131,6 +318,44 @@ public:
         m_verbose = v;
     }
 
+    //! Save the state of the network as a binary string, which can be used
+    //! to resume the integration from the current time with
+    //! restoreCheckpoint().
+    /*!
+     * The checkpoint includes the solution and sensitivities, the state of
+     * the integrator (see Integrator::saveState()) and the times of the
+     * events which have occurred so far. It does not include the
+     * configuration of the network, such as its reactors, walls and flow
+     * devices, or the thermodynamic and kinetic models, and can be restored
+     * into any network with the same structure. A network may be restored
+     * from the same checkpoint several times, e.g. to integrate several
+     * cases which differ only in their parameters from a common state.
+     */
+    std::string saveCheckpoint();
+
+    //! Restore the state of the network saved by saveCheckpoint(), and set
+    //! the states of the reactors accordingly. The network must have the same
+    //! number of state variables, sensitivity parameters and events as the
+    //! network which was saved.
+    void restoreCheckpoint(const std::string& data);
+
+    //! The current state vector of the network, without copying. The array
+    //! is owned by the integrator (or by the network in the operator-split
+    //! mode) and is updated in place by advance() and step(). Initializes
+    //! the network if necessary.
+    /*!
+     * The array may be reallocated whenever the network is initialized, so
+     * the pointer must not be used once solutionGeneration() differs from
+     * its value immediately after this call.
+     */
+    const double* solution();
+
+    //! A counter which is incremented each time the network is initialized,
+    //! which may reallocate the array returned by solution().
+    int solutionGeneration() const {
+        return m_solutionGeneration;
+    }
+
     //! Return a reference to the integrator.
     Integrator& integrator() {
         return *m_integ;
@@ -174,14 +399,48 @@ public:
 
     //! Evaluate the Jacobian matrix for the reactor network.
     /*!
+     *  The Jacobian is evaluated by finite differences. If the analytic
+     *  Jacobian is enabled (see setAnalyticJacobian()), the reaction terms
+     *  are excluded from the finite differences and their derivatives are
+     *  added using Reactor::getChemistryJacobian().
+     *
      *  @param[in] t Time at which to evaluate the Jacobian
      *  @param[in] y Global state vector at time *t*
      *  @param[out] ydot Time derivative of the state vector evaluated at *t*.
      *  @param[in] p sensitivity parameter vector (unused?)
      *  @param[out] j Jacobian matrix, size neq() by neq().
      */
-    void evalJacobian(doublereal t, doublereal* y,
-                      doublereal* ydot, doublereal* p, Array2D* j);
+    virtual void evalJacobian(doublereal t, doublereal* y,
+                              doublereal* ydot, doublereal* p, Array2D* j);
+
+    //! Sparsity pattern of the Jacobian matrix.
+    /*!
+     * The right-hand side of the equations for each reactor depends on the
+     * state of that reactor, and on the states of the reactors which share a
+     * Wall or FlowDevice with it. A reactor connected to a PressureController
+     * also depends on the reactors connected to its master flow device.
+     *
+     * With the "GMRES" linear solver, the pattern only includes the diagonal
+     * block for each reactor, given by Reactor::getPreconditionerPattern()
+     * where available.
+     */
+    virtual void getJacobianPattern(std::vector<std::vector<size_t>>& rows);
+
+    //! Evaluate the Jacobian matrix for the pattern given by
+    //! getJacobianPattern(), using finite differences.
+    /*!
+     * The reactors are grouped so that no reactor depends on more than one
+     * reactor from the same group. The n-th state variable of all of the
+     * reactors in a group is perturbed simultaneously, so the number of
+     * evaluations of the right-hand side is the number of groups times the
+     * largest number of state variables of any reactor.
+     *
+     * With the "GMRES" linear solver, the blocks of the reactors which
+     * provide a preconditioner are evaluated by Reactor::evalPreconditioner()
+     * instead.
+     */
+    virtual void evalSparseJacobian(double t, double* y, double* ydot,
+                                    double* p, SparseMatrix& jac);
 
     // overloaded methods of class FuncEval
     virtual size_t neq() {
@@ -199,6 +458,18 @@ public:
         return m_ntotpar;
     }
 
+    //! One root function for each event added with addEvent()
+    virtual size_t nRootFunctions() {
+        return m_events.size();
+    }
+
+    //! Evaluate the event functions. If any of the events need the second
+    //! time derivatives of the state, they are approximated by a forward
+    //! difference of the time derivatives along the trajectory.
+    virtual void evalRootFunctions(double t, double* y, double* g);
+
+    virtual void getRootDirections(int* directions);
+
     //! Return the index corresponding to the component named *component* in the
     //! reactor with index *reactor* in the global state vector for the
     //! reactor network.
@@ -210,6 +481,66 @@ public:
     void registerSensitivityReaction(void* reactor, size_t reactionIndex,
                                      const std::string& name, int leftright=0);
 
+    //! Add a sensitivity parameter which is a multiplier on the heat
+    //! transfer coefficient of the wall *w*. The wall must be installed next
+    //! to a reactor in this network.
+    void addSensitivityHeatTransferCoeff(Wall& w);
+
+    //! Evaluate the products of the transposed derivatives of the governing
+    //! equations with respect to the sensitivity parameters with *lambda*.
+    //! Uses Reactor::evalParameterAdjoint() for the parameters of each
+    //! reactor, and finite differences for the heat transfer coefficients.
+    virtual void evalParameterAdjoint(double t, double* y, double* p,
+                                      const double* lambda, double* out);
+
+    //! Compute the sensitivities of a scalar functional of the solution with
+    //! respect to all of the sensitivity parameters, by integrating the
+    //! adjoint equations backwards in time.
+    /*!
+     * The network is integrated from the current time with checkpointing,
+     * and the adjoint equations are then integrated back to the current
+     * time. The cost is that of about one additional integration of the
+     * network (with the Jacobian evaluated at each step of the adjoint
+     * problem), independent of the number of parameters, compared to one
+     * set of sensitivity equations per parameter for the forward
+     * sensitivities given by sensitivity(). The parameters are the ones
+     * added with Reactor::addSensitivityReaction(),
+     * Reactor::addSensitivitySpeciesEnthalpy(),
+     * Wall::addSensitivityReaction() and addSensitivityHeatTransferCoeff().
+     *
+     * The functional *G* depends on the component named *component* of the
+     * state of the reactor with index *reactor*, \f$ y_k \f$:
+     *
+     * - "final": the value of \f$ y_k \f$ at time *tend*
+     * - "integral": the integral of \f$ y_k \f$ from the current time to
+     *   *tend*
+     * - "crossing": the time from the current time until \f$ y_k \f$ first
+     *   crosses the value *threshold* (in either direction), e.g. an ignition
+     *   delay time. An error is raised if this doesn't happen before *tend*.
+     *
+     * The events added with addEvent() are not located during the
+     * integration. Afterwards, the reactors are left in their state at the
+     * end time of the functional (*tend*, or the time of the crossing), and
+     * the integration continues from there, as if the initial time had been
+     * set with setInitialTime().
+     *
+     * @param[in] type  The type of the functional
+     * @param[in] component  The component of the reactor state
+     * @param[in] tend  The end time of the integration [s]
+     * @param[out] sens  The normalized sensitivities \f$ (p_i / G) \partial G
+     *     / \partial p_i \f$, in the order in which the parameters were
+     *     added. Length nparams(). If *G* is zero (for example, the final
+     *     value of a species which is absent), these are undefined and a
+     *     CanteraError is thrown instead. The reactors are still left at
+     *     the end time of the functional.
+     * @param[in] threshold  Threshold value for the "crossing" functional
+     * @param[in] reactor  Index of the reactor
+     * @returns the value of the functional *G*
+     */
+    double solveAdjoint(const std::string& type, const std::string& component,
+                        double tend, double* sens, double threshold=0.0,
+                        size_t reactor=0);
+
     //! The name of the p-th sensitivity parameter added to this ReactorNet.
     const std::string& sensitivityParameterName(size_t p) {
         return m_paramNames.at(p);
@@ -232,11 +563,61 @@ protected:
     //! advance or step is called.
     void initialize();
 
+    //! Disable chemistry in the reactors whose reaction terms are
+    //! differentiated analytically, if the analytic Jacobian is enabled, or
+    //! which provide their own preconditioner, if the "GMRES" linear solver
+    //! is used. Returns the indices of these reactors.
+    std::vector<size_t> disableAnalyticChemistry();
+
+    //! Re-enable chemistry in the reactors returned by
+    //! disableAnalyticChemistry().
+    void enableAnalyticChemistry(const std::vector<size_t>& reactors);
+
+    //! Set the heat transfer coefficients of the walls in #m_sensWalls
+    //! based on the sensitivity parameters in *p*.
+    void applyWallSensitivity(double* p);
+
+    //! Reset the heat transfer coefficients changed by
+    //! applyWallSensitivity().
+    void resetWallSensitivity(double* p);
+
+    //! Find the reactors which each reactor depends on (#m_depends), and
+    //! group them for the evaluation of the sparse Jacobian
+    //! (#m_jacGroups).
+    void findReactorDependencies();
+
+    //! Check that the network can be integrated in the operator-split mode,
+    //! and set up the integrators for the reaction terms of the reactors.
+    void initSplitting();
+
+    //! Take one operator-split step, which ends no later than *tmax*. See
+    //! setSplitting().
+    void splitStep(double tmax);
+
+    //! Integrate the terms due to walls and flow devices over the interval
+    //! from *t* to *t* + *dt*, starting from the state #m_splitY, with an
+    //! explicit Runge-Kutta method.
+    void advanceCoupling(double t, double dt);
+
+    //! Integrate the reaction terms of each reactor over the interval from
+    //! *t* to *t* + *dt*, starting from the state #m_splitY.
+    void advanceChemistry(double t, double dt);
+
+    //! Throw an exception if the operator-split mode is enabled, naming the
+    //! unsupported method *method*.
+    void checkNotSplit(const std::string& method) const;
+
+    //! Record the times of the events located by the integrator at the
+    //! current time, and set #m_lastEvent to the first terminal event which
+    //! occurred. Returns `true` if a terminal event occurred.
+    bool handleEvents();
+
     std::vector<Reactor*> m_reactors;
     Integrator* m_integ;
     doublereal m_time;
     bool m_init;
     bool m_integrator_init; //!< True if integrator initialization is current
+    int m_solutionGeneration; //!< see solutionGeneration()
     size_t m_nv;
 
     //! m_start[n] is the starting point in the state vector for reactor n
@@ -267,6 +648,82 @@ protected:
     std::vector<size_t> m_sensIndex;
 
     vector_fp m_ydot;
+
+    //! Type of linear solver. See setLinearSolverType().
+    std::string m_linearSolverType;
+
+    //! True if the analytic Jacobian is enabled. See setAnalyticJacobian().
+    bool m_analyticJac;
+
+    //! Right-hand side without the reaction terms that are differentiated
+    //! analytically
+    vector_fp m_ydotNoChem;
+
+    //! Reaction terms of the Jacobian for a single reactor
+    Array2D m_chemJac;
+
+    //! m_depends[n] holds the sorted indices of the reactors whose states
+    //! affect the equations of reactor n, including n itself.
+    std::vector<std::vector<size_t>> m_depends;
+
+    //! Groups of reactors whose state variables are perturbed together when
+    //! evaluating the sparse Jacobian
+    std::vector<std::vector<size_t>> m_jacGroups;
+
+    //! m_hasPrecond[n] is nonzero if the preconditioner block of reactor n
+    //! is given by Reactor::evalPreconditioner(). Set by getJacobianPattern()
+    std::vector<char> m_hasPrecond;
+
+    //! Events added with addEvent()
+    std::vector<ReactorEvent*> m_events;
+
+    //! Index of the terminal event which stopped the last advance() or
+    //! step(), or npos
+    size_t m_lastEvent;
+
+    //! Work arrays used by evalRootFunctions()
+    vector_fp m_rootYdot, m_rootYdot2, m_rootY, m_rootParams;
+
+    //! Walls whose heat transfer coefficients are sensitivity parameters.
+    //! These parameters follow the parameters of the reactors.
+    std::vector<Wall*> m_sensWalls;
+
+    //! Nominal heat transfer coefficients of the walls in #m_sensWalls
+    vector_fp m_wallU;
+
+    //! Work array used by evalParameterAdjoint()
+    vector_fp m_adjYdot;
+
+    //! @name Operator-split mode
+    //! See setSplitting().
+    //@{
+
+    bool m_split; //!< `true` if the operator-split mode is enabled
+    double m_splitStep; //!< Maximum (or fixed) split time step
+    double m_splitDt; //!< Current split time step
+    double m_splitRtol, m_splitAtol;
+    size_t m_splitCheckInterval;
+    size_t m_splitSteps; //!< Number of split steps since initialization
+    double m_splitError; //!< see splitError()
+
+    //! Step size of the explicit integration of the coupling terms, which is
+    //! reused as the initial step of the next call to advanceCoupling()
+    double m_couplingStep;
+    size_t m_nthreads; //!< see setNumThreads()
+
+    //! State of the network in the operator-split mode
+    vector_fp m_splitY;
+
+    //! Integrators for the reaction terms of each reactor
+    std::vector<std::unique_ptr<ReactorChemistry>> m_chemSolvers;
+
+    //! Groups of reactors which share a ThermoPhase or Kinetics object, and
+    //! are integrated by the same thread
+    std::vector<std::vector<size_t>> m_chemGroups;
+
+    //! Work arrays used by splitStep() and advanceCoupling()
+    vector_fp m_splitY0, m_rk1, m_rk2, m_rk3, m_rk4, m_rkY, m_rkYnew;
+    //@}
 };
 }
 
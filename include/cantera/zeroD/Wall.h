@@ -186,6 +186,10 @@ public:
         }
     }
     void addSensitivityReaction(int leftright, size_t rxn);
+
+    //! Add a sensitivity parameter which is a multiplier on the heat transfer
+    //! coefficient. See ReactorNet::addSensitivityHeatTransferCoeff().
+    void addSensitivityHeatTransferCoeff();
     void setSensitivityParameters(int lr, double* params);
     void resetSensitivityParameters(int lr);
 
@@ -57,6 +57,12 @@ public:
         m_master = master;
     }
 
+    //! The flow device whose flow rate is used as the base flow rate, or
+    //! null if it has not been set
+    FlowDevice* master() const {
+        return m_master;
+    }
+
     virtual void updateMassFlowRate(doublereal time) {
         if (!ready()) {
             throw CanteraError("PressureController::updateMassFlowRate",
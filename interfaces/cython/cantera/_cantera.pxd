@@ -45,6 +45,8 @@ cdef extern from "cantera/thermo/mix_defs.h":
     cdef int thermo_type_ideal_gas "Cantera::cIdealGas"
     cdef int thermo_type_surf "Cantera::cSurf"
     cdef int thermo_type_edge "Cantera::cEdge"
+    cdef int thermo_type_mixture_fugacity "Cantera::cMixtureFugacityTP"
+    cdef int thermo_type_redlich_kwong "Cantera::cRedlichKwongMFTP"
 
     cdef int kinetics_type_gas "Cantera::cGasKinetics"
     cdef int kinetics_type_interface "Cantera::cInterfaceKinetics"
@@ -76,8 +78,8 @@ cdef extern from "cantera/thermo/SpeciesThermoInterpType.h":
         CxxSpeciesThermo()
         int reportType()
         void updatePropertiesTemp(double, double*, double*, double*) except +
-        double minTemp()
-        double maxTemp()
+        double minTemp() const
+        double maxTemp() const
         double refPressure()
         void reportParameters(size_t&, int&, double&, double&, double&, double* const) except +
 
@@ -123,6 +125,8 @@ cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
         void addUndefinedElements() except +
         cbool addSpecies(shared_ptr[CxxSpecies]) except +
         void initThermo() except +
+        double Hf298SS(int) except +
+        void modifyOneHf298SS(size_t, double) except +
 
         # basic thermodynamic properties
         double temperature() except +
@@ -222,6 +226,38 @@ cdef extern from "cantera/thermo/IdealGasPhase.h":
     cdef cppclass CxxIdealGasPhase "Cantera::IdealGasPhase"
 
 
+cdef extern from "cantera/thermo/PureFluidPhase.h":
+    cdef cppclass CxxPureFluidPhase "Cantera::PureFluidPhase":
+        void useTables(cbool) except +
+        cbool usingTables()
+
+
+cdef extern from "cantera/thermo/MixtureFugacityTP.h":
+    cdef cppclass CxxMixtureFugacityTP "Cantera::MixtureFugacityTP":
+        void getDensities_TP(size_t, double*, double*, double*, int) except +translate_exception
+
+cdef extern from "cantera/thermo/WaterPropsIAPWS.h" namespace "Cantera":
+    cdef cppclass CxxWaterPropsIAPWS "Cantera::WaterPropsIAPWS":
+        CxxWaterPropsIAPWS()
+        void useTables(cbool) except +translate_exception
+        cbool usingTables()
+        void setState_TR(double, double) except +translate_exception
+        double pressure() except +translate_exception
+        double density(double, double, int, double) except +translate_exception
+        double psat(double, int) except +translate_exception
+
+cdef extern from "cantera/thermo/WaterPropsIAPWSTable.h" namespace "Cantera":
+    cdef cppclass CxxWaterPropsIAPWSTable "Cantera::WaterPropsIAPWSTable":
+        double tolerance() const
+        double maxDensityError() const
+        double maxSaturationError() const
+        double minTemp() const
+        double maxTemp() const
+        double minPres() const
+        double maxPres() const
+        double maxSatTemp() const
+    cdef const CxxWaterPropsIAPWSTable& CxxDefaultWaterTable "Cantera::WaterPropsIAPWSTable::defaultTable" () except +translate_exception
+
 cdef extern from "cantera/thermo/SurfPhase.h":
     cdef cppclass CxxSurfPhase "Cantera::SurfPhase":
         CxxSurfPhase()
@@ -368,6 +404,8 @@ cdef extern from "cantera/kinetics/Kinetics.h" namespace "Cantera":
         string productString(int) except +
         double reactantStoichCoeff(int, int) except +
         double productStoichCoeff(int, int) except +
+        void getNetProductionRates_ddC(double*) except +
+        void getNetProductionRates_ddT(double*) except +
 
         double multiplier(int)
         void setMultiplier(int, double)
@@ -389,6 +427,23 @@ cdef extern from "cantera/transport/TransportBase.h" namespace "Cantera":
         double viscosity() except +
         double thermalConductivity() except +
         double electricalConductivity() except +
+        void getMixtureProperties(size_t, double*, double*, double*, double*, double*, double*, double*) except +translate_exception
+        void getMixtureProperties_NoNorm(size_t, double*, double*, double*, double*, double*, double*, double*) except +translate_exception
+        size_t nDim()
+        void getSpeciesFluxesES(size_t, double*, size_t, double*, size_t, double*, double*) except +translate_exception
+        void setVelocityBasis(int)
+        int getVelocityBasis()
+
+
+cdef extern from "cantera/transport/GasTransport.h" namespace "Cantera":
+    cdef void CxxSetFitCacheDirectory "Cantera::GasTransport::setFitCacheDirectory" (string)
+    cdef string CxxFitCacheDirectory "Cantera::GasTransport::fitCacheDirectory" ()
+    cdef cppclass CxxGasTransport "Cantera::GasTransport":
+        vector[double] viscosityPolynomial(size_t) except +translate_exception
+        vector[double] conductivityPolynomial(size_t) except +translate_exception
+        vector[double] binDiffusivityPolynomial(size_t, size_t) except +translate_exception
+        void useBinaryDiffTable(cbool, double) except +translate_exception
+        double binaryDiffTableError()
 
 
 cdef extern from "cantera/transport/DustyGasTransport.h" namespace "Cantera":
@@ -400,6 +455,24 @@ cdef extern from "cantera/transport/DustyGasTransport.h" namespace "Cantera":
         void setPermeability(double) except +
         void getMolarFluxes(double*, double*, double, double*) except +
 
+cdef extern from "cantera/transport/MultiTransport.h" namespace "Cantera":
+    cdef cppclass CxxMultiTransport "Cantera::MultiTransport":
+        void useIterativeSolver(cbool, double, size_t) except +translate_exception
+
+cdef extern from "cantera/transport/HighPressureGasTransport.h" namespace "Cantera":
+    cdef cppclass CxxHighPressureGasTransport "Cantera::HighPressureGasTransport":
+        void getHighPressureProperties(size_t, double*, double*, double*, double*, double*, double*) except +translate_exception
+        void useCorrectionTable(cbool, double) except +translate_exception
+        double correctionTableError()
+
+cdef extern from "cantera/transport/LiquidTransport.h" namespace "Cantera":
+    cdef cppclass CxxLiquidTransport "Cantera::LiquidTransport":
+        void getSpeciesFluxesESMulti(size_t, double*, double*, double*, double*, double*, double*, double*) except +translate_exception
+
+cdef extern from "cantera/transport/Tortuosity.h" namespace "Cantera":
+    cdef cppclass CxxTortuosity "Cantera::Tortuosity":
+        CxxTortuosity(double)
+
 
 cdef extern from "cantera/transport/TransportData.h" namespace "Cantera":
     cdef cppclass CxxTransportData "Cantera::TransportData":
@@ -482,11 +555,14 @@ cdef extern from "cantera/zeroD/Reactor.h":
         void setKineticsMgr(CxxKinetics&)
         void setEnergy(int)
         cbool energyEnabled()
+        void setTemperatureState(cbool) except +
+        cbool temperatureState()
         size_t componentIndex(string&)
         size_t neq()
         void getState(double*)
 
         void addSensitivityReaction(size_t) except +
+        void addSensitivitySpeciesEnthalpy(size_t) except +
         size_t nSensParams()
 
 
@@ -521,6 +597,7 @@ cdef extern from "cantera/zeroD/Wall.h":
         double Q(double)
 
         void addSensitivityReaction(int, size_t) except +
+        void addSensitivityHeatTransferCoeff() except +
         size_t nSensParams(int)
 
 
@@ -543,12 +620,37 @@ cdef extern from "cantera/zeroD/flowControllers.h":
         void setMaster(CxxFlowDevice*)
 
 
+cdef extern from "cantera/zeroD/ReactorEvent.h":
+    cdef cppclass CxxReactorEvent "Cantera::ReactorEvent":
+        string component()
+        int direction()
+        void setDirection(int)
+        cbool terminal()
+        void setTerminal(cbool)
+        vector[double]& times()
+
+    cdef cppclass CxxThresholdEvent "Cantera::ThresholdEvent" (CxxReactorEvent):
+        CxxThresholdEvent(CxxReactor&, string&, double)
+        double threshold()
+
+    cdef cppclass CxxPeakEvent "Cantera::PeakEvent" (CxxReactorEvent):
+        CxxPeakEvent(CxxReactor&, string&)
+
+    cdef cppclass CxxMaxRateEvent "Cantera::MaxRateEvent" (CxxReactorEvent):
+        CxxMaxRateEvent(CxxReactor&, string&)
+
+    cdef cppclass CxxFunc1Event "Cantera::Func1Event" (CxxReactorEvent):
+        CxxFunc1Event(CxxFunc1&, CxxReactor&, string&)
+
+
 cdef extern from "cantera/zeroD/ReactorNet.h":
     cdef cppclass CxxReactorNet "Cantera::ReactorNet":
         CxxReactorNet()
         void addReactor(CxxReactor&)
-        void advance(double) except +
-        double step(double) except +
+        void addEvent(CxxReactorEvent&)
+        size_t lastEvent()
+        void advance(double) except +translate_exception
+        double step(double) except +translate_exception
         void reinitialize() except +
         double time()
         void setInitialTime(double)
@@ -557,10 +659,30 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         double atol()
         void setMaxTimeStep(double)
         void setMaxErrTestFails(int)
+        void setLinearSolverType(string&) except +
+        string linearSolverType()
+        void setAnalyticJacobian(cbool)
+        cbool analyticJacobian()
+        void setSplitting(cbool)
+        cbool splitting()
+        void setSplitTimeStep(double) except +
+        double splitTimeStep()
+        void setSplitTolerances(double, double)
+        double splitRtol()
+        double splitAtol()
+        void setSplitErrorCheckInterval(size_t)
+        size_t splitErrorCheckInterval()
+        double splitError()
+        void setNumThreads(size_t)
+        size_t numThreads()
         cbool verbose()
         void setVerbose(cbool)
         size_t neq()
         void getState(double*)
+        const double* solution() except +
+        int solutionGeneration()
+        string saveCheckpoint() except +
+        void restoreCheckpoint(string&) except +
 
         void setSensitivityTolerances(double, double)
         double rtolSensitivity()
@@ -569,6 +691,59 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         double sensitivity(string&, size_t, int) except +
         size_t nparams()
         string sensitivityParameterName(size_t) except +
+        double solveAdjoint(string&, string&, double, double*, double, size_t) except +translate_exception
+
+
+cdef extern from "cantera/zeroD/ReactorEnsemble.h":
+    cdef cppclass CxxReactorEnsemble "Cantera::ReactorEnsemble":
+        CxxReactorEnsemble(string, string) except +
+        void setReactorType(string&) except +
+        string reactorType()
+        void setEndTime(double) except +
+        double endTime()
+        void setTolerances(double, double)
+        double rtol()
+        double atol()
+        void setMaxTimeStep(double)
+        void setIgnitionCriterion(string&, double, string&) except +
+        void setOutputTimes(vector[double]&) except +
+        vector[double]& outputTimes()
+        void setNumThreads(size_t)
+        size_t numThreads()
+        size_t nSpecies()
+        size_t stateSize()
+        void setInitialStates(size_t, double*, double*, double*)
+        size_t nCases()
+        void solve() nogil except +
+        vector[double]& ignitionDelays()
+        vector[double]& finalStates()
+        vector[double]& histories()
+        string errorMessage(size_t) except +
+        size_t nFailures()
+
+
+cdef extern from "cantera/zeroD/PlugFlowReactor.h":
+    cdef cppclass CxxPlugFlowReactor "Cantera::PlugFlowReactor":
+        CxxPlugFlowReactor(CxxThermoPhase&, CxxKinetics&) except +
+        void addSurface(CxxInterfaceKinetics&, double) except +
+        size_t nSurfaces()
+        void setMassFlowRate(double) except +
+        void setArea(double)
+        void setArea(CxxFunc1&)
+        double area(double) except +translate_exception
+        void setEnergy(cbool)
+        cbool energyEnabled()
+        void setTolerances(double, double)
+        double rtol()
+        double atol()
+        void setOutputCallback(CxxFunc1*)
+        void initialize(double) except +translate_exception
+        void advance(double) except +translate_exception
+        void solve(double, double) except +translate_exception
+        double distance()
+        double velocity()
+        double massFlowRate() except +translate_exception
+        void getCoverages(size_t, double*) except +
 
 
 cdef extern from "cantera/thermo/ThermoFactory.h" namespace "Cantera":
@@ -697,6 +872,8 @@ cdef extern from "cantera/oneD/StFlow.h":
         double getDiam(int &)
         double getScond(int &)
         double getHconv(int &) 
+        void setDustyGasTransport(CxxDustyGasTransport*, CxxTortuosity*) except +
+        cbool dustyGasEnabled()
 
 cdef extern from "cantera/oneD/Sim1D.h":
     cdef cppclass CxxSim1D "Cantera::Sim1D":
@@ -797,6 +974,7 @@ cdef extern from "cantera/cython/wrappers.h":
     void thermo_getIntEnergy_RT(CxxThermoPhase*, double*) except +
     void thermo_getGibbs_RT(CxxThermoPhase*, double*) except +
     void thermo_getCp_R(CxxThermoPhase*, double*) except +
+    void thermo_getStandardVolumes(CxxThermoPhase*, double*) except +
 
     # other ThermoPhase methods
     cdef void thermo_getMolecularWeights(CxxThermoPhase*, double*) except +
@@ -821,12 +999,14 @@ cdef extern from "cantera/cython/wrappers.h":
     cdef void kin_getCreationRates(CxxKinetics*, double*) except +
     cdef void kin_getDestructionRates(CxxKinetics*, double*) except +
     cdef void kin_getNetProductionRates(CxxKinetics*, double*) except +
+    cdef void kin_getNetProductionRates_ddT(CxxKinetics*, double*) except +
 
     # Transport properties
     cdef void tran_getMixDiffCoeffs(CxxTransport*, double*) except +
     cdef void tran_getMixDiffCoeffsMass(CxxTransport*, double*) except +
     cdef void tran_getMixDiffCoeffsMole(CxxTransport*, double*) except +
     cdef void tran_getThermalDiffCoeffs(CxxTransport*, double*) except +
+    cdef void tran_getSpeciesViscosities(CxxTransport*, double*) except +
 
     cdef void tran_getMultiDiffCoeffs(CxxTransport*, size_t, double*) except +
     cdef void tran_getBinaryDiffCoeffs(CxxTransport*, size_t, double*) except +
@@ -967,9 +1147,37 @@ cdef class Valve(FlowDevice):
 cdef class PressureController(FlowDevice):
     pass
 
+cdef class ReactorEvent:
+    cdef CxxReactorEvent* event
+    cdef Reactor _reactor
+
+cdef class ThresholdEvent(ReactorEvent):
+    pass
+
+cdef class PeakEvent(ReactorEvent):
+    pass
+
+cdef class MaxRateEvent(ReactorEvent):
+    pass
+
+cdef class Func1Event(ReactorEvent):
+    cdef Func1 _func
+
 cdef class ReactorNet:
     cdef CxxReactorNet net
     cdef list _reactors
+    cdef list _events
+
+cdef class ReactorEnsemble:
+    cdef CxxReactorEnsemble* ensemble
+    cdef ThermoPhase _phase
+
+cdef class PlugFlowReactor:
+    cdef CxxPlugFlowReactor* pfr
+    cdef _SolutionBase _gas
+    cdef list _surfaces
+    cdef Func1 _area
+    cdef Func1 _callback
 
 cdef class Domain1D:
     cdef CxxDomain1D* domain
@@ -1007,7 +1215,7 @@ cdef class AxisymmetricStagnationFlow(_FlowBase):
     pass
 
 cdef class PorousFlow(_FlowBase):
-    pass
+    cdef object _dusty_gas
 
 cdef class Sim1D:
     cdef CxxSim1D* sim
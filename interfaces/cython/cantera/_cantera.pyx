@@ -5,6 +5,8 @@ import numpy as np
 cimport numpy as np
 import math
 
+np.import_array()
+
 from cython.operator cimport dereference as deref, preincrement as inc
 
 from _cantera cimport *
@@ -0,0 +1,56 @@
+"""
+Compute a table of ignition delay times for methane/air mixtures over a range
+of initial temperatures, pressures and equivalence ratios, integrating the
+cases in parallel with ReactorEnsemble. A few of the cases are repeated one at
+a time with ReactorNet for comparison.
+"""
+
+from __future__ import print_function
+
+import time
+import numpy as np
+import cantera as ct
+
+T = np.linspace(1200, 1600, 9)
+P = ct.one_atm * np.array([1.0, 10.0, 40.0])
+phi = np.array([0.5, 1.0, 2.0])
+
+gas = ct.Solution('gri30.xml')
+compositions = ['CH4:{}, O2:2.0, N2:7.52'.format(p) for p in phi]
+
+# Each case is one combination of temperature, pressure and composition
+TT, PP, kk = np.meshgrid(T, P, np.arange(len(phi)), indexing='ij')
+
+ens = ct.ReactorEnsemble('gri30.xml')
+ens.reactor_type = 'IdealGasConstPressureReactor'
+ens.end_time = 0.1
+ens.set_ignition_criterion('temperature-rise', 400)
+
+t0 = time.time()
+ens.solve(TT.ravel(), PP.ravel(), [compositions[k] for k in kk.ravel()])
+t_ensemble = time.time() - t0
+tau = ens.ignition_delays.reshape(TT.shape)
+
+print('{} cases in {:.2f} s ({} failed)'.format(
+    ens.n_cases, t_ensemble, sum(1 for e in ens.errors if e)))
+for j, p in enumerate(P):
+    print('\nIgnition delay [ms] at P = {:.1f} atm'.format(p / ct.one_atm))
+    print('{:>8s}'.format('T [K]') +
+          ''.join('{:>12s}'.format('phi={:.1f}'.format(x)) for x in phi))
+    for i, Ti in enumerate(T):
+        print('{:8.1f}'.format(Ti) +
+              ''.join('{:12.4f}'.format(1e3 * tau[i,j,k])
+                      for k in range(len(phi))))
+
+# Serial calculation of a few of the cases
+t0 = time.time()
+n_serial = 5
+for i in range(n_serial):
+    gas.TPX = TT.flat[i], PP.flat[i], compositions[kk.flat[i]]
+    r = ct.IdealGasConstPressureReactor(gas)
+    net = ct.ReactorNet([r])
+    T_ig = TT.flat[i] + 400
+    while r.T < T_ig and net.time < ens.end_time:
+        net.step()
+t_serial = (time.time() - t0) / n_serial * ens.n_cases
+print('\nEstimated time for serial calculation: {:.2f} s'.format(t_serial))
@@ -0,0 +1,96 @@
+"""
+Compare the speed and accuracy of the exact and tabulated property
+calculations for the fluids for which Cantera has built-in liquid/vapor
+equations of state.
+
+For each fluid, a set of random single-phase states is generated, and then set
+again by (T, P), (H, P) and (S, P), and a set of random two-phase states is
+set by (T, X). The time per state and the largest relative difference in
+temperature and density between the two methods are printed.
+"""
+
+from __future__ import print_function
+
+import time
+import numpy as np
+import cantera as ct
+
+fluids = {'water': ct.Water,
+          'nitrogen': ct.Nitrogen,
+          'methane': ct.Methane,
+          'hydrogen': ct.Hydrogen,
+          'oxygen': ct.Oxygen,
+          'carbon dioxide': ct.CarbonDioxide,
+          'heptane': ct.Heptane,
+          'hfc134a': ct.Hfc134a
+          }
+
+n_states = 200
+
+
+def set_states(fluid, pair, states):
+    """
+    Set each of the given states using the property pair *pair*. Returns the
+    time per state and the resulting temperatures and densities. States that
+    can't be set are marked with NaN.
+    """
+    T = np.empty(len(states))
+    rho = np.empty(len(states))
+    t0 = time.time()
+    for i, values in enumerate(states):
+        try:
+            setattr(fluid, pair, values)
+            T[i] = fluid.T
+            rho[i] = fluid.density
+        except ct.CanteraError:
+            T[i] = rho[i] = np.nan
+    return (time.time() - t0) / len(states), T, rho
+
+
+def max_error(a, b):
+    valid = np.isfinite(a) & np.isfinite(b)
+    return np.max(np.abs(a[valid] - b[valid]) / np.abs(a[valid]))
+
+
+if __name__ == '__main__':
+    np.random.seed(1)
+    print('{:>16s} {:>5s} {:>12s} {:>12s} {:>8s} {:>10s} {:>10s}'.format(
+        'fluid', 'pair', 'exact [us]', 'table [us]', 'speedup',
+        'err(T)', 'err(rho)'))
+    for name, fluid_type in sorted(fluids.items()):
+        exact = fluid_type()
+        tabulated = fluid_type()
+        t0 = time.time()
+        tabulated.use_tables = True
+        t_build = time.time() - t0
+
+        Tmin = max(exact.min_temp, 0.3 * exact.critical_temperature)
+        Tmax = min(exact.max_temp, 3.0 * exact.critical_temperature)
+        T = np.random.uniform(Tmin, Tmax, n_states)
+        P = exact.critical_pressure * np.exp(np.random.uniform(
+            np.log(1e-3), np.log(5.0), n_states))
+
+        # Reference properties of the single-phase states
+        TP = []
+        HP = []
+        SP = []
+        for Ti, Pi in zip(T, P):
+            try:
+                exact.TP = Ti, Pi
+            except ct.CanteraError:
+                continue
+            TP.append((Ti, Pi))
+            HP.append((exact.h, Pi))
+            SP.append((exact.s, Pi))
+
+        Tsat = np.random.uniform(Tmin, 0.999 * exact.critical_temperature,
+                                 n_states)
+        TX = [(Ti, x) for Ti, x in zip(Tsat, np.random.uniform(0, 1, n_states))]
+
+        print('{:>16s} (tables generated in {:.2f} s)'.format(name, t_build))
+        for pair, states in [('TP', TP), ('HP', HP), ('SP', SP), ('TX', TX)]:
+            t_exact, T_exact, rho_exact = set_states(exact, pair, states)
+            t_table, T_table, rho_table = set_states(tabulated, pair, states)
+            print('{:>16s} {:>5s} {:12.1f} {:12.1f} {:8.1f} {:10.2e} {:10.2e}'.format(
+                '', pair, 1e6 * t_exact, 1e6 * t_table, t_exact / t_table,
+                max_error(T_exact, T_table), max_error(rho_exact, rho_table)))
@@ -0,0 +1,81 @@
+"""
+Micro-benchmark of the mixture-averaged viscosity.
+
+The viscosity is evaluated with Wilke's mixture rule, where the weighting
+function has to be recomputed for every pair of species whenever the
+temperature changes. This example times that evaluation for synthetic gas
+mixtures of 50, 150 and 300 species, which is representative of mechanisms
+ranging from small hydrocarbon mechanisms to detailed mechanisms for
+transportation fuels, and checks the result against a direct evaluation of
+Wilke's rule using NumPy.
+"""
+
+import numpy as np
+import cantera as ct
+from time import time
+
+
+def make_gas(n_species):
+    """
+    Create an ideal gas with *n_species* species of different sizes, with
+    constant heat capacities and Lennard-Jones parameters typical of
+    hydrocarbon species.
+    """
+    species = []
+    for k in range(n_species):
+        nC = 1 + k % 20
+        nH = 2 * nC + 2 - 2 * (k % 3)
+        nO = k % 2
+        s = ct.Species('S{}'.format(k), {'C': nC, 'H': nH, 'O': nO})
+        s.thermo = ct.ConstantCp(200, 3500, ct.one_atm,
+                                 [298.15, -1e7 * nC, 2e5 + 1e4 * nC,
+                                  3e4 + 2e4 * nC])
+        tran = ct.GasTransportData()
+        tran.set_customary_units('nonlinear', 3.5 + 0.2 * nC,
+                                 150 + 25 * nC + 5 * (k % 7),
+                                 rotational_relaxation=1.0)
+        s.transport = tran
+        species.append(s)
+
+    gas = ct.Solution(thermo='IdealGas', species=species,
+                      transport_model='Mix')
+    X = 1 + np.sin(np.arange(1, n_species + 1))
+    gas.TPX = 1000, ct.one_atm, X
+    return gas
+
+
+def wilke_viscosity(gas):
+    """ Wilke's mixture rule evaluated directly """
+    mu = gas.species_viscosities
+    W = gas.molecular_weights
+    X = gas.X
+    phi = ((1 + np.sqrt(np.outer(mu, 1 / mu)) * np.outer(1 / W, W)**0.25)**2
+           / np.sqrt(8 * (1 + np.outer(W, 1 / W))))
+    return np.sum(X * mu / np.dot(phi, X))
+
+
+n_evals = 2000
+for n_species in (50, 150, 300):
+    gas = make_gas(n_species)
+    # use a different temperature for each evaluation, so that the species
+    # viscosities and the weighting function are recomputed every time
+    temperatures = np.linspace(500, 2500, n_evals)
+
+    t0 = time()
+    for T in temperatures:
+        gas.TP = T, None
+    t_state = time() - t0
+
+    t0 = time()
+    for T in temperatures:
+        gas.TP = T, None
+        gas.viscosity
+    t_visc = time() - t0 - t_state
+
+    gas.TP = 1500, None
+    err = abs(gas.viscosity - wilke_viscosity(gas)) / gas.viscosity
+
+    per_call = 1e6 * t_visc / n_evals
+    print('{:4d} species: {:9.2f} us per evaluation, {:7.2f} ns per '
+          'species pair (relative difference from NumPy: {:.1e})'.format(
+          n_species, per_call, 1e3 * per_call / n_species**2, err))
@@ -289,6 +289,28 @@ cdef class Kinetics(_SolutionBase):
         def __get__(self):
             return get_species_array(self, kin_getNetProductionRates)
 
+    property net_production_rates_ddC:
+        """
+        Derivatives of the net production rates with respect to the species
+        concentrations, at constant temperature. Element *[k,j]* of this array
+        is the derivative of the net production rate of species *k* with
+        respect to the concentration of species *j*. [1/s]
+        """
+        def __get__(self):
+            cdef int nsp = self.n_total_species
+            cdef np.ndarray[np.double_t, ndim=2, mode="fortran"] data = \
+                np.empty((nsp, nsp), order='F')
+            self.kinetics.getNetProductionRates_ddC(&data[0,0])
+            return data
+
+    property net_production_rates_ddT:
+        """
+        Derivatives of the net production rates with respect to temperature,
+        at constant species concentrations. [kmol/m^3/s/K]
+        """
+        def __get__(self):
+            return get_species_array(self, kin_getNetProductionRates_ddT)
+
     property delta_enthalpy:
         """Change in enthalpy for each reaction [J/kmol]."""
         def __get__(self):
@@ -651,6 +651,31 @@ cdef class PorousFlow(_FlowBase):
                 data[j] = tmpPtr.getHconv(j)
             return data
 
+    def set_dusty_gas_transport(self, DustyGasTransport gas, bruggeman=1.5):
+        """
+        Compute the species diffusive fluxes with the dusty-gas model, using
+        the local porosity and pore diameter. *gas* must have the same species
+        as this domain; its state is modified during the solution. The
+        tortuosity is computed from the porosity using the Bruggeman relation
+        with exponent *bruggeman*. Pass `None` for *gas* to return to the
+        fluxes computed from the gas transport model.
+        """
+        tmpPtr = <CxxPorousFlow*> self.flow
+        if gas is None:
+            tmpPtr.setDustyGasTransport(NULL, NULL)
+        else:
+            tmpPtr.setDustyGasTransport(
+                <CxxDustyGasTransport*>gas.transport,
+                new CxxTortuosity(bruggeman))
+        self._dusty_gas = gas
+
+    property dusty_gas_enabled:
+        """
+        `True` if the dusty-gas model is used for the species fluxes.
+        """
+        def __get__(self):
+            return (<CxxPorousFlow*> self.flow).dustyGasEnabled()
+
 
 cdef class Sim1D:
     """
@@ -212,6 +212,22 @@ cdef class Reactor(ReactorBase):
         def __set__(self, pybool value):
             self.reactor.setEnergy(int(value))
 
+    property temperature_state:
+        """
+        *True* when the temperature, rather than the total internal energy (or
+        the total enthalpy, for a `ConstPressureReactor`), is used as a state
+        variable. This avoids an iterative solution for the temperature each
+        time the state of the reactor is set, but requires a phase which
+        implements the partial molar properties of the species, the thermal
+        expansion coefficient and the isothermal compressibility. Always
+        *True* for the ideal gas reactors.
+        """
+        def __get__(self):
+            return self.reactor.temperatureState()
+
+        def __set__(self, pybool value):
+            self.reactor.setTemperatureState(value)
+
     def add_sensitivity_reaction(self, m):
         """
         Specifies that the sensitivity of the state variables with respect to
@@ -221,6 +237,19 @@ cdef class Reactor(ReactorBase):
         """
         self.reactor.addSensitivityReaction(m)
 
+    def add_sensitivity_species_enthalpy(self, k):
+        """
+        Specifies that the sensitivity of the state variables with respect to
+        the enthalpy of formation of species *k* should be computed. *k* is
+        the name or the 0-based index of the species. The parameter is
+        additive: a change of 1 changes the enthalpy of formation by
+        :math:`R T_0`, where :math:`T_0` = 298.15 K. The reactor must be part
+        of a network first.
+        """
+        if isinstance(k, (str, unicode, bytes)):
+            k = self.thermo.species_index(k)
+        self.reactor.addSensitivitySpeciesEnthalpy(k)
+
     def component_index(self, name):
         """
         Returns the index of the component named *name* in the system. This
@@ -522,6 +551,15 @@ cdef class Wall:
         def __set__(self, double value):
             self.wall.setHeatTransferCoeff(value)
 
+    def add_sensitivity_heat_transfer_coeff(self):
+        """
+        Specifies that the sensitivity of the state variables with respect to
+        a multiplier on the heat transfer coefficient should be computed. At
+        least one of the reactors on either side of the wall must be part of a
+        network first.
+        """
+        self.wall.addSensitivityHeatTransferCoeff()
+
     property emissivity:
         """The emissivity (nondimensional)"""
         def __get__(self):
@@ -775,6 +813,199 @@ cdef class PressureController(FlowDevice):
         (<CxxPressureController*>self.dev).setMaster(d.dev)
 
 
+cdef class ReactorEvent:
+    """
+    Base class for events which are located while integrating a `ReactorNet`,
+    such as the ignition of a mixture. An event occurs at each zero of its
+    event function, which depends on one component of the state of a
+    reactor, given by its name (see `Reactor.component_index`).
+
+    Events are added to a network with `ReactorNet.add_event`. If an event is
+    *terminal*, `ReactorNet.advance` stops at the time of the event rather
+    than at the requested time.
+    """
+    def __cinit__(self, *args, **kwargs):
+        self.event = NULL
+
+    def __dealloc__(self):
+        del self.event
+
+    def _set_options(self, direction, terminal):
+        if direction is not None:
+            self.direction = direction
+        self.terminal = terminal
+
+    property reactor:
+        """The `Reactor` whose state is used by this event."""
+        def __get__(self):
+            return self._reactor
+
+    property component:
+        """The name of the component of the reactor state used by this event."""
+        def __get__(self):
+            return pystr(self.event.component())
+
+    property direction:
+        """
+        The direction of the zero crossings of the event function which are
+        detected: 1 for increasing, -1 for decreasing, or 0 for both.
+        """
+        def __get__(self):
+            return self.event.direction()
+        def __set__(self, int direction):
+            self.event.setDirection(direction)
+
+    property terminal:
+        """If `True`, the integration stops when the event occurs."""
+        def __get__(self):
+            return self.event.terminal()
+        def __set__(self, cbool terminal):
+            self.event.setTerminal(terminal)
+
+    property times:
+        """
+        The times [s] at which the event has occurred since the network was
+        initialized.
+        """
+        def __get__(self):
+            return np.array(self.event.times())
+
+
+cdef class ThresholdEvent(ReactorEvent):
+    """
+    An event which occurs when the component *component* of the state of
+    *reactor* crosses the value *threshold*, e.g. when the temperature
+    exceeds a given value::
+
+        >>> ignition = ThresholdEvent(r, 'temperature', 1500)
+
+    By default, only increasing crossings of the threshold are detected.
+    """
+    def __init__(self, Reactor reactor, component, double threshold, *,
+                 direction=None, terminal=True):
+        self._reactor = reactor
+        self.event = new CxxThresholdEvent(deref(reactor.reactor),
+                                           stringify(component), threshold)
+        self._set_options(direction, terminal)
+
+    property threshold:
+        """The threshold value of the component."""
+        def __get__(self):
+            return (<CxxThresholdEvent*>self.event).threshold()
+
+
+cdef class PeakEvent(ReactorEvent):
+    """
+    An event which occurs at each local maximum of the component *component*
+    of the state of *reactor*, e.g. the peak mass fraction of a radical.
+    """
+    def __init__(self, Reactor reactor, component, *, direction=None,
+                 terminal=True):
+        self._reactor = reactor
+        self.event = new CxxPeakEvent(deref(reactor.reactor),
+                                      stringify(component))
+        self._set_options(direction, terminal)
+
+
+cdef class MaxRateEvent(ReactorEvent):
+    """
+    An event which occurs at each local maximum of the rate of change of the
+    component *component* of the state of *reactor*, e.g. the maximum of
+    dT/dt. The second derivative of the component is approximated by finite
+    differences.
+    """
+    def __init__(self, Reactor reactor, component, *, direction=None,
+                 terminal=True):
+        self._reactor = reactor
+        self.event = new CxxMaxRateEvent(deref(reactor.reactor),
+                                         stringify(component))
+        self._set_options(direction, terminal)
+
+
+cdef class Func1Event(ReactorEvent):
+    """
+    An event which occurs at each zero of the function *func* of the
+    component *component* of the state of *reactor*. *func* may be a `Func1`
+    or any object which can be converted to one::
+
+        >>> event = Func1Event(lambda T: T - 1500, r, 'temperature')
+
+    By default, zero crossings in both directions are detected.
+    """
+    def __init__(self, func, Reactor reactor, component, *, direction=None,
+                 terminal=True):
+        cdef Func1 f
+        if isinstance(func, Func1):
+            f = func
+        else:
+            f = Func1(func)
+        self._func = f
+        self._reactor = reactor
+        self.event = new CxxFunc1Event(deref(f.func), deref(reactor.reactor),
+                                       stringify(component))
+        self._set_options(direction, terminal)
+
+
+cdef class ReactorNetStateView:
+    """
+    A read-only view of the combined state vector of a `ReactorNet`, obtained
+    from `ReactorNet.state_view`. The view supports `len`, indexing and
+    conversion to a NumPy array (which shares its memory with the network),
+    and checks on each access that the state vector of the network has not
+    been reallocated since the view was created.
+    """
+    cdef ReactorNet _net
+    cdef int _generation
+    cdef np.ndarray _data
+
+    def __cinit__(self, ReactorNet net):
+        cdef const double* y = net.net.solution()
+        cdef np.npy_intp n = net.net.neq()
+        self._net = net
+        self._generation = net.net.solutionGeneration()
+        self._data = np.PyArray_SimpleNewFromData(1, &n, np.NPY_DOUBLE,
+                                                  <void*>y)
+        self._data.flags.writeable = False
+        # Keep the network, which owns the data, alive
+        np.set_array_base(self._data, net)
+
+    property valid:
+        """
+        `True` if the state vector of the network has not been reallocated
+        since the view was created.
+        """
+        def __get__(self):
+            return self._net.net.solutionGeneration() == self._generation
+
+    property array:
+        """
+        A read-only NumPy array sharing its memory with the state vector. The
+        array itself is not checked on access, so it should not be kept
+        beyond the lifetime of the view.
+        """
+        def __get__(self):
+            if not self.valid:
+                raise RuntimeError('The state vector of the ReactorNet has '
+                    'been reallocated since this view was created.')
+            return self._data
+
+    def __array__(self, dtype=None):
+        if dtype is None:
+            return self.array
+        return self.array.astype(dtype)
+
+    def __len__(self):
+        return len(self.array)
+
+    def __getitem__(self, index):
+        return self.array[index]
+
+    def __repr__(self):
+        if not self.valid:
+            return '<ReactorNetStateView (invalidated)>'
+        return '<ReactorNetStateView {!r}>'.format(self._data)
+
+
 cdef class ReactorNet:
     """
     Networks of reactors. ReactorNet objects are used to simultaneously
@@ -791,6 +1022,7 @@ cdef class ReactorNet:
     """
     def __init__(self, reactors=()):
         self._reactors = []  # prevents premature garbage collection
+        self._events = []
         for R in reactors:
             self.add_reactor(R)
 
@@ -799,10 +1031,39 @@ cdef class ReactorNet:
         self._reactors.append(r)
         self.net.addReactor(deref(r.reactor))
 
+    def add_event(self, ReactorEvent event):
+        """
+        Add an event (see `ReactorEvent`) whose occurrence is located while
+        integrating the network. The reactor used by the event must be part of
+        the network.
+        """
+        if event.event == NULL:
+            raise TypeError('ReactorEvent is an abstract base class')
+        self._events.append(event)
+        self.net.addEvent(deref(event.event))
+
+    property events:
+        """The list of events added to the network."""
+        def __get__(self):
+            return list(self._events)
+
+    property last_event:
+        """
+        The terminal event which stopped the last call to `advance` or
+        `step`, or `None` if the integration was not stopped by an event.
+        """
+        def __get__(self):
+            cdef size_t i = self.net.lastEvent()
+            if i == <size_t>-1:
+                return None
+            return self._events[i]
+
     def advance(self, double t):
         """
         Advance the state of the reactor network in time from the current
         time to time *t* [s], taking as many integrator timesteps as necessary.
+        If a terminal event occurs first, the integration stops at the time of
+        the event.
         """
         self.net.advance(t)
 
@@ -852,6 +1113,124 @@ cdef class ReactorNet:
         def __set__(self, n):
             self.net.setMaxErrTestFails(n)
 
+    property linear_solver_type:
+        """
+        The type of linear solver used by the integrator. One of:
+
+        - ``'DENSE'``: dense LU factorization of a finite difference Jacobian
+          (the default).
+        - ``'SPARSE'``: sparse LU factorization of a finite difference
+          Jacobian which only couples reactors connected by a `Wall` or
+          `FlowDevice`. Recommended for networks with many reactors.
+        - ``'GMRES'``: iterative solution using GMRES, preconditioned with
+          a sparse approximation to the reaction terms for `IdealGasReactor`
+          and `IdealGasConstPressureReactor`, and with finite differences for
+          other reactors. Couplings between reactors are neglected in the
+          preconditioner. Recommended for large reaction mechanisms.
+        """
+        def __get__(self):
+            return pystr(self.net.linearSolverType())
+        def __set__(self, solver_type):
+            self.net.setLinearSolverType(stringify(solver_type))
+
+    property analytic_jacobian:
+        """
+        If *True*, the derivatives of the reaction terms in the Jacobian are
+        calculated analytically for reactor types which support this
+        (`IdealGasReactor` and `IdealGasConstPressureReactor`), and only the
+        remaining terms are computed by finite differences. This greatly
+        reduces the cost of evaluating the Jacobian for large mechanisms. The
+        default is *False*.
+        """
+        def __get__(self):
+            return pybool(self.net.analyticJacobian())
+        def __set__(self, pybool analytic):
+            self.net.setAnalyticJacobian(analytic)
+
+    property splitting:
+        """
+        If *True*, the network is integrated in the operator-split mode.
+        Each time step (see `split_time_step`) is split into a half step of
+        the terms due to walls and flow devices for the whole network,
+        integrated explicitly, a full step of the reaction terms of each
+        reactor, integrated separately and in parallel (see `n_threads`), and
+        another half step of the wall and flow terms. This is efficient for
+        large networks with stiff chemistry and slow exchange between the
+        reactors. Sensitivity parameters, events, checkpoints and surface
+        reactions on walls are not supported in this mode. The default is
+        *False*.
+        """
+        def __get__(self):
+            return pybool(self.net.splitting())
+        def __set__(self, pybool split):
+            self.net.setSplitting(split)
+
+    property split_time_step:
+        """
+        The length of the time steps [s] in the operator-split mode. If the
+        splitting error is checked (see `split_error_check_interval`), this
+        is the maximum step.
+        """
+        def __get__(self):
+            return self.net.splitTimeStep()
+        def __set__(self, double dt):
+            self.net.setSplitTimeStep(dt)
+
+    property split_rtol:
+        """
+        The relative error tolerance used in the operator-split mode for the
+        explicit integration of the wall and flow terms, and to compare the
+        split solution with the monolithic solution.
+        """
+        def __get__(self):
+            return self.net.splitRtol()
+        def __set__(self, double tol):
+            self.net.setSplitTolerances(tol, -1)
+
+    property split_atol:
+        """
+        The absolute error tolerance used in the operator-split mode. See
+        `split_rtol`.
+        """
+        def __get__(self):
+            return self.net.splitAtol()
+        def __set__(self, double tol):
+            self.net.setSplitTolerances(-1, tol)
+
+    property split_error_check_interval:
+        """
+        The number of operator-split time steps between checks of the
+        splitting error, or zero (the default) for no checks. Each checked
+        step is repeated with the monolithic integrator, and the step size is
+        adapted to the difference between the two solutions (see
+        `split_error`).
+        """
+        def __get__(self):
+            return self.net.splitErrorCheckInterval()
+        def __set__(self, size_t n):
+            self.net.setSplitErrorCheckInterval(n)
+
+    property split_error:
+        """
+        The weighted root-mean-square difference between the split and
+        monolithic solutions at the last check of the splitting error, or NaN
+        if the error hasn't been checked. Values less than 1 are within the
+        tolerances `split_rtol` and `split_atol`.
+        """
+        def __get__(self):
+            return self.net.splitError()
+
+    property n_threads:
+        """
+        The number of threads used to integrate the reaction terms in the
+        operator-split mode. Zero (the default) uses one thread for each
+        hardware thread.
+        """
+        def __get__(self):
+            return self.net.numThreads()
+        def __set__(self, size_t n):
+            self.net.setNumThreads(n)
+
     property rtol:
         """
         The relative error tolerance used while integrating the reactor
@@ -959,6 +1338,38 @@ cdef class ReactorNet:
         """
         return pystr(self.net.sensitivityParameterName(p))
 
+    def solve_adjoint(self, kind, component, double t_end, *,
+                      double threshold=0.0, int r=0):
+        r"""
+        Compute the sensitivities of a scalar functional :math:`G` of the
+        solution with respect to all of the registered sensitivity parameters
+        by integrating the adjoint equations backwards in time. Unlike
+        `sensitivities`, the cost is nearly independent of the number of
+        parameters. The functional depends on the state variable *component*
+        of reactor *r*, :math:`y_k`, according to *kind*:
+
+          - ``'final'``: the value of :math:`y_k` at time *t_end*
+          - ``'integral'``: the integral of :math:`y_k` from the current time
+            to *t_end*
+          - ``'crossing'``: the time from the current time until :math:`y_k`
+            first crosses *threshold*, e.g. an ignition delay time
+
+        The network is integrated from the current time, and is left at the
+        end time of the functional afterwards. Returns a tuple of the value
+        of :math:`G` and an array of the normalized sensitivity coefficients
+        :math:`(p_i / G) \partial G / \partial p_i`::
+
+            >>> r.add_sensitivity_reaction(2)
+            >>> net.rtol_sensitivity = 1e-6
+            >>> tau, sens = net.solve_adjoint('crossing', 'temperature', 0.1,
+            ...                               threshold=1500.0)
+        """
+        cdef np.ndarray[np.double_t, ndim=1] sens = \
+                np.zeros(max(self.n_sensitivity_params, 1))
+        value = self.net.solveAdjoint(stringify(kind), stringify(component),
+                                      t_end, &sens[0], threshold, r)
+        return value, sens[:self.n_sensitivity_params]
+
     property n_sensitivity_params:
         """
         The number of registered sensitivity parameters.
@@ -996,6 +1407,45 @@ cdef class ReactorNet:
         self.net.getState(&y[0])
         return y
 
+    property state_view:
+        """
+        A `ReactorNetStateView` which shares its memory with the combined
+        state vector of the reactor network. Unlike `get_state`, no copy is
+        made, and the values seen through the view are updated in place by
+        `advance` and `step`. The view is invalidated when the network is
+        re-initialized (for example after adding a reactor or changing the
+        integrator settings), since the state vector may then be
+        reallocated; accessing it afterwards raises an exception, and a new
+        view must be obtained.
+        """
+        def __get__(self):
+            return ReactorNetStateView(self)
+
+    def save_checkpoint(self):
+        """
+        Save the state of the reactor network, including the state of the
+        integrator and any sensitivities, as a `bytes` object. Integrating
+        the network after restoring it from the checkpoint with
+        `restore_checkpoint` continues from the saved time and state::
+
+            >>> net.advance(t_fork)
+            >>> checkpoint = net.save_checkpoint()
+            >>> for k in range(gas.n_reactions):
+            ...     net.restore_checkpoint(checkpoint)
+            ...     ...
+
+        The checkpoint does not include the configuration of the network, and
+        can be restored into any network with the same structure.
+        """
+        return self.net.saveCheckpoint()
+
+    def restore_checkpoint(self, bytes data):
+        """
+        Restore the state of the reactor network from a checkpoint created
+        by `save_checkpoint`, and set the states of the reactors accordingly.
+        """
+        self.net.restoreCheckpoint(data)
+
     def advance_to_steady_state(self, int max_steps=10000,
                                 double residual_threshold=0., double atol=0.,
                                 pybool return_residuals=False):
@@ -1062,3 +1512,371 @@ cdef class ReactorNet:
 
     def __copy__(self):
         raise NotImplementedError('ReactorNet object is not copyable')
+
+
+cdef class ReactorEnsemble:
+    """
+    ReactorEnsemble(infile, phaseid='')
+
+    Integrate many independent reactors, which differ only in their initial
+    temperature, pressure and composition, in parallel. This is much faster
+    than creating and integrating a `ReactorNet` for each case in Python, and
+    is intended for parameter sweeps such as tables of ignition delay times::
+
+        >>> ens = ReactorEnsemble('gri30.xml')
+        >>> ens.end_time = 0.1
+        >>> ens.set_ignition_criterion('temperature-rise', 400)
+        >>> ens.solve(T=[1000, 1100, 1200], P=ct.one_atm,
+        ...           X='CH4:1.0, O2:2.0, N2:7.52')
+        >>> ens.ignition_delays
+
+    Each worker thread creates its own phase, kinetics, reactor and
+    integrator objects from the phase definition in *infile*, which is read
+    only once.
+    """
+    def __cinit__(self, infile, phaseid=''):
+        self.ensemble = new CxxReactorEnsemble(stringify(infile),
+                                               stringify(phaseid))
+
+    def __init__(self, infile, phaseid=''):
+        # Used to convert compositions to mole fraction arrays
+        self._phase = ThermoPhase(infile, phaseid)
+
+    def __dealloc__(self):
+        del self.ensemble
+
+    property reactor_type:
+        """
+        The type of reactor used for each case, e.g. ``'IdealGasReactor'``
+        (the default) or ``'IdealGasConstPressureReactor'``.
+        """
+        def __get__(self):
+            return pystr(self.ensemble.reactorType())
+        def __set__(self, reactor_type):
+            self.ensemble.setReactorType(stringify(reactor_type))
+
+    property end_time:
+        """ The time [s] at which the integration of each case ends. """
+        def __get__(self):
+            return self.ensemble.endTime()
+        def __set__(self, double t):
+            self.ensemble.setEndTime(t)
+
+    property rtol:
+        """ The relative error tolerance used while integrating each case. """
+        def __get__(self):
+            return self.ensemble.rtol()
+        def __set__(self, double tol):
+            self.ensemble.setTolerances(tol, -1)
+
+    property atol:
+        """ The absolute error tolerance used while integrating each case. """
+        def __get__(self):
+            return self.ensemble.atol()
+        def __set__(self, double tol):
+            self.ensemble.setTolerances(-1, tol)
+
+    property max_time_step:
+        """
+        Set the maximum time step of the integrator. Zero (the default) means
+        no limit.
+        """
+        def __set__(self, double t):
+            self.ensemble.setMaxTimeStep(t)
+
+    property n_threads:
+        """
+        The number of worker threads. Zero (the default) uses one thread for
+        each hardware thread.
+        """
+        def __get__(self):
+            return self.ensemble.numThreads()
+        def __set__(self, size_t n):
+            self.ensemble.setNumThreads(n)
+
+    property output_times:
+        """
+        Times [s] at which the state of each reactor is saved in `histories`.
+        Empty by default.
+        """
+        def __get__(self):
+            return np.array(self.ensemble.outputTimes())
+        def __set__(self, times):
+            self.ensemble.setOutputTimes(np.asarray(times, dtype=np.double))
+
+    def set_ignition_criterion(self, kind, value=400.0, species=''):
+        """
+        Set the criterion used to determine the ignition delay time:
+
+        - ``'temperature-rise'``: the time at which the temperature first
+          exceeds its initial value by *value* [K] (the default, with a rise
+          of 400 K).
+        - ``'max-dTdt'``: the time of the largest rate of change of the
+          temperature.
+        - ``'max-species'``: the time at which the mole fraction of *species*
+          is largest.
+        """
+        self.ensemble.setIgnitionCriterion(stringify(kind), value,
+                                           stringify(species))
+
+    def solve(self, T, P, X):
+        """
+        Integrate each of the cases. *T* and *P* are the initial
+        temperatures [K] and pressures [Pa]. *X* is either a single
+        composition, given as a string, dict or array of mole fractions, or a
+        sequence of compositions. The temperatures, pressures and
+        compositions are broadcast against each other to give the cases.
+        """
+        cdef size_t nsp = self.ensemble.nSpecies()
+        single = (isinstance(X, (str, unicode, bytes, dict)) or
+                  np.ndim(X) == 1 and len(X) == nsp and
+                  all(isinstance(x, _numbers.Real) for x in X))
+        if single:
+            self._phase.X = X
+            X = [self._phase.X]
+
+        # Broadcast the temperatures, pressures and compositions
+        T, P, index = np.broadcast_arrays(np.asarray(T, dtype=np.double),
+                                          np.asarray(P, dtype=np.double),
+                                          np.arange(len(X)))
+        cdef np.ndarray[np.double_t, ndim=1] T0 = np.ascontiguousarray(T.ravel())
+        cdef np.ndarray[np.double_t, ndim=1] P0 = np.ascontiguousarray(P.ravel())
+        cdef size_t n = len(T0)
+        if n == 0:
+            raise ValueError('No cases given')
+
+        cdef np.ndarray[np.double_t, ndim=2] X0 = np.empty((n, nsp))
+        for i, k in enumerate(index.ravel()):
+            self._phase.X = X[k]
+            X0[i] = self._phase.X
+
+        self.ensemble.setInitialStates(n, &T0[0], &P0[0], &X0[0,0])
+        with nogil:
+            self.ensemble.solve()
+
+    property n_cases:
+        """ The number of cases. """
+        def __get__(self):
+            return self.ensemble.nCases()
+
+    property ignition_delays:
+        """
+        The ignition delay time [s] of each case, according to the criterion
+        set by `set_ignition_criterion`. NaN for cases which did not ignite
+        before `end_time` or could not be integrated.
+        """
+        def __get__(self):
+            return np.array(self.ensemble.ignitionDelays())
+
+    property final_states:
+        """
+        The state of each reactor at `end_time`, as an array with one row for
+        each case. Each row contains the temperature [K], the pressure [Pa]
+        and the mass fractions of all species.
+        """
+        def __get__(self):
+            return np.array(self.ensemble.finalStates()).reshape(
+                self.ensemble.nCases(), self.ensemble.stateSize())
+
+    property histories:
+        """
+        The state of each reactor at each of the `output_times`, as an array
+        of size `n_cases` by ``len(output_times)`` by the number of species
+        plus two. The state is given as in `final_states`, and is interpolated
+        linearly between the time steps of the integrator.
+        """
+        def __get__(self):
+            return np.array(self.ensemble.histories()).reshape(
+                self.ensemble.nCases(), len(self.ensemble.outputTimes()),
+                self.ensemble.stateSize())
+
+    property errors:
+        """
+        The error message for each case, which is empty if the integration of
+        that case was successful.
+        """
+        def __get__(self):
+            return [pystr(self.ensemble.errorMessage(i))
+                    for i in range(self.ensemble.nCases())]
+
+    def __reduce__(self):
+        raise NotImplementedError('ReactorEnsemble object is not picklable')
+
+    def __copy__(self):
+        raise NotImplementedError('ReactorEnsemble object is not copyable')
+
+
+cdef class PlugFlowReactor:
+    """
+    PlugFlowReactor(gas, *, mdot, area=1.0, energy='on')
+
+    A steady, one-dimensional plug flow reactor for the ideal gas *gas*,
+    which must be a `Solution` object. The governing equations, including the
+    coverages of any surfaces added with `add_surface`, are integrated in the
+    axial distance as a system of differential-algebraic equations. The inlet
+    state is the state of *gas* when the integration starts::
+
+        >>> gas.TPX = 1500, ct.one_atm, 'CH4:1, O2:2, N2:7.52'
+        >>> pfr = PlugFlowReactor(gas, mdot=0.01, area=1e-4)
+        >>> pfr.solve(0.5, 1e-3, lambda z: print(z, gas.T))
+
+    *mdot* is the mass flow rate [kg/s] and *area* is the cross-sectional
+    area [m^2], given either as a number or as a function of the axial
+    distance (see `area`). If *energy* is ``'off'``, the temperature is held
+    constant.
+
+    The states of *gas* and of the surface phases are set to the solution at
+    the current position, given by `distance`.
+    """
+    def __cinit__(self, *args, **kwargs):
+        self.pfr = NULL
+
+    def __init__(self, _SolutionBase gas not None, *, mdot, area=1.0,
+                 energy='on'):
+        self.pfr = new CxxPlugFlowReactor(deref(gas.thermo),
+                                          deref(gas.kinetics))
+        self._gas = gas
+        self._surfaces = []
+        self.mass_flow_rate = mdot
+        self.area = area
+        self.energy_enabled = (energy == 'on')
+
+    def __dealloc__(self):
+        del self.pfr
+
+    def add_surface(self, InterfaceKinetics surface not None, area_to_volume):
+        """
+        Add the reactions on the surface *surface*, which must be an
+        `Interface` object whose first phase is the gas, with a surface area
+        per unit volume of the reactor of *area_to_volume* [1/m]. The current
+        coverages of *surface* are used as the initial guess for the
+        coverages at the inlet.
+        """
+        self.pfr.addSurface(deref(<CxxInterfaceKinetics*>surface.kinetics),
+                            area_to_volume)
+        self._surfaces.append(surface)
+
+    property surfaces:
+        """ The surfaces added with `add_surface`. """
+        def __get__(self):
+            return list(self._surfaces)
+
+    property mass_flow_rate:
+        """
+        The mass flow rate [kg/s] at the current position. Setting this
+        property sets the mass flow rate at the inlet. The mass flow rate
+        changes along the reactor only due to surface reactions.
+        """
+        def __get__(self):
+            return self.pfr.massFlowRate()
+        def __set__(self, double mdot):
+            self.pfr.setMassFlowRate(mdot)
+
+    property area:
+        """
+        The cross-sectional area [m^2] at the current position. May be set
+        either to a constant or to a function of the axial distance [m],
+        given as a `Func1` or any object which can be converted to one.
+        """
+        def __get__(self):
+            return self.pfr.area(self.pfr.distance())
+        def __set__(self, A):
+            cdef Func1 f
+            if isinstance(A, _numbers.Real):
+                self._area = None
+                self.pfr.setArea(<double>A)
+            else:
+                f = A if isinstance(A, Func1) else Func1(A)
+                self._area = f
+                self.pfr.setArea(deref(f.func))
+
+    property energy_enabled:
+        """
+        `True` if the energy equation is solved. Otherwise, the temperature
+        is held at its inlet value.
+        """
+        def __get__(self):
+            return self.pfr.energyEnabled()
+        def __set__(self, pybool value):
+            self.pfr.setEnergy(value)
+
+    property rtol:
+        """ The relative error tolerance of the integrator. """
+        def __get__(self):
+            return self.pfr.rtol()
+        def __set__(self, double tol):
+            self.pfr.setTolerances(tol, -1)
+
+    property atol:
+        """
+        The absolute error tolerance of the integrator for the mass fractions
+        and coverages. The tolerances for the velocity, density, pressure and
+        temperature are scaled by their inlet values.
+        """
+        def __get__(self):
+            return self.pfr.atol()
+        def __set__(self, double tol):
+            self.pfr.setTolerances(-1, tol)
+
+    def initialize(self, double z0=0.0):
+        """
+        Set up the integrator, starting from the current state of the phases
+        at the axial position *z0* [m]. Called automatically by `advance`
+        and `solve` if necessary.
+        """
+        self.pfr.initialize(z0)
+
+    def advance(self, double z):
+        """
+        Integrate to the axial position *z* [m] and set the states of the
+        phases to the solution there.
+        """
+        self.pfr.advance(z)
+
+    def solve(self, double length, double dz, callback=None):
+        """
+        Integrate from the current position to the axial position *length*
+        [m]. If *callback* is given, it is called with the axial distance as
+        its argument at the current position and at every multiple of *dz*
+        [m] from there, while the states of the phases are set to the local
+        state of the reactor. The solution is not stored, so the memory used
+        does not depend on the number of output stations.
+        """
+        if callback is None:
+            self._callback = None
+            self.pfr.setOutputCallback(NULL)
+        else:
+            def wrapper(z):
+                callback(z)
+                return 0.0
+            self._callback = Func1(wrapper)
+            self.pfr.setOutputCallback(self._callback.func)
+        self.pfr.solve(length, dz)
+
+    property distance:
+        """ The current axial position [m]. """
+        def __get__(self):
+            return self.pfr.distance()
+
+    property velocity:
+        """ The axial velocity [m/s] at the current position. """
+        def __get__(self):
+            return self.pfr.velocity()
+
+    def coverages(self, n=0):
+        """
+        The coverages of the species of the *n*-th surface at the current
+        position.
+        """
+        if not 0 <= n < self.pfr.nSurfaces():
+            raise IndexError('Surface index {} out of range'.format(n))
+        cdef np.ndarray[np.double_t, ndim=1] theta = \
+            np.empty(self._surfaces[n].n_species)
+        self.pfr.getCoverages(n, &theta[0])
+        return theta
+
+    def __reduce__(self):
+        raise NotImplementedError('PlugFlowReactor object is not picklable')
+
+    def __copy__(self):
+        raise NotImplementedError('PlugFlowReactor object is not copyable')
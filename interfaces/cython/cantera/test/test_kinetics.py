@@ -144,6 +144,52 @@ class TestKinetics(utilities.CanteraTest):
                              self.phase.delta_standard_gibbs)
 
 
+class TestProductionRateDerivatives(utilities.CanteraTest):
+    def setUp(self):
+        gas = ct.Solution('h2o2.xml')
+        # The dependence of the Troe falloff function on the third-body
+        # concentration is not included in the derivatives
+        reactions = [R for R in gas.reactions()
+                     if not isinstance(R, ct.FalloffReaction)]
+        self.gas = ct.Solution(thermo='IdealGas', kinetics='GasKinetics',
+                               species=gas.species(), reactions=reactions)
+        self.gas.TPX = 1400, 2*ct.one_atm, [0.3, 0.02, 0.01, 0.2, 0.01, 0.2,
+                                             0.001, 0.001, 0.3]
+
+    def test_ddC(self):
+        C = self.gas.concentrations
+        wdot0 = self.gas.net_production_rates
+        dwdot = self.gas.net_production_rates_ddC
+        self.assertEqual(dwdot.shape, (self.gas.n_species,) * 2)
+        for j in range(self.gas.n_species):
+            C1 = C.copy()
+            dC = 1e-7 * C[j]
+            C1[j] += dC
+            self.gas.concentrations = C1
+            dwdot_fd = (self.gas.net_production_rates - wdot0) / dC
+            self.gas.concentrations = C
+            scale = max(abs(dwdot[:,j]))
+            self.assertArrayNear(dwdot[:,j], dwdot_fd, 1e-4, 1e-5 * scale)
+
+    def test_ddT(self):
+        T, rho, Y = self.gas.TDY
+        wdot0 = self.gas.net_production_rates
+        dwdot = self.gas.net_production_rates_ddT
+        self.assertNear(self.gas.T, T)
+        self.gas.TDY = T * (1 + 1e-7), rho, Y
+        dwdot_fd = (self.gas.net_production_rates - wdot0) / (T * 1e-7)
+        self.assertArrayNear(dwdot, dwdot_fd, 1e-4, 1e-5 * max(abs(dwdot)))
+
+    def test_falloff(self):
+        # Derivatives are approximate for falloff reactions
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = self.gas.TPX
+        k = gas.species_index('H2O2')
+        dwdot = gas.net_production_rates_ddC
+        self.assertTrue(np.all(np.isfinite(dwdot)))
+        self.assertTrue(dwdot[k,k] < 0)
+
+
 class KineticsFromReactions(utilities.CanteraTest):
     """
     Test for Kinetics objects which are constructed directly from Reaction
@@ -345,6 +391,85 @@ class KineticsRepeatability(utilities.CanteraTest):
         self.check_rates_pressure('pdep-test.xml')
 
 
+class TestStateCaches(utilities.CanteraTest):
+    """
+    Tests to make sure that the arrays cached on temperature, pressure and
+    composition are recomputed when only one of these changes.
+    """
+    props = ['standard_gibbs_RT', 'chemical_potentials',
+             'partial_molar_entropies', 'entropy_mole', 'gibbs_mole',
+             'forward_rate_constants', 'equilibrium_constants',
+             'forward_rates_of_progress', 'reverse_rates_of_progress',
+             'net_rates_of_progress', 'net_production_rates',
+             'viscosity', 'thermal_conductivity', 'mix_diff_coeffs']
+
+    def setUp(self):
+        self.gas = ct.Solution('h2o2.xml')
+        self.X0 = 1 + np.sin(range(1, self.gas.n_species+1))
+        self.X1 = 1 + np.sin(range(2, self.gas.n_species+2))
+        self.gas.TPX = 1200, 2e5, self.X0
+        self.evaluate(self.gas)
+
+    def evaluate(self, gas):
+        return [np.atleast_1d(getattr(gas, name)) for name in self.props]
+
+    def check(self, setter):
+        # 'setter' is applied to the gas object with warm caches and to a
+        # freshly constructed one, which must give the same results
+        setter(self.gas)
+        ref = ct.Solution('h2o2.xml')
+        setter(ref)
+        self.assertNear(self.gas.T, ref.T)
+        self.assertNear(self.gas.P, ref.P)
+        for name, v1, v2 in zip(self.props, self.evaluate(self.gas),
+                                self.evaluate(ref)):
+            self.assertArrayNear(v1, v2, 1e-10, 1e-30, msg=name)
+
+    def test_temperature(self):
+        def setter(gas):
+            gas.TPX = 1200, 2e5, self.X0
+            gas.TP = 1350, None
+        self.check(setter)
+
+    def test_pressure(self):
+        def setter(gas):
+            gas.TPX = 1200, 2e5, self.X0
+            gas.TP = None, 7e5
+        self.check(setter)
+
+    def test_density(self):
+        def setter(gas):
+            gas.TPX = 1200, 2e5, self.X0
+            gas.TD = None, 1.5 * gas.density
+        self.check(setter)
+
+    def test_mole_fractions(self):
+        def setter(gas):
+            gas.TPX = 1200, 2e5, self.X0
+            gas.X = self.X1
+        self.check(setter)
+
+    def test_unnormalized_mass_fractions(self):
+        def setter(gas):
+            gas.TPX = 1200, 2e5, self.X0
+            Y = 1.01 * gas.Y
+            Y[0] += 0.02
+            gas.set_unnormalized_mass_fractions(Y)
+        self.check(setter)
+
+    def test_repeated_states(self):
+        # Returning to a previous state after each kind of change
+        w0 = self.evaluate(self.gas)
+        for change in [lambda gas: setattr(gas, 'TP', (1350, None)),
+                       lambda gas: setattr(gas, 'TP', (None, 7e5)),
+                       lambda gas: setattr(gas, 'X', self.X1)]:
+            change(self.gas)
+            self.evaluate(self.gas)
+            self.gas.TPX = 1200, 2e5, self.X0
+            for name, v1, v2 in zip(self.props, self.evaluate(self.gas), w0):
+                self.assertArrayNear(v1, v2, 1e-10, 1e-30, msg=name)
+
+
 class TestEmptyKinetics(utilities.CanteraTest):
     def test_empty(self):
         gas = ct.Solution('air-no-reactions.xml')
@@ -186,6 +186,32 @@ class TestFreeFlame(utilities.CanteraTest):
         for rhou_j in self.sim.density * self.sim.u:
             self.assertNear(rhou_j, rhou, 1e-4)
 
+    def test_mixture_averaged_reference(self, saveReference=False):
+        # Regression test for the mixture-averaged free flame. The transport
+        # properties at the midpoints are evaluated in a single batch, which
+        # must reproduce the solution obtained by setting the state of the
+        # gas at each midpoint. To re-create the reference file, run
+        # test_mixture_averaged_reference(True) as described for
+        # TestCounterflowPremixedFlame.
+        referenceFile = '../data/FreeFlame-h2-mix.csv'
+        self.create_sim(ct.one_atm, 300, 'H2:1.1, O2:1, AR:5')
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        data = np.empty((self.sim.flame.n_points, self.gas.n_species + 4))
+        data[:,0] = self.sim.grid
+        data[:,1] = self.sim.u
+        data[:,2] = self.sim.V
+        data[:,3] = self.sim.T
+        data[:,4:] = self.sim.Y.T
+
+        if saveReference:
+            np.savetxt(referenceFile, data, '%11.6e', ', ')
+        else:
+            bad = utilities.compareProfiles(referenceFile, data,
+                                            rtol=1e-3, atol=1e-8, xtol=1e-3)
+            self.assertFalse(bad, bad)
+
     # @utilities.unittest.skip('sometimes slow')
     def test_multicomponent(self):
         reactants= 'H2:1.1, O2:1, AR:5.3'
@@ -571,3 +597,74 @@ class TestCounterflowPremixedFlame(utilities.CanteraTest):
             bad = utilities.compareProfiles(self.referenceFile, data,
                                             rtol=1e-2, atol=1e-8, xtol=1e-2)
             self.assertFalse(bad, bad)
+
+
+class PorousBurner(ct.FlameBase):
+    """ A burner-stabilized flow through a porous medium """
+    __slots__ = ('burner', 'flame', 'outlet')
+
+    def __init__(self, gas, grid=None):
+        self.burner = ct.Inlet1D(name='burner', phase=gas)
+        self.outlet = ct.Outlet1D(name='outlet', phase=gas)
+        self.flame = ct.PorousFlow(gas, name='flame')
+        super(PorousBurner, self).__init__(
+            (self.burner, self.flame, self.outlet), gas, grid)
+        self.burner.T = gas.T
+        self.burner.X = gas.X
+
+
+class TestPorousFlowDustyGas(utilities.CanteraTest):
+    # The temperature is held fixed and uniform, so that the total molar
+    # concentration is uniform, and the dusty-gas fluxes approach the
+    # multicomponent fluxes as the Knudsen diffusion coefficients become
+    # large.
+    T = 1000.0
+    comp = 'H2:1.5, O2:1, AR:7'
+
+    def solve(self, transport_model, pore_diameter=None):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = self.T, ct.one_atm, self.comp
+        sim = PorousBurner(gas, np.linspace(0, 0.02, 11))
+        sim.burner.mdot = 0.05
+        sim.flame.pore1 = sim.flame.pore2 = 0.9
+        d = pore_diameter or 1e-2
+        sim.flame.diam1 = sim.flame.diam2 = d
+        sim.transport_model = transport_model
+        if pore_diameter is not None:
+            # With a Bruggeman exponent of 1, the tortuosity is 1 and the
+            # effective binary diffusion coefficients are those of the gas
+            self.dusty = ct.DustyGas('h2o2.xml')
+            sim.flame.set_dusty_gas_transport(self.dusty, bruggeman=1.0)
+            self.assertTrue(sim.flame.dusty_gas_enabled)
+
+        sim.energy_enabled = False
+        locs = [0.0, 1.0]
+        sim.set_profile('T', locs, [self.T, self.T])
+        sim.set_profile('u', locs, [0.05 / gas.density] * 2)
+        for k in range(gas.n_species):
+            sim.set_profile(gas.species_name(k), locs, [gas.Y[k]] * 2)
+        sim.flame.set_steady_tolerances(default=[1.0e-6, 1.0e-12])
+        sim.set_refine_criteria(ratio=3, slope=0.1, curve=0.2)
+        sim.solve(loglevel=0, refine_grid=True)
+        self.assertArrayNear(sim.T, np.full(sim.flame.n_points, self.T))
+
+        data = np.empty((sim.flame.n_points, gas.n_species + 2))
+        data[:,0] = sim.grid
+        data[:,1] = sim.u
+        data[:,2:] = sim.Y.T
+        return data
+
+    def test_large_pores(self):
+        ref = self.solve('Multi')
+        large = self.solve('Mix', pore_diameter=1e-2)
+        bad = utilities.compareProfiles(ref, large, rtol=2e-3, atol=1e-8,
+                                        xtol=2e-3)
+        self.assertFalse(bad, bad)
+
+    def test_small_pores(self):
+        # Knudsen diffusion in small pores slows the diffusion of all species
+        ref = self.solve('Mix', pore_diameter=1e-2)
+        small = self.solve('Mix', pore_diameter=2e-6)
+        bad = utilities.compareProfiles(ref, small, rtol=1e-2, atol=1e-8,
+                                        xtol=1e-2)
+        self.assertTrue(bad)
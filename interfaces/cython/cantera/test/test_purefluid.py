@@ -105,6 +105,34 @@ class TestPureFluid(utilities.CanteraTest):
         self.check_fd_properties(self.water.max_temp*(1-1e-5), 101325,
                                  self.water.max_temp*(1-1e-4), 101325, 1e-2)
 
+    def test_tables(self):
+        tabulated = ct.Water()
+        self.assertFalse(tabulated.use_tables)
+        tabulated.use_tables = True
+        self.assertTrue(tabulated.use_tables)
+
+        for T, P in [(300, 101325), (450, 101325), (500, 5e6), (700, 3e7),
+                     (1200, 2e5)]:
+            self.water.TP = T, P
+            tabulated.TP = T, P
+            self.assertNear(tabulated.density, self.water.density, 1e-7)
+            self.assertNear(tabulated.h, self.water.h, 1e-7)
+
+            tabulated.TP = 400, 101325
+            tabulated.HP = self.water.h, P
+            self.assertNear(tabulated.T, T, 1e-7)
+            tabulated.SP = self.water.s, P
+            self.assertNear(tabulated.T, T, 1e-7)
+
+        for T in [300, 400, 550]:
+            self.water.TX = T, 0.3
+            tabulated.TX = T, 0.3
+            self.assertNear(tabulated.P, self.water.P, 1e-6)
+            self.assertNear(tabulated.density, self.water.density, 1e-6)
+
+        tabulated.use_tables = False
+        self.assertFalse(tabulated.use_tables)
+
     def test_TPX(self):
         self.water.TX = 400, 0.8
         T,P,X = self.water.TPX
@@ -471,3 +499,56 @@ class PureFluidConvergence(utilities.CanteraTest):
         if errors:
             errors += 'Total error count:%s\n' % nErrors
             raise AssertionError(errors)
+
+
+class WaterPropsIAPWSTables(utilities.CanteraTest):
+    @classmethod
+    def setUpClass(cls):
+        cls.exact = ct.WaterPropsIAPWS()
+        cls.tabulated = ct.WaterPropsIAPWS()
+        cls.tabulated.use_tables = True
+        cls.table = cls.tabulated.table_properties
+
+    def test_use_tables(self):
+        self.assertFalse(self.exact.use_tables)
+        self.assertTrue(self.tabulated.use_tables)
+        self.assertLessEqual(self.table['max_density_error'],
+                             self.table['tolerance'])
+        self.assertLessEqual(self.table['max_saturation_error'],
+                             self.table['tolerance'])
+
+    def test_density_sweep(self):
+        # Sweep the temperature and density over the range of the tables,
+        # excluding the two-phase region, and recover the density from the
+        # exact pressure at each state
+        Tc = 647.096
+        rtol = self.table['tolerance']
+        Tmin, Tmax = self.table['T_range']
+        Pmin, Pmax = self.table['P_range']
+        for T in np.linspace(Tmin + 1.0, Tmax - 1.0, 23):
+            if T < Tc:
+                rho_gas = self.exact.density(
+                    T, self.exact.psat(T, 'gas'), 'gas')
+                rho_liq = self.exact.density(
+                    T, self.exact.psat(T, 'liquid'), 'liquid')
+            for rho in np.logspace(-3, np.log10(1050), 31):
+                if T < Tc and rho_gas * 0.99 < rho < rho_liq * 1.01:
+                    continue
+                P = self.exact.pressure(T, rho)
+                if not Pmin < P < Pmax:
+                    continue
+                rho_exact = self.exact.density(T, P, rho_guess=rho)
+                rho_table = self.tabulated.density(T, P, rho_guess=rho)
+                self.assertNear(rho_exact, rho, 1e-6)
+                self.assertNear(rho_table, rho_exact, rtol)
+
+    def test_psat_sweep(self):
+        # With the Newton correction, the saturation pressure is much more
+        # accurate than the interpolated value
+        Tmin = self.table['T_range'][0]
+        for T in np.linspace(Tmin + 0.5, self.table['max_saturation_T'] - 0.5,
+                             37):
+            for phase in ('liquid', 'gas'):
+                p_exact = self.exact.psat(T, phase)
+                p_table = self.tabulated.psat(T, phase)
+                self.assertNear(p_table, p_exact, 1e-6)
@@ -576,6 +576,79 @@ class TestIdealGasReactor(TestReactor):
     reactorClass = ct.IdealGasReactor
 
 
+class TestReactorTemperatureState(TestReactor):
+    @staticmethod
+    def reactorClass(*args, **kwargs):
+        r = ct.Reactor(*args, **kwargs)
+        r.temperature_state = True
+        return r
+
+    def test_temperature_state(self):
+        gas1 = ct.Solution('h2o2.xml')
+        gas2 = ct.Solution('h2o2.xml')
+        for gas in (gas1, gas2):
+            gas.TPX = 1000, 5 * ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        r1 = ct.Reactor(gas1)
+        r2 = self.reactorClass(gas2)
+        self.assertFalse(r1.temperature_state)
+        self.assertTrue(r2.temperature_state)
+        self.assertEqual(r2.component_index('temperature'), 2)
+        with self.assertRaises(IndexError):
+            r2.component_index('int_energy')
+
+        # expansion against a moving wall, with heat loss
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 300, ct.one_atm, 'AR:1.0'
+        env = ct.Reservoir(gas)
+        ct.Wall(env, r1, A=1.0, K=1e-6, U=100)
+        ct.Wall(env, r2, A=1.0, K=1e-6, U=100)
+        net1 = ct.ReactorNet([r1])
+        net2 = ct.ReactorNet([r2])
+        for t in np.linspace(1e-4, 3e-3, 30):
+            net1.advance(t)
+            net2.advance(t)
+            self.assertNear(r1.T, r2.T, 1e-5)
+            self.assertNear(r1.volume, r2.volume, 1e-6)
+            self.assertArrayNear(r1.thermo.Y, r2.thermo.Y, 1e-4, 1e-9)
+
+        for cls in (ct.IdealGasReactor, ct.IdealGasConstPressureReactor):
+            r3 = cls(gas1)
+            self.assertTrue(r3.temperature_state)
+            r3.temperature_state = True
+            self.assertTrue(r3.temperature_state)
+            with self.assertRaises(RuntimeError):
+                r3.temperature_state = False
+
+    def test_temperature_state_nonideal(self):
+        # Redlich-Kwong mixture, where the partial molar internal energies
+        # differ from those of the ideal gas. Mixing with an inlet of a
+        # different composition makes the result depend on them.
+        gas1 = ct.ThermoPhase('co2_h2o_RK.cti')
+        gas2 = ct.ThermoPhase('co2_h2o_RK.cti')
+        gas_in = ct.ThermoPhase('co2_h2o_RK.cti')
+        gas_in.TPX = 400, 100e5, 'CO2:1.0'
+        self.assertNear(np.dot(gas1.X, gas1.partial_molar_int_energies),
+                        gas1.int_energy_mole, 1e-8)
+
+        r1 = ct.Reactor(gas1)
+        r2 = self.reactorClass(gas2)
+        nets = []
+        for r in (r1, r2):
+            inlet = ct.Reservoir(gas_in)
+            outlet = ct.Reservoir(gas_in)
+            ct.MassFlowController(inlet, r, mdot=20.0)
+            ct.Valve(r, outlet, K=1e-4)
+            ct.Wall(outlet, r, A=1.0, U=500)
+            nets.append(ct.ReactorNet([r]))
+
+        for t in np.linspace(0.1, 3.0, 10):
+            for net in nets:
+                net.advance(t)
+            self.assertNear(r1.T, r2.T, 1e-5)
+            self.assertNear(r1.thermo.P, r2.thermo.P, 1e-5)
+            self.assertArrayNear(r1.thermo.Y, r2.thermo.Y, 1e-5, 1e-9)
+
+
 class TestWellStirredReactorIgnition(utilities.CanteraTest):
     """ Ignition (or not) of a well-stirred reactor """
     def setup(self, T0, P0, mdot_fuel, mdot_ox):
@@ -793,6 +866,14 @@ class TestIdealGasConstPressureReactor(TestConstPressureReactor):
     reactorClass = ct.IdealGasConstPressureReactor
 
 
+class TestConstPressureReactorTemperatureState(TestConstPressureReactor):
+    @staticmethod
+    def reactorClass(*args, **kwargs):
+        r = ct.ConstPressureReactor(*args, **kwargs)
+        r.temperature_state = True
+        return r
+
+
 class TestFlowReactor(utilities.CanteraTest):
     def test_nonreacting(self):
         g = ct.Solution('h2o2.xml')
@@ -837,6 +918,127 @@ class TestFlowReactor(utilities.CanteraTest):
             self.assertNear(r.speed, v, 1e-3)
 
 
+class TestPlugFlowReactor(utilities.CanteraTest):
+    def test_nonreacting(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 300, 101325, 'O2:1.0'
+        pfr = ct.PlugFlowReactor(gas, mdot=0.5, area=0.1)
+        u0 = 0.5 / (0.1 * gas.density)
+        pfr.advance(1.0)
+        self.assertNear(pfr.distance, 1.0)
+        self.assertNear(pfr.velocity, u0)
+        self.assertNear(pfr.mass_flow_rate, 0.5)
+        self.assertNear(gas.T, 300)
+        self.assertNear(gas.P, 101325)
+
+    def test_output_stations(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1200, 101325, 'H2:2.0, O2:1.0, AR:4.0'
+        pfr = ct.PlugFlowReactor(gas, mdot=0.1, area=1e-3)
+        z = []
+        T = []
+        def callback(x):
+            z.append(x)
+            T.append(gas.T)
+        pfr.solve(0.25, 0.01, callback)
+        self.assertArrayNear(z, np.linspace(0, 0.25, 26))
+        self.assertNear(pfr.distance, 0.25)
+        self.assertNear(T[0], 1200)
+        self.assertGreater(T[-1], 1500)
+        self.assertNear(pfr.mass_flow_rate, 0.1)
+
+    def test_compare_const_pressure(self):
+        # At low Mach numbers, the temperature as a function of the residence
+        # time is the same as in a constant pressure reactor
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1100, 101325, 'H2:2.0, O2:1.0, AR:4.0'
+        pfr = ct.PlugFlowReactor(gas, mdot=0.01, area=1e-2)
+        pfr.rtol = 1e-9
+        pfr.atol = 1e-16
+        data = []
+        state = {'t': 0.0, 'z': 0.0, 'u': pfr.velocity}
+        def callback(z):
+            # residence time, using the trapezoid rule
+            u = pfr.velocity
+            state['t'] += (z - state['z']) * 0.5 * (1/u + 1/state['u'])
+            state['z'] = z
+            state['u'] = u
+            data.append((state['t'], gas.T))
+        pfr.solve(0.3, 1e-4, callback)
+
+        gas.TPX = 1100, 101325, 'H2:2.0, O2:1.0, AR:4.0'
+        r = ct.IdealGasConstPressureReactor(gas)
+        net = ct.ReactorNet([r])
+        for t, T in data[1::50]:
+            net.advance(t)
+            self.assertNear(r.T, T, 2e-3)
+
+    def test_variable_area(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 300, 101325, 'N2:1.0'
+        area = lambda z: 0.01 * (1 + z)
+        pfr = ct.PlugFlowReactor(gas, mdot=0.01, area=area, energy='off')
+        rho0 = gas.density
+        pfr.advance(1.0)
+        self.assertNear(pfr.area, 0.02)
+        self.assertNear(pfr.mass_flow_rate, 0.01)
+        self.assertNear(pfr.velocity * gas.density, 0.01 / 0.02)
+        self.assertNear(gas.T, 300)
+        # diffuser: the pressure rises slightly as the gas slows down
+        self.assertGreater(gas.P, 101325)
+        self.assertNear(gas.density, rho0, 1e-4)
+
+    def test_surface(self):
+        gas = ct.Solution('ptcombust.xml', 'gas')
+        surf = ct.Interface('ptcombust.xml', 'Pt_surf', [gas])
+        gas.TPX = 900, ct.one_atm, 'CH4:0.095, O2:0.21, AR:0.79'
+        surf.TP = 900, ct.one_atm
+        pfr = ct.PlugFlowReactor(gas, mdot=1e-3, area=1e-4)
+        pfr.add_surface(surf, 1000)
+        self.assertEqual(pfr.surfaces, [surf])
+
+        pfr.advance(1e-3)
+        theta = pfr.coverages(0)
+        self.assertNear(sum(theta), 1.0)
+        self.assertArrayNear(theta, surf.coverages)
+        # quasi-steady coverages
+        sdot = surf.net_production_rates[gas.n_species:]
+        self.assertArrayNear(sdot[1:], np.zeros(len(sdot) - 1), 1e-5, 1e-8)
+        self.assertLess(gas['CH4'].X[0], 0.095 / 1.095)
+        with self.assertRaises(IndexError):
+            pfr.coverages(1)
+
+    def test_callback_error(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 300, 101325, 'O2:1.0'
+        pfr = ct.PlugFlowReactor(gas, mdot=0.5)
+        def callback(z):
+            if z > 0.1:
+                raise ValueError('stop here')
+        with self.assertRaises(ValueError):
+            pfr.solve(1.0, 0.05, callback)
+        self.assertNear(pfr.distance, 0.15)
+
+    def test_area_error(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 300, 101325, 'O2:1.0'
+        def area(z):
+            if z > 0.5:
+                raise ZeroDivisionError('bad area')
+            return 1.0
+        pfr = ct.PlugFlowReactor(gas, mdot=0.5, area=area)
+        with self.assertRaises(ZeroDivisionError):
+            pfr.advance(1.0)
+
+    def test_invalid(self):
+        gas = ct.Solution('h2o2.xml')
+        with self.assertRaises(RuntimeError):
+            ct.PlugFlowReactor(gas, mdot=-1.0)
+        pfr = ct.PlugFlowReactor(gas, mdot=1.0)
+        with self.assertRaises(RuntimeError):
+            pfr.solve(1.0, 0.0)
+
+
 class TestWallKinetics(utilities.CanteraTest):
     def make_reactors(self):
         self.net = ct.ReactorNet()
@@ -938,6 +1140,489 @@ class TestWallKinetics(utilities.CanteraTest):
         self.assertFalse(bool(bad), bad)
 
 
+class TestSparseLinearSolver(utilities.CanteraTest):
+    def make_network(self, solver_type, n_reactors=6):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1100, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        upstream = ct.Reservoir(gas)
+        gas.TPX = 300, ct.one_atm, 'AR:1.0'
+        downstream = ct.Reservoir(gas)
+
+        reactors = []
+        for i in range(n_reactors):
+            g = ct.Solution('h2o2.xml')
+            g.TPX = 1000 + 20 * i, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+            reactors.append(ct.IdealGasReactor(g, volume=0.01))
+
+        ct.MassFlowController(upstream, reactors[0], mdot=0.01)
+        for i in range(n_reactors - 1):
+            ct.Valve(reactors[i], reactors[i+1], K=1e-5)
+            if i % 2 == 0:
+                ct.Wall(reactors[i], reactors[i+1], U=100.0, A=0.1)
+        ct.Valve(reactors[-1], downstream, K=1e-5)
+
+        net = ct.ReactorNet(reactors)
+        net.linear_solver_type = solver_type
+        return net, reactors
+
+    def test_compare_dense(self):
+        net1, reactors1 = self.make_network('DENSE')
+        net2, reactors2 = self.make_network('SPARSE')
+        self.assertEqual(net2.linear_solver_type, 'SPARSE')
+
+        for t in [1e-4, 1e-3, 1e-2]:
+            net1.advance(t)
+            net2.advance(t)
+            for r1, r2 in zip(reactors1, reactors2):
+                self.assertNear(r1.T, r2.T, 1e-5)
+                self.assertNear(r1.thermo.P, r2.thermo.P, 1e-5)
+                self.assertArrayNear(r1.thermo.Y, r2.thermo.Y, 1e-4, 1e-10)
+
+    def test_pressure_controller(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        res1 = ct.Reservoir(gas)
+        res2 = ct.Reservoir(gas)
+        states = []
+        for solver_type in ['DENSE', 'SPARSE']:
+            r1 = ct.IdealGasReactor(gas)
+            r2 = ct.IdealGasReactor(gas)
+            mfc = ct.MassFlowController(res1, r1, mdot=0.1)
+            ct.Valve(r1, r2, K=1e-5)
+            ct.PressureController(r2, res2, master=mfc, K=1e-5)
+            net = ct.ReactorNet([r1, r2])
+            net.linear_solver_type = solver_type
+            net.advance(0.1)
+            states.append(net.get_state())
+        self.assertArrayNear(states[0], states[1], 1e-5, 1e-10)
+
+    def test_invalid_type(self):
+        net = ct.ReactorNet()
+        with self.assertRaises(RuntimeError):
+            net.linear_solver_type = 'FOO'
+        self.assertEqual(net.linear_solver_type, 'DENSE')
+
+
+class TestAnalyticJacobian(utilities.CanteraTest):
+    def integrate(self, reactor_class, analytic, solver_type='DENSE'):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        r1 = reactor_class(gas)
+        gas.TPX = 300, ct.one_atm, 'O2:1.0, AR:4.0'
+        res = ct.Reservoir(gas)
+        r2 = ct.Reactor(gas)
+        ct.Wall(r1, res, U=50.0, A=0.1)
+        ct.Wall(r1, r2, U=20.0, A=0.1)
+        net = ct.ReactorNet([r1, r2])
+        net.analytic_jacobian = analytic
+        net.linear_solver_type = solver_type
+        self.assertEqual(net.analytic_jacobian, analytic)
+
+        states = []
+        for t in np.linspace(2e-4, 4e-3, 20):
+            net.advance(t)
+            states.append(np.hstack([r1.T, r1.thermo.Y, r2.T]))
+        return np.array(states)
+
+    def check(self, reactor_class):
+        ref = self.integrate(reactor_class, False)
+        for analytic, solver_type in [(True, 'DENSE'), (True, 'SPARSE'),
+                                      (False, 'GMRES')]:
+            states = self.integrate(reactor_class, analytic, solver_type)
+            self.assertArrayNear(ref, states, 1e-4, 1e-9)
+
+    def test_ideal_gas_reactor(self):
+        self.check(ct.IdealGasReactor)
+
+    def test_ideal_gas_const_pressure_reactor(self):
+        self.check(ct.IdealGasConstPressureReactor)
+
+    def test_unsupported_reactor(self):
+        self.check(ct.Reactor)
+
+    def test_gmres_large_mechanism(self):
+        states = []
+        for solver_type in ['DENSE', 'GMRES']:
+            gas = ct.Solution('gri30.xml')
+            gas.TPX = 1200, ct.one_atm, 'CH4:1.0, O2:2.0, N2:7.52'
+            r = ct.IdealGasConstPressureReactor(gas)
+            net = ct.ReactorNet([r])
+            net.linear_solver_type = solver_type
+            self.assertEqual(net.linear_solver_type, solver_type)
+            net.advance(0.05)
+            states.append(np.hstack([r.T, r.thermo.Y]))
+        self.assertArrayNear(states[0], states[1], 1e-4, 1e-9)
+
+
+class TestReactorEnsemble(utilities.CanteraTest):
+    def setUp(self):
+        self.ens = ct.ReactorEnsemble('h2o2.xml')
+        self.ens.end_time = 2e-3
+        self.T0 = np.array([950.0, 1000.0, 1050.0, 1100.0, 1150.0])
+        self.X0 = 'H2:2.0, O2:1.0, AR:4.0'
+
+    def integrate(self, T0, reactor_class=ct.IdealGasReactor):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = T0, ct.one_atm, self.X0
+        r = reactor_class(gas)
+        net = ct.ReactorNet([r])
+        net.advance(self.ens.end_time)
+        return np.hstack([r.T, r.thermo.P, r.thermo.Y])
+
+    def test_final_states(self):
+        self.ens.n_threads = 2
+        self.assertEqual(self.ens.n_threads, 2)
+        self.ens.solve(self.T0, ct.one_atm, self.X0)
+        self.assertEqual(self.ens.n_cases, len(self.T0))
+        states = self.ens.final_states
+        self.assertEqual(states.shape, (len(self.T0), 11))
+        for i, T in enumerate(self.T0):
+            self.assertArrayNear(states[i], self.integrate(T), 1e-5, 1e-10)
+        self.assertEqual(self.ens.errors, [''] * len(self.T0))
+
+    def test_reactor_type(self):
+        self.ens.reactor_type = 'IdealGasConstPressureReactor'
+        self.assertEqual(self.ens.reactor_type, 'IdealGasConstPressureReactor')
+        self.ens.solve(self.T0[:2], ct.one_atm, self.X0)
+        for i, T in enumerate(self.T0[:2]):
+            self.assertArrayNear(self.ens.final_states[i],
+                                 self.integrate(T, ct.IdealGasConstPressureReactor),
+                                 1e-5, 1e-10)
+        with self.assertRaises(RuntimeError):
+            self.ens.reactor_type = 'Reservoir'
+
+    def test_ignition_delays(self):
+        self.ens.solve(self.T0, ct.one_atm, self.X0)
+        tau_T = self.ens.ignition_delays
+        self.assertTrue(all(np.diff(tau_T) < 0))
+
+        self.ens.set_ignition_criterion('max-dTdt')
+        self.ens.solve(self.T0, ct.one_atm, self.X0)
+        tau_slope = self.ens.ignition_delays
+
+        self.ens.set_ignition_criterion('max-species', species='OH')
+        self.ens.solve(self.T0, ct.one_atm, self.X0)
+        tau_OH = self.ens.ignition_delays
+
+        # For this mixture, all of the criteria are close to each other
+        self.assertArrayNear(tau_T, tau_slope, 0.1)
+        self.assertArrayNear(tau_T, tau_OH, 0.1)
+
+        # compare with ignition delays found by stepping the integrator
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = self.T0[2], ct.one_atm, self.X0
+        r = ct.IdealGasReactor(gas)
+        net = ct.ReactorNet([r])
+        while r.T < self.T0[2] + 400:
+            net.step()
+        self.assertNear(tau_T[2], net.time, 0.02)
+
+        with self.assertRaises(RuntimeError):
+            self.ens.set_ignition_criterion('max-species', species='XX')
+        with self.assertRaises(RuntimeError):
+            self.ens.set_ignition_criterion('foo')
+
+    def test_no_ignition(self):
+        self.ens.end_time = 1e-5
+        self.ens.solve(self.T0[:2], ct.one_atm, self.X0)
+        self.assertTrue(all(np.isnan(self.ens.ignition_delays)))
+
+    def test_histories(self):
+        self.ens.output_times = [0, 5e-4, 1e-3, 2e-3]
+        self.ens.solve(self.T0[:3], ct.one_atm, self.X0)
+        H = self.ens.histories
+        self.assertEqual(H.shape, (3, 4, 11))
+        self.assertArrayNear(H[:,0,0], self.T0[:3])
+        self.assertArrayNear(H[:,-1], self.ens.final_states, 1e-5, 1e-10)
+
+        self.ens.output_times = [0, 1e-3, 3e-3]
+        with self.assertRaises(RuntimeError):
+            self.ens.solve(self.T0, ct.one_atm, self.X0)
+        with self.assertRaises(RuntimeError):
+            self.ens.output_times = [1e-3, 0]
+
+    def test_compositions(self):
+        X = [self.X0, {'H2': 2.0, 'O2': 1.0, 'AR': 4.0}, 'H2:1.0, O2:1.0']
+        self.ens.solve(1100, ct.one_atm, X)
+        states = self.ens.final_states
+        self.assertArrayNear(states[0], self.integrate(1100), 1e-5, 1e-10)
+        self.assertArrayNear(states[0], states[1])
+        self.assertNear(sum(states[2,2:]), 1.0)
+        with self.assertRaises(ValueError):
+            self.ens.solve([1000, 1100], ct.one_atm, X)
+
+
+class TestReactorEvents(utilities.CanteraTest):
+    def setUp(self):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        self.r = ct.IdealGasReactor(self.gas)
+        self.net = ct.ReactorNet([self.r])
+
+    def test_threshold(self):
+        event = ct.ThresholdEvent(self.r, 'temperature', 1400)
+        self.assertEqual(event.direction, 1)
+        self.assertTrue(event.terminal)
+        self.assertEqual(event.component, 'temperature')
+        self.net.add_event(event)
+        self.net.advance(1.0)
+        self.assertIs(self.net.last_event, event)
+        self.assertNear(self.r.T, 1400, 1e-6)
+        self.assertEqual(len(event.times), 1)
+        self.assertNear(event.times[0], self.net.time)
+        t_event = self.net.time
+
+        # compare with the time found by stepping the integrator
+        self.gas.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        r = ct.IdealGasReactor(self.gas)
+        net = ct.ReactorNet([r])
+        while r.T < 1400:
+            t_prev = net.time
+            net.step()
+        self.assertTrue(t_prev <= t_event <= net.time)
+
+        # The integration can be continued past the event
+        self.net.advance(t_event + 1e-4)
+        self.assertIsNone(self.net.last_event)
+        self.assertNear(self.net.time, t_event + 1e-4)
+        self.assertGreater(self.r.T, 1400)
+
+    def test_step(self):
+        event = ct.ThresholdEvent(self.r, 'temperature', 1400)
+        self.net.add_event(event)
+        while self.net.last_event is None:
+            self.net.step()
+            self.assertLessEqual(self.r.T, 1400 + 1e-6)
+        self.assertNear(self.r.T, 1400, 1e-6)
+
+    def test_peak(self):
+        event = ct.PeakEvent(self.r, 'OH')
+        self.net.add_event(event)
+        self.net.advance(1.0)
+        self.assertIs(self.net.last_event, event)
+        Y_peak = self.r.thermo['OH'].Y[0]
+        t_peak = self.net.time
+        for t in np.linspace(0.5, 1.5, 5) * t_peak:
+            self.gas.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+            r = ct.IdealGasReactor(self.gas)
+            net = ct.ReactorNet([r])
+            net.advance(t)
+            self.assertLessEqual(r.thermo['OH'].Y[0], Y_peak * (1 + 1e-6))
+
+    def test_max_rate(self):
+        threshold = ct.ThresholdEvent(self.r, 'temperature', 1400,
+                                      terminal=False)
+        event = ct.MaxRateEvent(self.r, 'temperature')
+        self.net.add_event(threshold)
+        self.net.add_event(event)
+        self.net.advance(1.0)
+        self.assertIs(self.net.last_event, event)
+        # The temperature rises fastest close to the middle of the rise
+        self.assertGreater(self.r.T, 1200)
+        self.assertLess(self.r.T, 2200)
+        self.assertAlmostEqual(self.net.time / threshold.times[0], 1.0,
+                               places=1)
+
+    def test_func1(self):
+        event = ct.Func1Event(lambda T: T - 1400, self.r, 'temperature')
+        self.assertEqual(event.direction, 0)
+        self.net.add_event(event)
+        self.net.advance(1.0)
+        self.assertIs(self.net.last_event, event)
+        self.assertNear(self.r.T, 1400, 1e-6)
+
+    def test_non_terminal(self):
+        events = [ct.ThresholdEvent(self.r, 'temperature', T, terminal=False)
+                  for T in (1100, 1400, 1700)]
+        for event in events:
+            self.net.add_event(event)
+        self.net.advance(1e-3)
+        self.assertIsNone(self.net.last_event)
+        self.assertNear(self.net.time, 1e-3)
+        times = [event.times[0] for event in events]
+        self.assertTrue(all(np.diff(times) > 0))
+
+        # event times are cleared when the network is reinitialized
+        self.net.set_initial_time(0)
+        self.net.reinitialize()
+        self.assertEqual(len(events[0].times), 0)
+
+    def test_direction(self):
+        event = ct.ThresholdEvent(self.r, 'temperature', 1400, direction=-1)
+        self.assertEqual(event.direction, -1)
+        self.net.add_event(event)
+        self.net.advance(1e-3)
+        self.assertIsNone(self.net.last_event)
+        self.assertEqual(len(event.times), 0)
+
+    def test_callback_error(self):
+        def fail(T):
+            if T > 1200:
+                raise ZeroDivisionError('bad event')
+            return T - 2000
+        self.net.add_event(ct.Func1Event(fail, self.r, 'temperature'))
+        with self.assertRaises(ZeroDivisionError):
+            self.net.advance(1.0)
+
+    def test_bad_event(self):
+        with self.assertRaises(RuntimeError):
+            self.net.add_event(ct.ThresholdEvent(self.r, 'XX', 1400))
+            self.net.advance(1.0)
+
+        gas2 = ct.Solution('h2o2.xml')
+        r2 = ct.IdealGasReactor(gas2)
+        net = ct.ReactorNet([self.r])
+        net.add_event(ct.PeakEvent(r2, 'OH'))
+        with self.assertRaises(RuntimeError):
+            net.advance(1.0)
+
+
+class TestReactorCheckpoint(utilities.CanteraTest):
+    def make_network(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        r = ct.IdealGasReactor(gas)
+        net = ct.ReactorNet([r])
+        return gas, r, net
+
+    def test_restore_same_network(self):
+        gas, r, net = self.make_network()
+        net.advance(1e-4)
+        T1 = r.T
+        Y1 = gas.Y
+        checkpoint = net.save_checkpoint()
+        self.assertIsInstance(checkpoint, bytes)
+        net.advance(5e-4)
+        T2 = r.T
+
+        net.restore_checkpoint(checkpoint)
+        self.assertNear(net.time, 1e-4)
+        self.assertNear(r.T, T1, 1e-14)
+        self.assertArrayNear(gas.Y, Y1, 1e-14)
+        net.advance(5e-4)
+        self.assertNear(r.T, T2, 1e-6)
+
+    def test_fork(self):
+        gas, r, net = self.make_network()
+        net.advance(1e-4)
+        checkpoint = net.save_checkpoint()
+        net.advance(5e-4)
+
+        gas2, r2, net2 = self.make_network()
+        net2.restore_checkpoint(checkpoint)
+        self.assertNear(net2.time, 1e-4)
+        net2.advance(5e-4)
+        self.assertNear(r2.T, r.T, 1e-6)
+        self.assertArrayNear(gas2.Y, gas.Y, 1e-6, 1e-12)
+
+        # Restarting from the checkpoint takes fewer steps than starting a new
+        # integration from the same state, since the step size is restored
+        gas3, r3, net3 = self.make_network()
+        net3.restore_checkpoint(checkpoint)
+        n_restored = 0
+        while net3.time < 2e-4:
+            net3.step()
+            n_restored += 1
+        net3.restore_checkpoint(checkpoint)
+        net3.set_initial_time(1e-4)
+        n_new = 0
+        while net3.time < 2e-4:
+            net3.step()
+            n_new += 1
+        self.assertLess(n_restored, n_new)
+
+    def test_sensitivities(self):
+        gas, r, net = self.make_network()
+        r.add_sensitivity_reaction(2)
+        net.advance(1e-4)
+        S1 = net.sensitivity('temperature', 0)
+        checkpoint = net.save_checkpoint()
+        net.advance(2e-4)
+        S2 = net.sensitivity('temperature', 0)
+
+        gas2, r2, net2 = self.make_network()
+        r2.add_sensitivity_reaction(2)
+        net2.restore_checkpoint(checkpoint)
+        self.assertNear(net2.sensitivity('temperature', 0), S1)
+        net2.advance(2e-4)
+        self.assertNear(net2.sensitivity('temperature', 0), S2, 1e-3)
+
+    def test_events(self):
+        gas, r, net = self.make_network()
+        event = ct.ThresholdEvent(r, 'temperature', 1200, terminal=False)
+        net.add_event(event)
+        net.advance(1.0)
+        self.assertEqual(len(event.times), 1)
+        checkpoint = net.save_checkpoint()
+
+        gas2, r2, net2 = self.make_network()
+        event2 = ct.ThresholdEvent(r2, 'temperature', 1200, terminal=False)
+        net2.add_event(event2)
+        net2.restore_checkpoint(checkpoint)
+        self.assertArrayNear(event2.times, event.times)
+
+    def test_mismatch(self):
+        gas, r, net = self.make_network()
+        net.advance(1e-4)
+        checkpoint = net.save_checkpoint()
+
+        gas2 = ct.Solution('gri30.xml')
+        gas2.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        net2 = ct.ReactorNet([ct.IdealGasReactor(gas2)])
+        with self.assertRaises(RuntimeError):
+            net2.restore_checkpoint(checkpoint)
+        with self.assertRaises(RuntimeError):
+            net.restore_checkpoint(checkpoint[:-8])
+        with self.assertRaises(RuntimeError):
+            net.restore_checkpoint(b'junk')
+
+    def test_state_view(self):
+        gas, r, net = self.make_network()
+        view = net.state_view
+        self.assertEqual(len(view), net.n_vars)
+        self.assertFalse(np.asarray(view).flags.writeable)
+        self.assertArrayNear(view, net.get_state())
+        net.advance(1e-4)
+        # The view is updated in place
+        self.assertTrue(view.valid)
+        self.assertArrayNear(view, net.get_state())
+        self.assertNear(view[2], r.T)
+        del net
+        self.assertNear(view[2], r.T)
+
+    def test_state_view_invalidated(self):
+        gas, r, net = self.make_network()
+        view = net.state_view
+        net.advance(1e-4)
+
+        # Changing the integrator settings re-initializes the network, which
+        # may reallocate the state vector
+        net.max_time_step = 1e-5
+        net.advance(2e-4)
+        self.assertFalse(view.valid)
+        with self.assertRaises(RuntimeError):
+            view[0]
+        with self.assertRaises(RuntimeError):
+            np.asarray(view)
+        with self.assertRaises(RuntimeError):
+            len(view)
+
+        view = net.state_view
+        self.assertEqual(len(view), net.n_vars)
+        self.assertArrayNear(view, net.get_state())
+
+        # In the operator-split mode, the state is held by the network
+        # rather than the integrator
+        net.splitting = True
+        net.split_time_step = 1e-5
+        net.advance(3e-4)
+        self.assertFalse(view.valid)
+        with self.assertRaises(RuntimeError):
+            view[0]
+        view = net.state_view
+        self.assertArrayNear(view, net.get_state())
+
+
 class TestReactorSensitivities(utilities.CanteraTest):
     def test_sensitivities1(self):
         net = ct.ReactorNet()
@@ -1188,6 +1873,246 @@ class TestReactorSensitivities(utilities.CanteraTest):
                 self.assertArrayNear(S[a][:,i], S[b][:,j], 1e-2, 1e-3)
 
 
+class TestAdjointSensitivities(utilities.CanteraTest):
+    def setup_reactor(self, reactions=(0, 1, 2, 3),
+                      X='H2:2.0, O2:1.0, AR:4.0'):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 1000, ct.one_atm, X
+        self.r1 = ct.IdealGasReactor(self.gas)
+        self.net = ct.ReactorNet([self.r1])
+        for k in reactions:
+            self.r1.add_sensitivity_reaction(k)
+        self.net.rtol = 1e-10
+        self.net.atol = 1e-16
+        self.net.rtol_sensitivity = 1e-7
+        self.net.atol_sensitivity = 1e-8
+
+    def test_final_temperature(self):
+        self.setup_reactor()
+        T0, S = self.net.solve_adjoint('final', 'temperature', 2e-4)
+        self.assertNear(self.net.time, 2e-4)
+        self.assertNear(T0, self.r1.T, 1e-8)
+
+        self.setup_reactor()
+        self.net.advance(2e-4)
+        for p in range(4):
+            self.assertNear(S[p], self.net.sensitivity('temperature', p),
+                            1e-2, 1e-3)
+
+    def test_species_enthalpy(self):
+        self.setup_reactor((0,))
+        self.r1.add_sensitivity_species_enthalpy('OH')
+        self.r1.add_sensitivity_species_enthalpy(self.gas.species_index('HO2'))
+        self.assertIn('OH enthalpy', self.net.sensitivity_parameter_name(1))
+        Y, S = self.net.solve_adjoint('final', 'H2O', 2e-4)
+
+        self.setup_reactor((0,))
+        self.r1.add_sensitivity_species_enthalpy('OH')
+        self.r1.add_sensitivity_species_enthalpy('HO2')
+        self.net.advance(2e-4)
+        self.assertNear(Y, self.r1.Y[self.gas.species_index('H2O')], 1e-8)
+        for p in range(3):
+            self.assertNear(S[p], self.net.sensitivity('H2O', p), 1e-2, 1e-3)
+
+        # The thermo data is restored after the integration
+        self.gas.TP = 1000, ct.one_atm
+        gas2 = ct.Solution('h2o2.xml')
+        gas2.TP = 1000, ct.one_atm
+        self.assertArrayNear(self.gas.standard_enthalpies_RT,
+                             gas2.standard_enthalpies_RT)
+
+    def test_ignition_delay(self):
+        self.setup_reactor((0, 1))
+        tau, S = self.net.solve_adjoint('crossing', 'temperature', 0.1,
+                                        threshold=1400.0)
+        self.assertNear(self.net.time, tau)
+        self.assertNear(self.r1.T, 1400.0, 1e-6)
+
+        def get_tau(multipliers):
+            gas = ct.Solution('h2o2.xml')
+            gas.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+            for k, m in enumerate(multipliers):
+                gas.set_multiplier(m, k)
+            r = ct.IdealGasReactor(gas)
+            net = ct.ReactorNet([r])
+            net.rtol = 1e-10
+            net.atol = 1e-16
+            t, T = [0.0], [r.T]
+            while T[-1] < 1400.0:
+                t.append(net.step())
+                T.append(r.T)
+            return np.interp(1400.0, T[-2:], t[-2:])
+
+        tau0 = get_tau([1.0, 1.0])
+        self.assertNear(tau, tau0, 1e-3)
+        dp = 1e-3
+        for p in range(2):
+            m = [1.0, 1.0]
+            m[p] += dp
+            Sfd = (get_tau(m) - tau0) / (tau0 * dp)
+            self.assertNear(S[p], Sfd, 2e-2, 1e-3)
+
+    def test_integral(self):
+        self.setup_reactor((0, 1))
+        I, S = self.net.solve_adjoint('integral', 'OH', 2e-4)
+        self.assertTrue(I > 0)
+        self.assertEqual(len(S), 2)
+        self.assertTrue(all(np.isfinite(S)))
+
+    def test_heat_transfer_coeff(self):
+        def setup():
+            gas1 = ct.Solution('h2o2.xml')
+            gas1.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+            gas2 = ct.Solution('h2o2.xml')
+            gas2.TPX = 600, ct.one_atm, 'AR:1.0'
+            r1 = ct.IdealGasReactor(gas1)
+            r2 = ct.IdealGasReactor(gas2)
+            net = ct.ReactorNet([r1, r2])
+            w = ct.Wall(r1, r2, A=1.0, U=500.0)
+            w.add_sensitivity_heat_transfer_coeff()
+            r1.add_sensitivity_reaction(0)
+            net.rtol = 1e-10
+            net.atol = 1e-16
+            net.rtol_sensitivity = 1e-7
+            net.atol_sensitivity = 1e-8
+            return net
+
+        net = setup()
+        self.assertIn('heat transfer coefficient',
+                      net.sensitivity_parameter_name(0))
+        T, S = net.solve_adjoint('final', 'temperature', 5e-4, r=1)
+
+        net = setup()
+        net.advance(5e-4)
+        for p in range(2):
+            self.assertNear(S[p], net.sensitivity('temperature', p, 1),
+                            1e-2, 1e-3)
+
+    def test_zero_functional(self):
+        # Argon is inert and initially absent, so both functionals are zero
+        for kind in ('final', 'integral'):
+            self.setup_reactor((0,), X='H2:2.0, O2:1.0')
+            with self.assertRaises(RuntimeError) as cm:
+                self.net.solve_adjoint(kind, 'AR', 1e-4)
+            self.assertIn('is zero', str(cm.exception))
+            # The network is left at the end time and can be advanced
+            self.assertNear(self.net.time, 1e-4)
+            self.net.advance(2e-4)
+            self.assertNear(self.net.time, 2e-4)
+
+    def test_invalid(self):
+        self.setup_reactor((0,))
+        with self.assertRaises(RuntimeError):
+            self.net.solve_adjoint('maximum', 'temperature', 1e-3)
+        with self.assertRaises(RuntimeError):
+            self.net.solve_adjoint('final', 'spam', 1e-3)
+        with self.assertRaises(RuntimeError):
+            self.net.solve_adjoint('crossing', 'temperature', 1e-8,
+                                   threshold=1400.0)
+
+
+class TestOperatorSplitting(utilities.CanteraTest):
+    def make_network(self, n_reactors=4, shared=False, loop=False):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1000, ct.one_atm, 'H2:2.0, O2:1.0, AR:4.0'
+        upstream = ct.Reservoir(gas)
+        gas_out = ct.Solution('h2o2.xml')
+        gas_out.TPX = 300, ct.one_atm, 'AR:1.0'
+        downstream = ct.Reservoir(gas_out)
+
+        reactors = []
+        for i in range(n_reactors):
+            if not shared:
+                gas = ct.Solution('h2o2.xml')
+            gas.TPX = 1000, ct.one_atm, 'AR:1.0'
+            reactors.append(ct.IdealGasReactor(gas, volume=1e-3))
+
+        mfc = ct.MassFlowController(upstream, reactors[0], mdot=0.005)
+        for r1, r2 in zip(reactors[:-1], reactors[1:]):
+            ct.Valve(r1, r2, K=1e-5)
+        ct.Valve(reactors[-1], downstream, K=1e-5)
+        if loop:
+            recycle = ct.MassFlowController(reactors[-1], reactors[0],
+                                            mdot=0.001)
+            ct.PressureController(reactors[0], reactors[1], master=recycle,
+                                  K=1e-5)
+
+        net = ct.ReactorNet(reactors)
+        net.rtol = 1e-9
+        net.atol = 1e-15
+        return reactors, net
+
+    def compare(self, t_end, **kwargs):
+        reactors, net = self.make_network(**kwargs)
+        net.advance(t_end)
+        T_ref = [r.T for r in reactors]
+        Y_ref = [r.Y for r in reactors]
+
+        reactors, net = self.make_network(**kwargs)
+        net.splitting = True
+        net.split_time_step = 2e-5
+        net.n_threads = 2
+        net.advance(t_end)
+        self.assertNear(net.time, t_end)
+        for r, T, Y in zip(reactors, T_ref, Y_ref):
+            self.assertNear(r.T, T, 2e-3)
+            self.assertArrayNear(r.Y, Y, 1e-2, 1e-5)
+        return net
+
+    def test_chain(self):
+        self.compare(5e-3)
+
+    def test_shared_contents(self):
+        self.compare(5e-3, n_reactors=3, shared=True)
+
+    def test_recirculation(self):
+        self.compare(5e-3, loop=True)
+
+    def test_properties(self):
+        reactors, net = self.make_network(n_reactors=2)
+        self.assertFalse(net.splitting)
+        net.splitting = True
+        self.assertTrue(net.splitting)
+        net.split_time_step = 1e-3
+        self.assertNear(net.split_time_step, 1e-3)
+        net.split_rtol = 1e-5
+        net.split_atol = 1e-10
+        self.assertNear(net.split_rtol, 1e-5)
+        self.assertNear(net.split_atol, 1e-10)
+        net.n_threads = 3
+        self.assertEqual(net.n_threads, 3)
+        self.assertTrue(np.isnan(net.split_error))
+        with self.assertRaises(RuntimeError):
+            net.split_time_step = 0.0
+
+        t = net.step()
+        self.assertNear(t, 1e-3)
+        self.assertArrayNear(net.get_state(), net.state_view)
+
+    def test_error_control(self):
+        reactors, net = self.make_network(n_reactors=2)
+        net.splitting = True
+        net.split_time_step = 1e-3
+        net.split_rtol = 1e-3
+        net.split_atol = 1e-8
+        net.split_error_check_interval = 1
+        net.advance(2e-3)
+        self.assertNear(net.time, 2e-3)
+        self.assertTrue(net.split_error <= 1.0)
+
+    def test_unsupported(self):
+        reactors, net = self.make_network(n_reactors=2)
+        net.splitting = True
+        reactors[0].add_sensitivity_reaction(0)
+        with self.assertRaises(RuntimeError):
+            net.advance(1e-4)
+
+        reactors, net = self.make_network(n_reactors=2)
+        net.splitting = True
+        with self.assertRaises(RuntimeError):
+            net.save_checkpoint()
+
+
 class CombustorTestImplementation(object):
     """
     These tests are based on the sample:
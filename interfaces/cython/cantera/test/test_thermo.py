@@ -871,6 +871,40 @@ class TestSpecies(utilities.CanteraTest):
         self.assertEqual({sp.name for sp in S},
                          set(self.gas.species_names))
 
+    def test_modify_Hf298_shared(self):
+        # Both phases and the Species objects share the same parameterizations
+        S = ct.Species.listFromFile('h2o2.xml')
+        gas1 = ct.ThermoPhase(thermo='IdealGas', species=S)
+        gas2 = ct.ThermoPhase(thermo='IdealGas', species=S)
+        gas1.TP = gas2.TP = 298.15, ct.one_atm
+        k = gas1.species_index('H2O')
+        spec = S[[sp.name for sp in S].index('H2O')]
+        h0 = gas1.species_Hf298(k)
+        self.assertNear(spec.thermo.h(298.15), h0)
+
+        def check(gas, Hf):
+            RT = ct.gas_constant * gas.T
+            self.assertNear(gas.species_Hf298(k), Hf)
+            self.assertNear(gas.standard_enthalpies_RT[k] * RT, Hf)
+            self.assertNear(gas.species(k).thermo.h(298.15), Hf)
+
+        # The first modification replaces the shared parameterization with a
+        # copy, and later ones modify that copy
+        for dH in (1e7, -1e7):
+            gas1.modify_species_Hf298(k, h0 + dH)
+            check(gas1, h0 + dH)
+            check(gas2, h0)
+            self.assertNear(spec.thermo.h(298.15), h0)
+
+        gas2.modify_species_Hf298('H2O', h0 + 2e7)
+        check(gas2, h0 + 2e7)
+        check(gas1, h0 - 1e7)
+        self.assertNear(spec.thermo.h(298.15), h0)
+
+        # Other species are not affected
+        for j in range(gas1.n_species):
+            if j != k:
+                self.assertNear(gas1.species_Hf298(j), gas2.species_Hf298(j))
 
 
 class TestSpeciesThermo(utilities.CanteraTest):
@@ -1005,6 +1039,112 @@ class TestQuantity(utilities.CanteraTest):
             q1+q2
 
 
+class TestRedlichKwong(utilities.CanteraTest):
+    def setUp(self):
+        self.gas = ct.ThermoPhase('co2_h2o_RK.cti')
+
+    def check_densities(self, gas, T, P):
+        X = gas.X
+        rho = gas.densities_TP(T, P)
+        ref = ct.ThermoPhase('co2_h2o_RK.cti')
+        for i in range(len(T)):
+            ref.TPX = T[i], P[i], X
+            self.assertNear(rho[i], ref.density, 1e-10)
+
+    def test_densities_TP(self):
+        T = np.array([700, 700, 800, 900, 1000, 1200, 600])
+        P = np.array([1e5, 5e6, 1e7, 2e7, 5e7, 1e6, 2e6])
+        self.gas.TPX = 600, 1e7, 'CO2:0.8, H2O:0.2'
+        state = self.gas.TDX
+        self.check_densities(self.gas, T, P)
+
+        # The state of the phase is unchanged
+        self.assertNear(self.gas.T, state[0])
+        self.assertNear(self.gas.density, state[1])
+
+        self.gas.basis = 'molar'
+        rho_molar = self.gas.densities_TP(T, P)
+        self.gas.basis = 'mass'
+        self.assertArrayNear(rho_molar * self.gas.mean_molecular_weight,
+                             self.gas.densities_TP(T, P))
+
+        with self.assertRaises(ValueError):
+            self.gas.densities_TP(T, P, phase='plasma')
+
+        with self.assertRaises(TypeError):
+            ct.Solution('h2o2.xml').densities_TP(T, P)
+
+    def test_composition_change(self):
+        # The mixing parameters and critical properties are cached on the
+        # composition, and must be recomputed after a change of composition
+        # alone
+        T = np.array([700, 900, 1100])
+        P = np.array([5e6, 1e7, 2e7])
+        gas = self.gas
+        gas.TPX = 700, 1e7, 'CO2:0.8, H2O:0.2'
+        Tc1 = gas.critical_temperature
+        Pc1 = gas.critical_pressure
+        rho1 = gas.densities_TP(T, P)
+
+        ref = ct.ThermoPhase('co2_h2o_RK.cti')
+        for setter in ('X', 'Y', 'NoNorm'):
+            comp = [0.3, 0.7] if setter != 'NoNorm' else [0.35, 0.6]
+            if setter == 'X':
+                gas.X = comp
+            elif setter == 'Y':
+                gas.Y = comp
+            else:
+                gas.set_unnormalized_mass_fractions(comp)
+            ref.TPX = 700, 1e7, gas.X
+
+            self.assertNotEqual(gas.critical_temperature, Tc1)
+            self.assertNear(gas.critical_temperature,
+                            ref.critical_temperature)
+            self.assertNear(gas.critical_pressure, ref.critical_pressure)
+            rho2 = gas.densities_TP(T, P)
+            self.assertArrayNear(rho2, ref.densities_TP(T, P))
+            self.assertFalse(np.allclose(rho1, rho2))
+            self.check_densities(gas, T, P)
+
+            gas.TPX = 700, 1e7, 'CO2:0.8, H2O:0.2'
+            self.assertNear(gas.critical_temperature, Tc1)
+            self.assertNear(gas.critical_pressure, Pc1)
+            self.assertArrayNear(gas.densities_TP(T, P), rho1)
+
+
+class TestHKFTStandardStates(utilities.CanteraTest):
+    def test_water_hkft_manager(self):
+        # The standard states of the HKFT species evaluated together by
+        # VPSSMgr_Water_HKFT should match those evaluated one species at a
+        # time by PDSS_HKFT (through VPSSMgr_General)
+        fast = ct.ThermoPhase('HMW_NaCl_HKFT.xml', 'NaCl_electrolyte')
+        ref = ct.ThermoPhase('HMW_NaCl_HKFT.xml', 'NaCl_electrolyte_general')
+        states = [(T, P) for T in (273.15, 298.15, 323.15, 353.15)
+                  for P in (ct.one_atm, 100e5, 500e5)]
+        states += [(T, P) for T in (398.15, 448.15, 498.15, 548.15)
+                   for P in (100e5, 300e5, 1000e5)]
+        for T, P in states:
+            fast.TP = T, P
+            ref.TP = T, P
+            self.assertArrayNear(fast.standard_gibbs_RT,
+                                 ref.standard_gibbs_RT, 1e-8, 1e-8)
+            self.assertArrayNear(fast.standard_enthalpies_RT,
+                                 ref.standard_enthalpies_RT, 1e-8, 1e-8)
+            self.assertArrayNear(fast.standard_entropies_R,
+                                 ref.standard_entropies_R, 1e-8, 1e-8)
+            self.assertArrayNear(fast.standard_cp_R,
+                                 ref.standard_cp_R, 1e-8, 1e-8)
+            self.assertArrayNear(fast.standard_volumes,
+                                 ref.standard_volumes, 1e-8, 1e-10)
+
+        # Returning to an earlier state after the sweep
+        fast.TP = 298.15, ct.one_atm
+        ref.TP = 298.15, ct.one_atm
+        self.assertArrayNear(fast.standard_cp_R, ref.standard_cp_R, 1e-8, 1e-8)
+        self.assertArrayNear(fast.standard_volumes, ref.standard_volumes,
+                             1e-8, 1e-10)
+
+
 class TestMisc(utilities.CanteraTest):
     def test_stringify_bad(self):
         with self.assertRaises(AttributeError):
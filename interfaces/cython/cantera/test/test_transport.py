@@ -1,5 +1,8 @@
 from .utilities import unittest
 import numpy as np
+import os
+import shutil
+import tempfile
 
 import cantera as ct
 from . import utilities
@@ -43,6 +46,187 @@ class TestTransport(utilities.CanteraTest):
         self.assertTrue(all(self.phase.multi_diff_coeffs.flat >= 0.0))
         self.assertTrue(all(self.phase.thermal_diff_coeffs.flat != 0.0))
 
+    def test_species_viscosity_fits(self):
+        gas = self.phase
+        for model in ('Mix', 'CK_Mix'):
+            gas.transport_model = model
+            for T in (300, 800, 1500, 2500):
+                gas.TP = T, None
+                expected = []
+                for k in range(gas.n_species):
+                    c = gas.get_viscosity_polynomial(k)
+                    p = np.polyval(c[::-1], np.log(T))
+                    if model == 'CK_Mix':
+                        expected.append(np.exp(p))
+                    else:
+                        expected.append((T**0.25 * p)**2)
+                self.assertArrayNear(gas.species_viscosities, expected, 1e-10)
+
+    def test_thermal_conductivity_fits(self):
+        gas = self.phase
+        X = gas.X
+        for model in ('Mix', 'CK_Mix'):
+            gas.transport_model = model
+            for T in (300, 800, 1500, 2500):
+                gas.TP = T, None
+                cond = []
+                for k in range(gas.n_species):
+                    c = gas.get_thermal_conductivity_polynomial(k)
+                    p = np.polyval(c[::-1], np.log(T))
+                    if model == 'CK_Mix':
+                        cond.append(np.exp(p))
+                    else:
+                        cond.append(np.sqrt(T) * p)
+                cond = np.array(cond)
+                expected = 0.5 * (np.dot(X, cond) + 1 / np.dot(X, 1 / cond))
+                self.assertNear(gas.thermal_conductivity, expected, 1e-10)
+
+    def test_mix_diff_coeffs_from_binary(self):
+        gas = self.phase
+        X = gas.X
+        W = gas.molecular_weights
+        for T in (300, 800, 2500):
+            gas.TP = T, None
+            D = gas.binary_diff_coeffs
+            Dkm = np.empty(gas.n_species)
+            Dkm_mole = np.empty(gas.n_species)
+            Dkm_mass = np.empty(gas.n_species)
+            for k in range(gas.n_species):
+                j = np.arange(gas.n_species) != k
+                sum1 = np.sum(X[j] / D[k,j])
+                sum2 = np.sum(X[j] * W[j] / D[k,j])
+                Dkm[k] = (np.dot(X, W) - X[k] * W[k]) / (gas.mean_molecular_weight * sum1)
+                Dkm_mole[k] = (1 - X[k]) / sum1
+                Dkm_mass[k] = 1 / (sum1 + sum2 * X[k] /
+                                   (gas.mean_molecular_weight - W[k] * X[k]))
+            self.assertArrayNear(gas.mix_diff_coeffs, Dkm, 1e-10)
+            self.assertArrayNear(gas.mix_diff_coeffs_mole, Dkm_mole, 1e-10)
+            self.assertArrayNear(gas.mix_diff_coeffs_mass, Dkm_mass, 1e-10)
+
+    def test_binary_diff_fits(self):
+        gas = self.phase
+        K = gas.n_species
+        for model in ('Mix', 'CK_Mix'):
+            gas.transport_model = model
+            for T in (300, 800, 1500, 2500):
+                gas.TP = T, None
+                D = gas.binary_diff_coeffs * gas.P
+                expected = np.empty((K, K))
+                for i in range(K):
+                    for j in range(K):
+                        c = gas.get_binary_diff_polynomial(i, j)
+                        self.assertArrayNear(c, gas.get_binary_diff_polynomial(j, i))
+                        p = np.polyval(c[::-1], np.log(T))
+                        if model == 'CK_Mix':
+                            expected[i,j] = np.exp(p)
+                        else:
+                            expected[i,j] = T**1.5 * p
+                self.assertArrayNear(D.flat, expected.flat, 1e-10)
+
+    def test_binary_diff_table(self):
+        for model in ('Mix', 'CK_Mix'):
+            self.phase.transport_model = model
+            table = ct.Solution('h2o2.xml', transport_model=model)
+            table.X = self.phase.X
+            self.assertEqual(table.binary_diff_table_error, 0.0)
+            rtol = 1e-6
+            table.use_binary_diff_table(True, rtol)
+            self.assertTrue(0 < table.binary_diff_table_error < rtol)
+
+            # Include temperatures at and between the nodes of the table
+            for T in np.exp(np.linspace(np.log(table.min_temp),
+                                        np.log(table.max_temp), 101)):
+                self.phase.TP = T, None
+                table.TP = T, None
+                self.assertArrayNear(table.binary_diff_coeffs.flat,
+                                     self.phase.binary_diff_coeffs.flat,
+                                     2 * rtol)
+
+            table.use_binary_diff_table(False)
+            self.assertEqual(table.binary_diff_table_error, 0.0)
+            self.assertArrayNear(table.binary_diff_coeffs.flat,
+                                 self.phase.binary_diff_coeffs.flat, 1e-12)
+
+    def test_binary_diff_table_tolerance(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = self.phase.TPX
+        D0 = gas.binary_diff_coeffs
+        gas.use_binary_diff_table(True, 1e-4)
+        with self.assertRaises(RuntimeError):
+            gas.use_binary_diff_table(True, 0.0)
+        # A tolerance that can't be reached with the finest grid is rejected,
+        # and the fits are used instead of the previous table
+        with self.assertRaises(RuntimeError):
+            gas.use_binary_diff_table(True, 1e-13)
+        self.assertEqual(gas.binary_diff_table_error, 0.0)
+        self.assertArrayNear(gas.binary_diff_coeffs.flat, D0.flat, 1e-12)
+
+    def test_fit_accessors_model_type(self):
+        with self.assertRaises(ValueError):
+            self.phase.get_viscosity_polynomial(self.phase.n_species)
+        liquid = ct.Solution('LiKCl_liquid.xml')
+        with self.assertRaises(TypeError):
+            liquid.get_viscosity_polynomial(0)
+        with self.assertRaises(TypeError):
+            liquid.get_thermal_conductivity_polynomial(0)
+        with self.assertRaises(TypeError):
+            liquid.get_binary_diff_polynomial(0, 1)
+        with self.assertRaises(TypeError):
+            liquid.use_binary_diff_table(True)
+
+    def check_mixture_properties(self, model):
+        self.phase.transport_model = model
+        gas = self.phase
+        T = np.array([300, 800, 800, 1500, 2500])
+        P = np.array([ct.one_atm, 2*ct.one_atm, 0.5*ct.one_atm, ct.one_atm,
+                      10*ct.one_atm])
+        X = np.array([[0.1, 1e-4, 1e-5, 0.2, 2e-4, 0.3, 1e-6, 5e-5, 0.4],
+                      [0, 0, 0, 0.21, 0, 0, 0, 0, 0.79],
+                      [0.3, 0.02, 0.01, 0.1, 0.05, 0.2, 1e-3, 1e-4, 0.3],
+                      [1, 0, 0, 0, 0, 0, 0, 0, 0],
+                      [0.2, 0.1, 0.1, 0.1, 0.1, 0.2, 0.05, 0.05, 0.1]])
+        state = gas.TPX
+        visc, cond, diff, dtherm = gas.get_mixture_properties(
+            T, P, X=X, thermal_diffusion=True)
+        self.assertNear(gas.T, state[0])
+        self.assertNear(gas.P, state[1])
+        self.assertArrayNear(gas.X, state[2])
+
+        for i in range(len(T)):
+            gas.TPX = T[i], P[i], X[i]
+            self.assertNear(visc[i], gas.viscosity, 1e-10, 1e-20)
+            self.assertNear(cond[i], gas.thermal_conductivity, 1e-10, 1e-20)
+            self.assertArrayNear(diff[i], gas.mix_diff_coeffs, 1e-10, 1e-20)
+            self.assertArrayNear(dtherm[i], gas.thermal_diff_coeffs,
+                                 1e-10, 1e-20)
+
+    def test_mixture_properties_mix(self):
+        self.check_mixture_properties('Mix')
+
+    def test_mixture_properties_multi(self):
+        self.check_mixture_properties('Multi')
+
+    def test_mixture_properties_nonorm(self):
+        # Unnormalized mass fractions with small negative values, as found in
+        # the solution of a flame
+        gas = self.phase
+        T = np.array([600, 1200, 1900])
+        Y = np.array([[0.02, -1e-10, 1e-8, 0.2, 1e-6, 0.1, -1e-9, 1e-7, 0.68],
+                      [0.01, 1e-4, 1e-3, 0.15, 1e-3, 0.14, 1e-6, 1e-7, 0.7],
+                      [0.005, 1e-3, 5e-3, 0.1, 1e-2, 0.17, 1e-5, 1e-6, 0.71]])
+        Y[1] *= 1.001
+        Y[2] *= 0.998
+        for model in ('Mix', 'Multi'):
+            gas.transport_model = model
+            visc, cond, diff = gas.get_mixture_properties(T, ct.one_atm, Y=Y)
+            for i in range(len(T)):
+                gas.TP = T[i], ct.one_atm
+                gas.set_unnormalized_mass_fractions(Y[i])
+                self.assertNear(visc[i], gas.viscosity, 1e-10, 1e-20)
+                self.assertNear(cond[i], gas.thermal_conductivity, 1e-10, 1e-20)
+                self.assertArrayNear(diff[i], gas.mix_diff_coeffs, 1e-10, 1e-20)
+
+
 class TestTransportGeometryFlags(utilities.CanteraTest):
     phase_data = """
 units(length="cm", time="s", quantity="mol", act_energy="cal/mol")
@@ -132,6 +316,302 @@ class TestDustyGas(utilities.CanteraTest):
         # Not sure why the following condition is not satisfied:
         # self.assertNear(sum(fluxes1) / sum(abs(fluxes1)), 0.0)
 
+    def test_state_change(self):
+        # Coefficients reused after changing only the composition or the
+        # pressure should match those of a new object at the same state
+        other = ct.DustyGas('h2o2.xml')
+        other.porosity = 0.2
+        other.tortuosity = 0.3
+        other.mean_pore_radius = 1e-4
+        other.mean_particle_diameter = 5e-4
+        for X, P in [("O2:1.0, H2:3.0, H2O:0.5", ct.one_atm),
+                     ("O2:1.0, H2:3.0, H2O:0.5", 2 * ct.one_atm)]:
+            self.phase.TPX = 500.0, P, X
+            other.TPX = 500.0, P, X
+            self.assertArrayNear(self.phase.multi_diff_coeffs,
+                                 other.multi_diff_coeffs)
+            other.TPX = 300.0, ct.one_atm, X
+            other.multi_diff_coeffs
+
+
+class TestLiquidTransport(utilities.CanteraTest):
+    def setUp(self):
+        self.liquid = ct.Solution('LiKCl_liquid.xml')
+        self.liquid.TPX = 750.0, ct.one_atm, 'LiCl(L):0.6, KCl(L):0.3, NaCl(L):0.1'
+        self.grad_T = 50.0
+        self.grad_X = np.array([[2.0, -1.5, -0.5]])
+
+    def check_fluxes(self, liquid):
+        # Properties computed by 'liquid', which has cached values from
+        # previous states, should match those of a new object
+        other = ct.Solution('LiKCl_liquid.xml')
+        other.TPX = liquid.TPX
+        other.velocity_basis = liquid.velocity_basis
+        fluxes = liquid.get_species_fluxes(self.grad_T, self.grad_X)
+        self.assertArrayNear(fluxes,
+                             other.get_species_fluxes(self.grad_T, self.grad_X))
+        self.assertArrayNear(liquid.mix_diff_coeffs, other.mix_diff_coeffs)
+        self.assertNear(liquid.viscosity, other.viscosity)
+        self.assertNear(liquid.thermal_conductivity, other.thermal_conductivity)
+        return fluxes
+
+    def test_fluxes(self):
+        fluxes = self.check_fluxes(self.liquid)
+        # Mass fluxes relative to the mass-averaged velocity sum to zero
+        self.assertNear(sum(fluxes[0]) / sum(abs(fluxes[0])), 0.0, atol=1e-10)
+
+        # Solving again with the same factorization
+        self.assertArrayNear(
+            fluxes, self.liquid.get_species_fluxes(self.grad_T, self.grad_X))
+        self.assertArrayNear(
+            2 * fluxes,
+            self.liquid.get_species_fluxes(2 * self.grad_T, 2 * self.grad_X))
+
+    def test_temperature_change(self):
+        fluxes0 = self.check_fluxes(self.liquid)
+        self.liquid.TP = 850.0, ct.one_atm
+        fluxes1 = self.check_fluxes(self.liquid)
+        self.assertFalse(np.allclose(fluxes0, fluxes1))
+
+    def test_composition_change(self):
+        fluxes0 = self.check_fluxes(self.liquid)
+        self.liquid.TPX = None, None, 'LiCl(L):0.3, KCl(L):0.3, NaCl(L):0.4'
+        fluxes1 = self.check_fluxes(self.liquid)
+        self.assertFalse(np.allclose(fluxes0, fluxes1))
+
+    def test_velocity_basis(self):
+        self.assertEqual(self.liquid.velocity_basis, 'mass')
+        fluxes0 = self.check_fluxes(self.liquid)
+        for basis in ('mole', 'KCl(L)', 'mass'):
+            self.liquid.velocity_basis = basis
+            self.assertEqual(self.liquid.velocity_basis, basis)
+            fluxes1 = self.check_fluxes(self.liquid)
+        self.assertArrayNear(fluxes0, fluxes1)
+
+        self.liquid.velocity_basis = 'KCl(L)'
+        V = self.liquid.get_species_fluxes(self.grad_T, self.grad_X)
+        self.assertNear(V[0][self.liquid.species_index('KCl(L)')], 0.0)
+
+    def test_fluxes_multi(self):
+        T = [700.0, 750.0, 800.0, 900.0]
+        P = [ct.one_atm] * 4
+        X = [[0.6, 0.3, 0.1], [0.3, 0.3, 0.4], [0.1, 0.8, 0.1], [0.5, 0.5, 0.0]]
+        grad_T = [[50.0], [-20.0], [0.0], [100.0]]
+        grad_X = [[[2.0, -1.5, -0.5]], [[-1.0, 0.2, 0.8]],
+                  [[0.3, 0.3, -0.6]], [[1.0, -1.0, 0.0]]]
+        grad_Phi = [[0.0], [0.0], [1.0], [0.0]]
+        state = self.liquid.TPX
+        fluxes = self.liquid.get_species_fluxes_multi(T, P, X, grad_T, grad_X,
+                                                      grad_Phi)
+        self.assertEqual(fluxes.shape, (4, 1, 3))
+        self.assertNear(self.liquid.T, state[0])
+        self.assertArrayNear(self.liquid.X, state[2])
+
+        for i in range(len(T)):
+            self.liquid.TPX = T[i], P[i], X[i]
+            self.assertArrayNear(
+                fluxes[i],
+                self.liquid.get_species_fluxes(grad_T[i], grad_X[i],
+                                               grad_Phi[i]))
+
+    def test_fluxes_multi_gas(self):
+        gas = ct.Solution('h2o2.xml')
+        with self.assertRaises(TypeError):
+            gas.get_species_fluxes_multi([300.0], [ct.one_atm],
+                                         [gas.X], [[0.0]], [[gas.X]])
+
+
+class TestHighPressureGasTransport(utilities.CanteraTest):
+    def setUp(self):
+        self.gas = ct.Solution('co2_h2o_RK.cti')
+        self.gas.TPX = 1000.0, 100e5, 'CO2:0.8, H2O:0.2'
+
+    def check_properties(self, gas):
+        # Properties computed by 'gas', which has cached values from previous
+        # states, should match those of a new object
+        other = ct.Solution('co2_h2o_RK.cti')
+        other.TPX = gas.TPX
+        self.assertNear(gas.viscosity, other.viscosity)
+        self.assertNear(gas.thermal_conductivity, other.thermal_conductivity)
+        self.assertArrayNear(gas.binary_diff_coeffs, other.binary_diff_coeffs)
+        return gas.viscosity, gas.thermal_conductivity, gas.binary_diff_coeffs
+
+    def test_pressure_change(self):
+        visc0, cond0, D0 = self.check_properties(self.gas)
+        self.gas.TP = None, 150e5
+        visc1, cond1, D1 = self.check_properties(self.gas)
+        self.assertNotEqual(visc0, visc1)
+        self.assertNotEqual(cond0, cond1)
+
+    def test_composition_change(self):
+        visc0, cond0, D0 = self.check_properties(self.gas)
+        self.gas.TPX = None, None, 'CO2:0.3, H2O:0.7'
+        visc1, cond1, D1 = self.check_properties(self.gas)
+        self.assertNotEqual(visc0, visc1)
+        self.assertFalse(np.allclose(D0, D1))
+
+    def test_correction_table(self):
+        self.assertEqual(self.gas.correction_table_error, 0.0)
+        table = ct.Solution('co2_h2o_RK.cti')
+        rtol = 1e-5
+        table.use_correction_table(True, rtol)
+        self.assertTrue(0 < table.correction_table_error < rtol)
+
+        for T in [700.0, 1000.0, 1500.0, 2500.0]:
+            for P in [20e5, 100e5, 300e5]:
+                for X in ['CO2:0.8, H2O:0.2', 'CO2:0.1, H2O:0.9']:
+                    self.gas.TPX = T, P, X
+                    table.TPX = T, P, X
+                    self.assertArrayNear(table.binary_diff_coeffs,
+                                         self.gas.binary_diff_coeffs,
+                                         rtol=10 * rtol)
+
+        # Exact values are used again without the table
+        table.use_correction_table(False)
+        self.assertEqual(table.correction_table_error, 0.0)
+        self.assertArrayNear(table.binary_diff_coeffs,
+                             self.gas.binary_diff_coeffs)
+
+    def test_correction_table_tolerance(self):
+        with self.assertRaises(RuntimeError):
+            self.gas.use_correction_table(True, 0.0)
+        with self.assertRaises(RuntimeError):
+            self.gas.use_correction_table(True, -1e-4)
+
+    def test_high_pressure_properties(self):
+        T = [800.0, 1000.0, 1000.0, 1200.0, 1500.0]
+        P = [50e5, 100e5, 200e5, 200e5, 80e5]
+        X = [[0.8, 0.2], [0.8, 0.2], [0.8, 0.2], [0.4, 0.6], [0.1, 0.9]]
+        state = self.gas.TPX
+        visc, cond, D = self.gas.get_high_pressure_properties(T, P, X)
+        self.assertEqual(D.shape, (5, 2, 2))
+        self.assertNear(self.gas.T, state[0])
+        self.assertNear(self.gas.P, state[1])
+        self.assertArrayNear(self.gas.X, state[2])
+
+        other = ct.Solution('co2_h2o_RK.cti')
+        for i in range(len(T)):
+            other.TPX = T[i], P[i], X[i]
+            self.assertNear(visc[i], other.viscosity)
+            self.assertNear(cond[i], other.thermal_conductivity)
+            self.assertArrayNear(D[i], other.binary_diff_coeffs)
+
+    def test_high_pressure_properties_other_model(self):
+        gas = ct.Solution('h2o2.xml')
+        with self.assertRaises(TypeError):
+            gas.get_high_pressure_properties([300.0], [ct.one_atm], [gas.X])
+        with self.assertRaises(TypeError):
+            gas.use_correction_table(True)
+
+
+class TestIterativeMultiTransport(utilities.CanteraTest):
+    def setUp(self):
+        self.direct = ct.Solution('gri30.xml', transport_model='Multi')
+        self.iterative = ct.Solution('gri30.xml', transport_model='Multi')
+
+    def profile(self, n):
+        # Temperatures and compositions similar to those across a flame, so
+        # that neighboring states are close to each other
+        gas = self.direct
+        X0 = gas.X
+        gas.TPX = 300, ct.one_atm, 'CH4:1, O2:2, N2:7.52'
+        Xr = gas.X
+        gas.TPX = None, None, ('CO2:0.9, CO:0.1, H2O:1.9, OH:0.05, H:0.02, '
+                               'O:0.02, H2:0.03, O2:0.05, N2:7.52, NO:0.01')
+        Xp = gas.X
+        gas.X = X0
+        for i in range(n):
+            f = i / (n - 1)
+            yield 300 + 1900 * f, (1 - f) * Xr + f * Xp
+
+    def check_profile(self, rtol):
+        for T, X in self.profile(40):
+            self.direct.TPX = T, ct.one_atm, X
+            self.iterative.TPX = T, ct.one_atm, X
+            self.assertNear(self.iterative.thermal_conductivity,
+                            self.direct.thermal_conductivity, rtol)
+            self.assertArrayNear(self.iterative.thermal_diff_coeffs,
+                                 self.direct.thermal_diff_coeffs, rtol, 1e-14)
+
+    def test_gmres(self):
+        self.iterative.use_iterative_solver(True, 1e-10)
+        self.check_profile(1e-7)
+
+    def test_refactor(self):
+        # With a single iteration allowed, the factorization is updated at
+        # most states, but the results must not change
+        self.iterative.use_iterative_solver(True, 1e-10, 1)
+        self.check_profile(1e-7)
+
+    def test_disable(self):
+        self.iterative.use_iterative_solver(True, 1e-10)
+        self.check_profile(1e-7)
+        self.iterative.use_iterative_solver(False)
+        self.check_profile(1e-10)
+
+    def test_bad_options(self):
+        with self.assertRaises(RuntimeError):
+            self.iterative.use_iterative_solver(True, 0.0)
+        with self.assertRaises(RuntimeError):
+            self.iterative.use_iterative_solver(True, 1e-8, 0)
+
+    def test_other_model(self):
+        gas = ct.Solution('h2o2.xml')
+        with self.assertRaises(TypeError):
+            gas.use_iterative_solver(True)
+
+
+class TestTransportFitCache(utilities.CanteraTest):
+    def setUp(self):
+        self.cache_dir = tempfile.mkdtemp()
+        ct.set_transport_fit_cache(self.cache_dir)
+
+    def tearDown(self):
+        ct.set_transport_fit_cache(None)
+        shutil.rmtree(self.cache_dir)
+
+    def check_properties(self, gas1, gas2):
+        for g in (gas1, gas2):
+            g.TPX = 1200, ct.one_atm, 'H2:0.3, O2:0.2, H2O:0.4, OH:0.1'
+        self.assertNear(gas1.viscosity, gas2.viscosity)
+        self.assertNear(gas1.thermal_conductivity, gas2.thermal_conductivity)
+        self.assertArrayNear(gas1.binary_diff_coeffs, gas2.binary_diff_coeffs)
+        self.assertArrayNear(gas1.thermal_diff_coeffs, gas2.thermal_diff_coeffs)
+
+    def test_reuse(self):
+        self.assertEqual(ct.get_transport_fit_cache(), self.cache_dir)
+        gas1 = ct.Solution('h2o2.xml', transport_model='Multi')
+        files = os.listdir(self.cache_dir)
+        self.assertEqual(len(files), 1)
+
+        gas2 = ct.Solution('h2o2.xml', transport_model='Multi')
+        self.assertEqual(os.listdir(self.cache_dir), files)
+        self.check_properties(gas1, gas2)
+
+        ct.set_transport_fit_cache(None)
+        gas3 = ct.Solution('h2o2.xml', transport_model='Multi')
+        self.check_properties(gas2, gas3)
+
+    def test_invalid_file(self):
+        gas1 = ct.Solution('h2o2.xml')
+        fname = os.path.join(self.cache_dir, os.listdir(self.cache_dir)[0])
+        with open(fname, 'r+b') as f:
+            f.truncate(100)
+
+        gas2 = ct.Solution('h2o2.xml')
+        self.check_properties(gas1, gas2)
+        self.assertTrue(os.path.getsize(fname) > 100)
+
+    def test_different_data(self):
+        ct.Solution('h2o2.xml')
+        gas = ct.Solution('h2o2.xml')
+        species = gas.species()
+        species[0].transport.set_customary_units('linear', 3.0, 40.0)
+        ct.Solution(thermo='IdealGas', kinetics='GasKinetics',
+                    species=species, reactions=gas.reactions(),
+                    transport_model='Mix')
+        self.assertEqual(len(os.listdir(self.cache_dir)), 2)
+
 
 class TestTransportData(utilities.CanteraTest):
     @classmethod
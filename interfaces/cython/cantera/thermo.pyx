@@ -432,6 +432,23 @@ cdef class ThermoPhase(_SolutionBase):
                             " Got {!r}.".format(k))
         return s
 
+    def species_Hf298(self, species):
+        """
+        Enthalpy of formation [J/kmol] of the standard state of species
+        *species* at 298.15 K and the reference pressure. The species may be
+        specified by name or by index.
+        """
+        return self.thermo.Hf298SS(self.species_index(species))
+
+    def modify_species_Hf298(self, species, Hf298):
+        """
+        Modify the enthalpy of formation [J/kmol] at 298.15 K of species
+        *species*. This only affects this phase: the parameterizations of the
+        species are copied before they are modified if they are shared with
+        other phases or with `Species` objects.
+        """
+        self.thermo.modifyOneHf298SS(self.species_index(species), Hf298)
+
     def n_atoms(self, species, element):
         """
         Number of atoms of element *element* in species *species*. The element
@@ -755,6 +772,39 @@ cdef class ThermoPhase(_SolutionBase):
         def __get__(self):
             return self.thermo.critDensity() / self._mass_factor()
 
+    def densities_TP(self, T, P, phase=None):
+        """
+        Densities [kg/m^3 or kmol/m^3] depending on `basis`, at the
+        temperatures *T* [K] and pressures *P* [Pa], at the current
+        composition. The state of the phase is not changed. *phase* may be
+        ``'gas'`` or ``'liquid'`` to select the corresponding root of the
+        equation of state; by default the same root is chosen as when setting
+        the state starting from an ideal gas density. Where no acceptable
+        density is found, the value is negative (-1 or -2, as for the
+        underlying ``densityCalc`` method).
+
+        Only available for non-ideal phases with a cubic equation of state,
+        e.g. ``RedlichKwongMFTP``.
+        """
+        if self.thermo.eosType() not in (thermo_type_mixture_fugacity,
+                                         thermo_type_redlich_kwong):
+            raise TypeError('densities_TP is not implemented for this '
+                            'phase type')
+        phases = {None: -3, 'gas': -1, 'liquid': 0}
+        if phase not in phases:
+            raise ValueError('Unknown phase: {!r}'.format(phase))
+        cdef np.ndarray[np.double_t, ndim=1] TT = \
+            np.ascontiguousarray(T, dtype=np.double).ravel()
+        cdef size_t n = TT.size
+        cdef np.ndarray[np.double_t, ndim=1] PP = \
+            np.ascontiguousarray(np.broadcast_to(P, (n,)), dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=1] rho = np.empty(n)
+        if n:
+            (<CxxMixtureFugacityTP*>self.thermo).getDensities_TP(
+                n, &TT[0], &PP[0], &rho[0], phases[phase])
+        rho[rho > 0] /= self._mass_factor()
+        return rho
+
     property P_sat:
         """Saturation pressure [Pa] at the current temperature."""
         def __get__(self):
@@ -1100,6 +1150,14 @@ cdef class ThermoPhase(_SolutionBase):
         def __get__(self):
             return self._getArray1(thermo_getCp_R)
 
+    property standard_volumes:
+        """
+        Array of species standard-state molar volumes [m^3/kmol] at the
+        current temperature and pressure.
+        """
+        def __get__(self):
+            return self._getArray1(thermo_getStandardVolumes)
+
     ######## Miscellaneous properties ########
     property isothermal_compressibility:
         """Isothermal compressibility [1/Pa]."""
@@ -1152,6 +1210,71 @@ cdef class ThermoPhase(_SolutionBase):
         return data
 
 
+cdef class WaterPropsIAPWS:
+    """
+    Direct evaluation of the IAPWS-95 equation of state for water, as used by
+    the ``WaterSSTP`` and ``PDSS_Water`` models. This is mainly useful for
+    checking the optional tabulated evaluation of the density and saturation
+    pressure (see `use_tables`) against the exact routines.
+    """
+    cdef CxxWaterPropsIAPWS* water
+
+    _phases = {None: -1, 'gas': 0, 'liquid': 1, 'supercritical': 2}
+
+    def __cinit__(self, *args, **kwargs):
+        self.water = new CxxWaterPropsIAPWS()
+
+    def __dealloc__(self):
+        del self.water
+
+    property use_tables:
+        """
+        If `True`, the density and saturation pressure are evaluated starting
+        from tabulated values, which are generated the first time that this
+        is enabled. The default is `False`.
+        """
+        def __get__(self):
+            return self.water.usingTables()
+        def __set__(self, cbool flag):
+            self.water.useTables(flag)
+
+    property table_properties:
+        """
+        A dictionary describing the shared tables: the tolerance used to
+        select the usable cells, the largest errors of the interpolated
+        densities and saturation properties, and the ranges covered.
+        Generates the tables if necessary.
+        """
+        def __get__(self):
+            cdef const CxxWaterPropsIAPWSTable* table = &CxxDefaultWaterTable()
+            return {'tolerance': table.tolerance(),
+                    'max_density_error': table.maxDensityError(),
+                    'max_saturation_error': table.maxSaturationError(),
+                    'T_range': (table.minTemp(), table.maxTemp()),
+                    'P_range': (table.minPres(), table.maxPres()),
+                    'max_saturation_T': table.maxSatTemp()}
+
+    def pressure(self, double T, double rho):
+        """ Pressure [Pa] at temperature *T* [K] and density *rho* [kg/m^3]. """
+        self.water.setState_TR(T, rho)
+        return self.water.pressure()
+
+    def density(self, double T, double P, phase=None, double rho_guess=-1.0):
+        """
+        Density [kg/m^3] at temperature *T* [K] and pressure *P* [Pa]. *phase*
+        may be ``'gas'``, ``'liquid'`` or ``'supercritical'``. Returns -1 if
+        no density is found.
+        """
+        return self.water.density(T, P, self._phases[phase], rho_guess)
+
+    def psat(self, double T, phase='liquid'):
+        """
+        Saturation pressure [Pa] at temperature *T* [K]. The internal state is
+        set to the saturated *phase*, ``'liquid'`` or ``'gas'``.
+        """
+        return self.water.psat(T, self._phases[phase])
+
+
 cdef class InterfacePhase(ThermoPhase):
     """ A class representing a surface or edge phase"""
     def __cinit__(self, *args, **kwargs):
@@ -1358,6 +1481,20 @@ cdef class PureFluid(ThermoPhase):
         def __get__(self):
             return self.s, self.v, self.X
 
+    property use_tables:
+        """
+        Get/Set whether tabulated properties are used to accelerate the
+        calculation of saturation properties and of states specified by
+        (T, P), (H, P) or (S, P). The tables are generated the first time they
+        are enabled for a given fluid. States set using the tables satisfy the
+        same tolerances as those set without them, while saturation
+        properties are interpolated with a relative error of at most 1e-6.
+        """
+        def __get__(self):
+            return (<CxxPureFluidPhase*>self.thermo).usingTables()
+        def __set__(self, flag):
+            (<CxxPureFluidPhase*>self.thermo).useTables(flag)
+
 
 class Element(object):
     """
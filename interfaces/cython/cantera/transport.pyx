@@ -15,6 +15,26 @@ cdef np.ndarray get_transport_2d(Transport tran, transportMethod2d method):
     method(tran.transport, kk, &data[0,0])
     return data
 
+# Transport models implemented by classes derived from GasTransport
+_gas_transport_models = ('Mix', 'Multi', 'CK_Mix', 'CK_Multi', 'HighP')
+
+def set_transport_fit_cache(directory):
+    """
+    Store the polynomial fits of the gas transport properties generated when
+    a `Transport` object is created in *directory*, and reuse them for later
+    objects (including those created by other processes) with the same
+    species transport data and temperature range. The directory must exist.
+    Use `None` or an empty string to disable caching (the default).
+    """
+    CxxSetFitCacheDirectory(stringify(directory or ''))
+
+def get_transport_fit_cache():
+    """
+    The directory used by `set_transport_fit_cache`, or an empty string if
+    caching is disabled.
+    """
+    return pystr(CxxFitCacheDirectory())
+
 
 cdef class GasTransportData:
     """
@@ -144,6 +164,11 @@ cdef class Transport(_SolutionBase):
         def __get__(self):
             return self.transport.viscosity()
 
+    property species_viscosities:
+        """Pure species viscosities [Pa-s]"""
+        def __get__(self):
+            return get_transport_1d(self, tran_getSpeciesViscosities)
+
     property electrical_conductivity:
         """Electrical conductivity. [S/m]."""
         def __get__(self):
@@ -197,6 +222,295 @@ cdef class Transport(_SolutionBase):
         def __get__(self):
             return get_transport_2d(self, tran_getBinaryDiffCoeffs)
 
+    def get_mixture_properties(self, T, P, X=None, Y=None,
+                               thermal_diffusion=False):
+        """
+        Evaluate the mixture transport properties at a set of states, without
+        changing the state of the phase.
+
+        :param T:
+            Array of temperatures [K] with length *n*
+        :param P:
+            Array of pressures [Pa] with length *n*
+        :param X:
+            Array of mole fractions with shape (*n*, *n_species*). These are
+            clipped and normalized as by `TPX`.
+        :param Y:
+            Array of mass fractions with shape (*n*, *n_species*), used instead
+            of *X*. These are used as given, without normalization, in the
+            same way as the solution of a one-dimensional flow domain.
+        :param thermal_diffusion:
+            If `True`, also return the thermal diffusion coefficients.
+
+        Returns the viscosities [Pa-s], the thermal conductivities [W/m/K] and
+        the mixture-averaged diffusion coefficients [m^2/s], followed by the
+        thermal diffusion coefficients [kg/m/s] if requested.
+        """
+        if (X is None) == (Y is None):
+            raise ValueError('Exactly one of X and Y must be specified')
+        cdef np.ndarray[np.double_t, ndim=1] TT = \
+            np.ascontiguousarray(T, dtype=np.double).ravel()
+        cdef size_t n = TT.size
+        cdef size_t kk = self.thermo.nSpecies()
+        cdef np.ndarray[np.double_t, ndim=1] PP = \
+            np.ascontiguousarray(np.broadcast_to(P, (n,)), dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] comp = np.ascontiguousarray(
+            X if Y is None else Y, dtype=np.double).reshape((n, kk))
+        cdef np.ndarray[np.double_t, ndim=1] visc = np.empty(n)
+        cdef np.ndarray[np.double_t, ndim=1] cond = np.empty(n)
+        cdef np.ndarray[np.double_t, ndim=2] diff = np.empty((n, kk))
+        cdef np.ndarray[np.double_t, ndim=2] dtherm = np.empty((n, kk))
+        cdef double* dt = &dtherm[0,0] if thermal_diffusion and n else NULL
+        if n == 0:
+            pass
+        elif Y is None:
+            self.transport.getMixtureProperties(n, &TT[0], &PP[0], &comp[0,0],
+                &visc[0], &cond[0], &diff[0,0], dt)
+        else:
+            self.transport.getMixtureProperties_NoNorm(n, &TT[0], &PP[0],
+                &comp[0,0], &visc[0], &cond[0], &diff[0,0], dt)
+        if thermal_diffusion:
+            return visc, cond, diff, dtherm
+        return visc, cond, diff
+
+    def get_viscosity_polynomial(self, k):
+        """
+        Coefficients of the polynomial in ln(T) fitted to the viscosity of
+        species *k*, in order of increasing power. For the ``CK_Mix`` and
+        ``CK_Multi`` models, the fit is to ln(viscosity); otherwise, it is to
+        sqrt(viscosity/sqrt(T)).
+        """
+        if self.transport_model not in _gas_transport_models:
+            raise TypeError('get_viscosity_polynomial is not implemented for '
+                            'this transport model')
+        return np.array((<CxxGasTransport*>self.transport).viscosityPolynomial(
+            self.species_index(k)))
+
+    def get_thermal_conductivity_polynomial(self, k):
+        """
+        Coefficients of the polynomial in ln(T) fitted to the thermal
+        conductivity of species *k*, in order of increasing power. For the
+        ``CK_Mix`` and ``CK_Multi`` models, the fit is to ln(conductivity);
+        otherwise, it is to conductivity/sqrt(T).
+        """
+        if self.transport_model not in _gas_transport_models:
+            raise TypeError('get_thermal_conductivity_polynomial is not '
+                            'implemented for this transport model')
+        return np.array((<CxxGasTransport*>self.transport).conductivityPolynomial(
+            self.species_index(k)))
+
+    def get_binary_diff_polynomial(self, i, j):
+        """
+        Coefficients of the polynomial in ln(T) fitted to the binary diffusion
+        coefficient of species *i* and *j* at unit pressure, in order of
+        increasing power. For the ``CK_Mix`` and ``CK_Multi`` models, the fit
+        is to ln(D_ij); otherwise, it is to D_ij/T^(3/2).
+        """
+        if self.transport_model not in _gas_transport_models:
+            raise TypeError('get_binary_diff_polynomial is not implemented '
+                            'for this transport model')
+        return np.array((<CxxGasTransport*>self.transport).binDiffusivityPolynomial(
+            self.species_index(i), self.species_index(j)))
+
+    def use_binary_diff_table(self, flag, rtol=1e-5):
+        """
+        Enable or disable interpolation of the binary diffusion coefficients
+        from a table in ln(T), which is refined until the interpolation error
+        is below *rtol*.
+        """
+        if self.transport_model not in _gas_transport_models:
+            raise TypeError('use_binary_diff_table is not implemented for '
+                            'this transport model')
+        (<CxxGasTransport*>self.transport).useBinaryDiffTable(flag, rtol)
+
+    property binary_diff_table_error:
+        """
+        Largest interpolation error of the table of binary diffusion
+        coefficients (see `use_binary_diff_table`), or zero if it is not used.
+        """
+        def __get__(self):
+            if self.transport_model not in _gas_transport_models:
+                raise TypeError('binary_diff_table_error is not implemented '
+                                'for this transport model')
+            return (<CxxGasTransport*>self.transport).binaryDiffTableError()
+
+    def use_iterative_solver(self, flag, rtol=1e-8, max_iterations=20):
+        """
+        Enable or disable solving the L-matrix equation of the multicomponent
+        transport model iteratively with GMRES, preconditioned with the
+        factorization of the L matrix at an earlier state. This is faster when
+        the properties are evaluated at a sequence of similar states. The
+        iterations stop when the relative residual is below *rtol*, and the
+        factorization is updated if this takes more than *max_iterations*.
+        """
+        if self.transport_model not in ('Multi', 'CK_Multi'):
+            raise TypeError('use_iterative_solver is not implemented for '
+                            'this transport model')
+        (<CxxMultiTransport*>self.transport).useIterativeSolver(
+            flag, rtol, max_iterations)
+
+    def get_high_pressure_properties(self, T, P, X):
+        """
+        Evaluate the viscosities [Pa-s], thermal conductivities [W/m/K] and
+        binary diffusion coefficients [m^2/s] of the ``HighP`` transport model
+        at a set of states, without changing the state of the phase.
+
+        :param T:
+            Array of temperatures [K] with length *n*
+        :param P:
+            Array of pressures [Pa] with length *n*
+        :param X:
+            Array of mole fractions with shape (*n*, *n_species*)
+
+        The binary diffusion coefficients are returned with shape
+        (*n*, *n_species*, *n_species*), each as by `binary_diff_coeffs`.
+        """
+        if self.transport_model != 'HighP':
+            raise TypeError('get_high_pressure_properties is not implemented '
+                            'for this transport model')
+        cdef np.ndarray[np.double_t, ndim=1] TT = \
+            np.ascontiguousarray(T, dtype=np.double).ravel()
+        cdef size_t n = TT.size
+        cdef size_t kk = self.thermo.nSpecies()
+        cdef np.ndarray[np.double_t, ndim=1] PP = \
+            np.ascontiguousarray(np.broadcast_to(P, (n,)), dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] XX = np.ascontiguousarray(
+            X, dtype=np.double).reshape((n, kk))
+        cdef np.ndarray[np.double_t, ndim=1] visc = np.empty(n)
+        cdef np.ndarray[np.double_t, ndim=1] cond = np.empty(n)
+        cdef np.ndarray[np.double_t, ndim=3] bdiff = np.empty((n, kk, kk))
+        if n:
+            (<CxxHighPressureGasTransport*>self.transport).getHighPressureProperties(
+                n, &TT[0], &PP[0], &XX[0,0], &visc[0], &cond[0], &bdiff[0,0,0])
+        return visc, cond, bdiff
+
+    def use_correction_table(self, flag, rtol=1e-4):
+        """
+        Enable or disable interpolation of the Takahashi correction factors of
+        the ``HighP`` transport model from a table, which is refined until the
+        interpolation error is below *rtol*.
+        """
+        if self.transport_model != 'HighP':
+            raise TypeError('use_correction_table is not implemented for '
+                            'this transport model')
+        (<CxxHighPressureGasTransport*>self.transport).useCorrectionTable(
+            flag, rtol)
+
+    property correction_table_error:
+        """
+        Largest interpolation error of the table of Takahashi correction
+        factors (see `use_correction_table`), or zero if it is not used.
+        """
+        def __get__(self):
+            if self.transport_model != 'HighP':
+                raise TypeError('correction_table_error is not implemented '
+                                'for this transport model')
+            return (<CxxHighPressureGasTransport*>self.transport).correctionTableError()
+
+    property velocity_basis:
+        """
+        Get/Set the reference velocity for the diffusive fluxes. This is
+        ``'mass'`` for the mass-averaged velocity, ``'mole'`` for the
+        mole-averaged velocity, or the name of a species to use the velocity
+        of that species. Only used by some transport models, e.g. ``Liquid``.
+        """
+        def __get__(self):
+            cdef int vb = self.transport.getVelocityBasis()
+            if vb == -1:
+                return 'mass'
+            elif vb == -2:
+                return 'mole'
+            return pystr(self.thermo.speciesName(vb))
+
+        def __set__(self, basis):
+            if basis == 'mass':
+                self.transport.setVelocityBasis(-1)
+            elif basis == 'mole':
+                self.transport.setVelocityBasis(-2)
+            else:
+                self.transport.setVelocityBasis(self.species_index(basis))
+
+    def get_species_fluxes(self, grad_T, grad_X, grad_Phi=None):
+        """
+        Species diffusive mass fluxes [kg/m^2/s] relative to the reference
+        velocity (see `velocity_basis`) at the current state.
+
+        :param grad_T:
+            Temperature gradient [K/m], one value for each spatial dimension
+        :param grad_X:
+            Gradients of the mole fractions [1/m], with shape
+            (*n_dim*, *n_species*)
+        :param grad_Phi:
+            Gradient of the electrostatic potential [V/m], one value for each
+            spatial dimension. Defaults to zero.
+
+        Returns an array with the same shape as *grad_X*.
+        """
+        cdef size_t nd = self.transport.nDim()
+        cdef size_t kk = self.thermo.nSpecies()
+        cdef np.ndarray[np.double_t, ndim=1] gT = np.ascontiguousarray(
+            np.broadcast_to(grad_T, (nd,)), dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] gX = np.ascontiguousarray(
+            grad_X, dtype=np.double).reshape((nd, kk))
+        cdef np.ndarray[np.double_t, ndim=1] gPhi = np.ascontiguousarray(
+            np.broadcast_to(0.0 if grad_Phi is None else grad_Phi, (nd,)),
+            dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] fluxes = np.empty((nd, kk))
+        self.transport.getSpeciesFluxesES(nd, &gT[0], kk, &gX[0,0], kk,
+                                          &gPhi[0], &fluxes[0,0])
+        return fluxes.reshape(np.shape(grad_X))
+
+    def get_species_fluxes_multi(self, T, P, X, grad_T, grad_X,
+                                 grad_Phi=None):
+        """
+        Species diffusive mass fluxes [kg/m^2/s] at a set of states, without
+        changing the state of the phase. Equivalent to setting each state with
+        `TPX` and calling `get_species_fluxes`, but only implemented for the
+        ``Liquid`` transport model.
+
+        :param T:
+            Array of temperatures [K] with length *n*
+        :param P:
+            Array of pressures [Pa] with length *n*
+        :param X:
+            Array of mole fractions with shape (*n*, *n_species*)
+        :param grad_T:
+            Temperature gradients [K/m] with shape (*n*, *n_dim*)
+        :param grad_X:
+            Gradients of the mole fractions [1/m] with shape
+            (*n*, *n_dim*, *n_species*)
+        :param grad_Phi:
+            Gradients of the electrostatic potential [V/m] with shape
+            (*n*, *n_dim*). Defaults to zero.
+
+        Returns an array with the same shape as *grad_X*.
+        """
+        if self.transport_model != 'Liquid':
+            raise TypeError('get_species_fluxes_multi is not implemented for '
+                            'this transport model')
+        cdef np.ndarray[np.double_t, ndim=1] TT = \
+            np.ascontiguousarray(T, dtype=np.double).ravel()
+        cdef size_t n = TT.size
+        cdef size_t nd = self.transport.nDim()
+        cdef size_t kk = self.thermo.nSpecies()
+        cdef np.ndarray[np.double_t, ndim=1] PP = \
+            np.ascontiguousarray(np.broadcast_to(P, (n,)), dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] XX = np.ascontiguousarray(
+            X, dtype=np.double).reshape((n, kk))
+        cdef np.ndarray[np.double_t, ndim=2] gT = np.ascontiguousarray(
+            grad_T, dtype=np.double).reshape((n, nd))
+        cdef np.ndarray[np.double_t, ndim=3] gX = np.ascontiguousarray(
+            grad_X, dtype=np.double).reshape((n, nd, kk))
+        cdef np.ndarray[np.double_t, ndim=2] gPhi = np.ascontiguousarray(
+            np.broadcast_to(0.0 if grad_Phi is None else grad_Phi, (n, nd)),
+            dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=3] fluxes = np.empty((n, nd, kk))
+        if n:
+            (<CxxLiquidTransport*>self.transport).getSpeciesFluxesESMulti(
+                n, &TT[0], &PP[0], &XX[0,0], &gT[0,0], &gX[0,0,0],
+                &gPhi[0,0], &fluxes[0,0,0])
+        return fluxes.reshape(np.shape(grad_X))
+
 
 cdef class DustyGasTransport(Transport):
     """
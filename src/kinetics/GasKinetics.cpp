@@ -5,11 +5,42 @@
 // Copyright 2001  California Institute of Technology
 
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/numerics/SparseMatrix.h"
+
+#include <limits>
 
 using namespace std;
 
 namespace Cantera
 {
+
+namespace
+{
+
+//! Concentration *c* raised to the power *order*, where concentrations which
+//! are not positive are treated as zero for non-integer orders
+double concPower(double c, double order)
+{
+    if (order == 1.0) {
+        return c;
+    } else if (c <= 0.0 && order != floor(order)) {
+        return 0.0;
+    }
+    return pow(c, order);
+}
+
+//! Derivative of concPower() with respect to *c*
+double concPowerDerivative(double c, double order)
+{
+    if (order == 1.0) {
+        return 1.0;
+    } else if (c <= 0.0 && order != floor(order)) {
+        return 0.0;
+    }
+    return order * pow(c, order - 1.0);
+}
+
+}
 GasKinetics::GasKinetics(thermo_t* thermo) :
     BulkKinetics(thermo),
     m_logp_ref(0.0),
@@ -66,6 +97,15 @@ void GasKinetics::update_rates_T()
 
 void GasKinetics::update_rates_C()
 {
+    // The activity concentrations depend on the temperature, pressure and
+    // composition, and don't need to be recomputed if none of these changed.
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(thermo().temperature(), thermo().pressure(),
+                        thermo().stateMFNumber())) {
+        return;
+    }
+
     thermo().getActivityConcentrations(m_conc.data());
     doublereal ctot = thermo().molarDensity();
 
@@ -234,6 +274,201 @@ void GasKinetics::getFwdRateConstants(doublereal* kfwd)
     }
 }
 
+void GasKinetics::prepareDerivatives()
+{
+    m_jacReactants.clear();
+    m_jacProducts.clear();
+    m_jacStoich.clear();
+    for (const auto& r : m_reactions) {
+        map<size_t, double> orders, stoich;
+        for (const auto& sp : r->reactants) {
+            size_t k = kineticsSpeciesIndex(sp.first);
+            orders[k] = sp.second;
+            stoich[k] -= sp.second;
+        }
+        for (const auto& sp : r->orders) {
+            orders[kineticsSpeciesIndex(sp.first)] = sp.second;
+        }
+        m_jacReactants.emplace_back(orders.begin(), orders.end());
+
+        m_jacProducts.emplace_back();
+        for (const auto& sp : r->products) {
+            size_t k = kineticsSpeciesIndex(sp.first);
+            stoich[k] += sp.second;
+            if (r->reversible) {
+                m_jacProducts.back().emplace_back(k, sp.second);
+            }
+        }
+
+        m_jacStoich.emplace_back();
+        for (const auto& sp : stoich) {
+            if (sp.second != 0.0) {
+                m_jacStoich.back().push_back(sp);
+            }
+        }
+    }
+}
+
+void GasKinetics::getConcProductDerivatives(
+    const std::function<void(size_t, size_t, double)>& add)
+{
+    if (m_jacStoich.size() != nReactions()) {
+        prepareDerivatives();
+    }
+
+    // Effective forward rate constants, including the third-body
+    // concentrations and falloff functions. This overwrites the rates of
+    // progress, which are recalculated afterwards.
+    m_kfwd_work.resize(nReactions());
+    getFwdRateConstants(m_kfwd_work.data());
+    m_ROP_ok = false;
+    updateROP();
+
+    for (size_t i = 0; i < nReactions(); i++) {
+        const auto& reac = m_jacReactants[i];
+        for (size_t n = 0; n < reac.size(); n++) {
+            double drop = m_kfwd_work[i] *
+                concPowerDerivative(m_conc[reac[n].first], reac[n].second);
+            for (size_t m = 0; m < reac.size(); m++) {
+                if (m != n) {
+                    drop *= concPower(m_conc[reac[m].first], reac[m].second);
+                }
+            }
+            add(i, reac[n].first, drop);
+        }
+
+        const auto& prod = m_jacProducts[i];
+        double krev = m_kfwd_work[i] * m_rkcn[i];
+        if (krev == 0.0) {
+            continue;
+        }
+        for (size_t n = 0; n < prod.size(); n++) {
+            double drop = -krev *
+                concPowerDerivative(m_conc[prod[n].first], prod[n].second);
+            for (size_t m = 0; m < prod.size(); m++) {
+                if (m != n) {
+                    drop *= concPower(m_conc[prod[m].first], prod[m].second);
+                }
+            }
+            add(i, prod[n].first, drop);
+        }
+    }
+}
+
+void GasKinetics::getNetProductionRates_ddC(double* dwdot)
+{
+    fill(dwdot, dwdot + m_kk * m_kk, 0.0);
+    getConcProductDerivatives([&](size_t i, size_t j, double drop) {
+        addRopDerivative(i, j, drop, dwdot);
+    });
+
+    // Third-body concentrations. The contribution of the default efficiency,
+    // which is the same for all species, is accumulated in m_wdot_work.
+    m_wdot_work.assign(m_kk, 0.0);
+    for (size_t n = 0; n < concm_3b_values.size(); n++) {
+        size_t i = m_3b_concm.reactionIndex(n);
+        double M = concm_3b_values[n];
+        if (M <= 0.0) {
+            continue;
+        }
+        // d(rop)/d(M) for a rate proportional to M
+        double drop_dM = m_ropnet[i] / M;
+        for (const auto& sp : m_jacStoich[i]) {
+            m_wdot_work[sp.first] += sp.second * drop_dM *
+                m_3b_concm.defaultEfficiency(n);
+        }
+        const auto& species = m_3b_concm.enhancedSpecies(n);
+        const auto& eff = m_3b_concm.enhancedEfficiencies(n);
+        for (size_t m = 0; m < species.size(); m++) {
+            addRopDerivative(i, species[m], drop_dM * eff[m], dwdot);
+        }
+    }
+
+    for (size_t n = 0; n < m_fallindx.size(); n++) {
+        size_t i = m_fallindx[n];
+        double M = concm_falloff_values[n];
+        if (M <= 0.0) {
+            continue;
+        }
+        // d(ln k)/d(M) for the Lindemann form, where k is proportional to
+        // Pr/(1+Pr) for falloff reactions, and to 1/(1+Pr) for chemically
+        // activated reactions
+        double Pr = M * m_rfn_low[n] / (m_rfn_high[n] + SmallNumber);
+        double dlnk_dM = 1.0 / (M * (1.0 + Pr));
+        if (reactionType(i) == CHEMACT_RXN) {
+            dlnk_dM *= -Pr;
+        }
+        double drop_dM = m_ropnet[i] * dlnk_dM;
+        for (const auto& sp : m_jacStoich[i]) {
+            m_wdot_work[sp.first] += sp.second * drop_dM *
+                m_falloff_concm.defaultEfficiency(n);
+        }
+        const auto& species = m_falloff_concm.enhancedSpecies(n);
+        const auto& eff = m_falloff_concm.enhancedEfficiencies(n);
+        for (size_t m = 0; m < species.size(); m++) {
+            addRopDerivative(i, species[m], drop_dM * eff[m], dwdot);
+        }
+    }
+
+    if (!concm_3b_values.empty() || !m_fallindx.empty()) {
+        for (size_t j = 0; j < m_kk; j++) {
+            for (size_t k = 0; k < m_kk; k++) {
+                dwdot[j * m_kk + k] += m_wdot_work[k];
+            }
+        }
+    }
+}
+
+void GasKinetics::getNetProductionRates_ddT(double* dwdot)
+{
+    // Changing the temperature of the phase leaves the density, and therefore
+    // the concentrations, unchanged
+    double T = thermo().temperature();
+    double Tpert = T * (1.0 + sqrt(numeric_limits<double>::epsilon()));
+    m_wdot_work.resize(m_kk);
+    getNetProductionRates(dwdot);
+    thermo().setTemperature(Tpert);
+    getNetProductionRates(m_wdot_work.data());
+    thermo().setTemperature(T);
+    for (size_t k = 0; k < m_kk; k++) {
+        dwdot[k] = (m_wdot_work[k] - dwdot[k]) / (Tpert - T);
+    }
+}
+
+void GasKinetics::getNetProductionRates_ddCPattern(
+    std::vector<std::vector<size_t>>& rows)
+{
+    if (m_jacStoich.size() != nReactions()) {
+        prepareDerivatives();
+    }
+    rows.assign(m_kk, vector<size_t>());
+    for (size_t i = 0; i < nReactions(); i++) {
+        for (const auto& sp : m_jacStoich[i]) {
+            auto& row = rows[sp.first];
+            for (const auto& reac : m_jacReactants[i]) {
+                row.push_back(reac.first);
+            }
+            for (const auto& prod : m_jacProducts[i]) {
+                row.push_back(prod.first);
+            }
+        }
+    }
+    for (auto& row : rows) {
+        sort(row.begin(), row.end());
+        row.erase(unique(row.begin(), row.end()), row.end());
+    }
+}
+
+void GasKinetics::getNetProductionRates_ddC(SparseMatrix& dwdot)
+{
+    dwdot.zero();
+    getConcProductDerivatives([&](size_t i, size_t j, double drop) {
+        for (const auto& sp : m_jacStoich[i]) {
+            dwdot.value(sp.first, j) += sp.second * drop;
+        }
+    });
+}
+
 bool GasKinetics::addReaction(shared_ptr<Reaction> r)
 {
     // operations common to all reaction types
@@ -263,6 +498,7 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r)
         throw CanteraError("GasKinetics::addReaction",
             "Unknown reaction type specified: {}", r->reaction_type);
     }
+    m_cache.clear();
     return true;
 }
 
@@ -354,10 +590,15 @@ void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
             "Unknown reaction type specified: {}", rNew->reaction_type);
     }
 
-    // invalidate all cached data
+    invalidateCache();
+}
+
+void GasKinetics::invalidateCache()
+{
     m_ROP_ok = false;
     m_temp += 0.1234;
     m_pres += 0.1234;
+    m_cache.clear();
 }
 
 void GasKinetics::modifyThreeBodyReaction(size_t i, ThreeBodyReaction& r)
@@ -61,6 +61,7 @@ Kinetics& Kinetics::operator=(const Kinetics& right)
     m_ropr = right.m_ropr;
     m_ropnet = right.m_ropnet;
     m_skipUndeclaredSpecies = right.m_skipUndeclaredSpecies;
+    m_cache.clear();
 
     return *this;
 }
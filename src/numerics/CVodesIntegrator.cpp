@@ -2,9 +2,14 @@
 
 // Copyright 2001  California Institute of Technology
 #include "cantera/numerics/CVodesIntegrator.h"
+#include "cantera/numerics/SparseMatrix.h"
+#include "cantera/base/Array.h"
 #include "cantera/base/stringUtils.h"
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <limits>
 using namespace std;
 
 #include "sundials/sundials_types.h"
@@ -36,15 +41,89 @@ namespace Cantera
 class FuncData
 {
 public:
-    FuncData(FuncEval* f, size_t npar = 0) {
+    FuncData(FuncEval* f, size_t npar = 0) :
+        m_integrand(0),
+        m_adjJacTime(std::numeric_limits<double>::quiet_NaN())
+    {
         m_pars.resize(npar, 1.0);
         m_func = f;
     }
     virtual ~FuncData() {}
     vector_fp m_pars;
     FuncEval* m_func;
+
+    //! Jacobian matrix, used by the DENSE linear solver with a user-supplied
+    //! Jacobian
+    Array2D m_denseJac;
+
+    //! Jacobian matrix, used by the SPARSE linear solver, or an approximation
+    //! to it, used by the preconditioned GMRES linear solver
+    SparseMatrix m_jac;
+
+    //! Factored Newton iteration matrix, I - gamma * m_jac
+    SparseMatrix m_newton;
+
+    //! Exception thrown while evaluating the root functions, which is
+    //! rethrown once CVodes returns
+    std::exception_ptr m_rootError;
+
+    //! Integrand of the functional whose gradient is found by
+    //! CVodesIntegrator::solveAdjoint()
+    AdjointIntegrand* m_integrand;
+
+    //! Jacobian matrix used by the adjoint equations, and the time and
+    //! solution vector for which it was evaluated
+    Array2D m_adjJac;
+    double m_adjJacTime;
+    vector_fp m_adjJacY;
+
+    //! Work arrays used by the adjoint equations
+    vector_fp m_adjY, m_adjYdot, m_dgdy;
 };
 
+namespace
+{
+
+//! Header of the state saved by CVodesIntegrator::saveState(), which is
+//! followed by the solution vector and the sensitivities
+struct CheckpointHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t neq;
+    uint64_t np;
+    double time;
+    double step;
+};
+
+const uint32_t checkpointMagic = 0x4b435643; // "CVCK"
+const uint32_t checkpointVersion = 1;
+
+//! Evaluate the Jacobian used by the adjoint equations for the solution
+//! vector *y* at time *t*, unless it has already been evaluated there. The
+//! right-hand sides of the backward problem are evaluated several times for
+//! the same forward solution during each Newton iteration.
+void updateAdjointJacobian(FuncData* d, double t, N_Vector y)
+{
+    size_t n = NV_LENGTH_S(y);
+    const double* ydata = NV_DATA_S(y);
+    if (t == d->m_adjJacTime &&
+        std::equal(ydata, ydata + n, d->m_adjJacY.begin())) {
+        return;
+    }
+    d->m_adjJacTime = std::numeric_limits<double>::quiet_NaN();
+    d->m_adjJacY.assign(ydata, ydata + n);
+    // The state vector is perturbed while evaluating the Jacobian, so pass
+    // a copy
+    d->m_adjY = d->m_adjJacY;
+    d->m_adjYdot.resize(n);
+    double* p = d->m_pars.empty() ? NULL : d->m_pars.data();
+    d->m_func->evalJacobian(t, d->m_adjY.data(), d->m_adjYdot.data(), p,
+                            &d->m_adjJac);
+    d->m_adjJacTime = t;
+}
+
+}
+
 extern "C" {
     /**
      * Function called by cvodes to evaluate ydot given y.  The CVODE integrator
@@ -77,6 +156,192 @@ extern "C" {
         return 0; // successful evaluation
     }
 
+    //! Function called by CVodes to evaluate the Jacobian for the DENSE linear
+    //! solver with a user-supplied Jacobian (problem type DENSE + JAC).
+    static int cvodes_jac(sd_size_t N, realtype t, N_Vector y, N_Vector fy,
+                          DlsMat Jac, void* f_data, N_Vector tmp1,
+                          N_Vector tmp2, N_Vector tmp3)
+    {
+        try {
+            FuncData* d = (FuncData*)f_data;
+            double* p = d->m_pars.empty() ? NULL : d->m_pars.data();
+            // The state vector is perturbed while evaluating the Jacobian, so
+            // pass a copy
+            N_VScale(1.0, y, tmp1);
+            d->m_func->evalJacobian(t, NV_DATA_S(tmp1), NV_DATA_S(tmp2), p,
+                                    &d->m_denseJac);
+            for (sd_size_t j = 0; j < N; j++) {
+                realtype* col = DENSE_COL(Jac, j);
+                for (sd_size_t i = 0; i < N; i++) {
+                    col[i] = d->m_denseJac(i, j);
+                }
+            }
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_jac: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by CVodes to set up the preconditioner for the SPARSE
+    //! and GMRES + JAC linear solvers. The Jacobian is re-evaluated unless CVodes indicates
+    //! that the previous one can be reused (*jok*), and the Newton iteration
+    //! matrix I - gamma*J is factored.
+    static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector ydot,
+                                 booleantype jok, booleantype* jcurPtr,
+                                 realtype gamma, void* f_data, N_Vector tmp1,
+                                 N_Vector tmp2, N_Vector tmp3)
+    {
+        try {
+            FuncData* d = (FuncData*)f_data;
+            if (!jok) {
+                double* p = d->m_pars.empty() ? NULL : d->m_pars.data();
+                // The state vector is perturbed while evaluating the Jacobian,
+                // so pass a copy
+                N_VScale(1.0, y, tmp1);
+                d->m_func->evalSparseJacobian(t, NV_DATA_S(tmp1),
+                                              NV_DATA_S(ydot), p, d->m_jac);
+                *jcurPtr = TRUE;
+            } else {
+                *jcurPtr = FALSE;
+            }
+            d->m_newton.setIdentityMinus(gamma, d->m_jac);
+            if (d->m_newton.factor() != 0) {
+                return 1; // singular matrix; recoverable with a smaller step
+            }
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_prec_setup: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by CVodes to solve the preconditioner system
+    //! (I - gamma*J) z = r for the SPARSE linear solver, using the
+    //! factorization from cvodes_prec_setup.
+    static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector ydot,
+                                 N_Vector r, N_Vector z, realtype gamma,
+                                 realtype delta, int lr, void* f_data,
+                                 N_Vector tmp)
+    {
+        FuncData* d = (FuncData*)f_data;
+        N_VScale(1.0, r, z);
+        d->m_newton.solve(NV_DATA_S(z));
+        return 0;
+    }
+
+    //! Function called by CVodes to evaluate the root functions
+    static int cvodes_root(realtype t, N_Vector y, realtype* gout,
+                           void* f_data)
+    {
+        FuncData* d = (FuncData*)f_data;
+        try {
+            d->m_func->evalRootFunctions(t, NV_DATA_S(y), gout);
+        } catch (...) {
+            d->m_rootError = std::current_exception();
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by CVodes to evaluate the right-hand side of the
+    //! adjoint equations, \f$ \dot{\lambda} = -J^T \lambda - (\partial g /
+    //! \partial y)^T \f$.
+    static int cvodes_rhsB(realtype t, N_Vector y, N_Vector yB,
+                           N_Vector yBdot, void* f_data)
+    {
+        try {
+            FuncData* d = (FuncData*)f_data;
+            updateAdjointJacobian(d, t, y);
+            size_t n = NV_LENGTH_S(y);
+            const double* lambda = NV_DATA_S(yB);
+            double* out = NV_DATA_S(yBdot);
+            for (size_t j = 0; j < n; j++) {
+                double sum = 0.0;
+                for (size_t i = 0; i < n; i++) {
+                    sum += d->m_adjJac(i, j) * lambda[i];
+                }
+                out[j] = -sum;
+            }
+            if (d->m_integrand) {
+                d->m_dgdy.resize(n);
+                d->m_integrand->getGradient(t, NV_DATA_S(y), d->m_dgdy.data());
+                for (size_t j = 0; j < n; j++) {
+                    out[j] -= d->m_dgdy[j];
+                }
+            }
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_rhsB: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by CVodes to evaluate the Jacobian of the adjoint
+    //! equations, \f$ -J^T \f$.
+    static int cvodes_jacB(sd_size_t N, realtype t, N_Vector y, N_Vector yB,
+                           N_Vector fyB, DlsMat JB, void* f_data,
+                           N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+    {
+        try {
+            FuncData* d = (FuncData*)f_data;
+            updateAdjointJacobian(d, t, y);
+            for (sd_size_t j = 0; j < N; j++) {
+                realtype* col = DENSE_COL(JB, j);
+                for (sd_size_t i = 0; i < N; i++) {
+                    col[i] = -d->m_adjJac(j, i);
+                }
+            }
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_jacB: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by CVodes to evaluate the integrands of the gradient,
+    //! \f$ -\lambda^T \partial f / \partial p \f$, and of the functional,
+    //! \f$ -g \f$, which are integrated backwards in time.
+    static int cvodes_quadB(realtype t, N_Vector y, N_Vector yB,
+                            N_Vector qBdot, void* f_data)
+    {
+        try {
+            FuncData* d = (FuncData*)f_data;
+            size_t np = d->m_pars.size();
+            double* out = NV_DATA_S(qBdot);
+            if (np) {
+                const double* ydata = NV_DATA_S(y);
+                d->m_adjY.assign(ydata, ydata + NV_LENGTH_S(y));
+                d->m_func->evalParameterAdjoint(t, d->m_adjY.data(),
+                    d->m_pars.data(), NV_DATA_S(yB), out);
+                for (size_t j = 0; j < np; j++) {
+                    out[j] = -out[j];
+                }
+            }
+            out[np] = d->m_integrand ? -d->m_integrand->eval(t, NV_DATA_S(y))
+                                     : 0.0;
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_quadB: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -111,7 +376,14 @@ CVodesIntegrator::CVodesIntegrator() :
     m_maxErrTestFails(0),
     m_np(0),
     m_mupper(0), m_mlower(0),
-    m_sens_ok(false)
+    m_sens_ok(false),
+    m_nroots(0),
+    m_rootFound(false),
+    m_adjoint(false),
+    m_adjointInit(false),
+    m_whichB(-1),
+    m_yB(0),
+    m_qB(0)
 {
 }
 
@@ -129,6 +401,12 @@ CVodesIntegrator::~CVodesIntegrator()
     if (m_abstol) {
         N_VDestroy_Serial(m_abstol);
     }
+    if (m_yB) {
+        N_VDestroy_Serial(m_yB);
+    }
+    if (m_qB) {
+        N_VDestroy_Serial(m_qB);
+    }
 }
 
 double& CVodesIntegrator::solution(size_t k)
@@ -264,10 +542,15 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
     m_t0 = t0;
     m_time = t0;
 
-    if (m_y) {
-        N_VDestroy_Serial(m_y); // free solution vector if already allocated
+    // Reuse the solution vector if its size is unchanged, so that pointers
+    // returned by solution() remain valid
+    if (m_y && NV_LENGTH_S(m_y) != static_cast<sd_size_t>(m_neq)) {
+        N_VDestroy_Serial(m_y);
+        m_y = 0;
+    }
+    if (!m_y) {
+        m_y = N_VNew_Serial(static_cast<sd_size_t>(m_neq));
     }
-    m_y = N_VNew_Serial(static_cast<sd_size_t>(m_neq)); // allocate solution vector
     for (size_t i = 0; i < m_neq; i++) {
         NV_Ith_S(m_y, i) = 0.0;
     }
@@ -291,6 +574,9 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
         throw CanteraError("CVodesIntegrator::initialize",
                            "CVodeCreate failed.");
     }
+    m_adjoint = false;
+    m_adjointInit = false;
+    m_whichB = -1;
 
     int flag = CVodeInit(m_cvode_mem, cvodes_rhs, m_t0, m_y);
     if (flag != CV_SUCCESS) {
@@ -333,6 +619,20 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
         throw CanteraError("CVodesIntegrator::initialize",
                            "CVodeSetUserData failed.");
     }
+    if (m_type == DENSE + JAC) {
+        m_fdata->m_denseJac.resize(m_neq, m_neq);
+    } else if (m_type == SPARSE || m_type == GMRES + JAC) {
+        std::vector<std::vector<size_t>> pattern;
+        func.getJacobianPattern(pattern);
+        if (pattern.size() != m_neq) {
+            throw CanteraError("CVodesIntegrator::initialize",
+                "Jacobian pattern has {} rows; expected {}.",
+                pattern.size(), m_neq);
+        }
+        m_fdata->m_jac.setPattern(pattern);
+        m_fdata->m_newton.setPattern(pattern);
+    }
+    initRoots(func);
     if (func.nparams() > 0) {
         sensInit(t0, func);
         flag = CVodeSetSensParams(m_cvode_mem, m_fdata->m_pars.data(),
@@ -353,9 +653,48 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
         throw CanteraError("CVodesIntegrator::reinitialize",
                            "CVodeReInit failed. result = {}", result);
     }
+    m_rootFound = false;
+    m_sens_ok = false;
+    resetAdjoint();
     applyOptions();
 }
 
+void CVodesIntegrator::initRoots(FuncEval& func)
+{
+    m_nroots = func.nRootFunctions();
+    m_rootFound = false;
+    if (m_nroots) {
+        int flag = CVodeRootInit(m_cvode_mem, static_cast<int>(m_nroots),
+                                 cvodes_root);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::initRoots",
+                               "CVodeRootInit failed.");
+        }
+        std::vector<int> directions(m_nroots);
+        func.getRootDirections(directions.data());
+        CVodeSetRootDirection(m_cvode_mem, directions.data());
+    }
+}
+
+void CVodesIntegrator::resetAdjoint()
+{
+    if (!m_adjoint) {
+        return;
+    }
+    m_adjoint = false;
+    initRoots(*m_fdata->m_func);
+    if (m_np) {
+        for (size_t n = 0; n < m_np; n++) {
+            N_VConst(0.0, m_yS[n]);
+        }
+        int flag = CVodeSensReInit(m_cvode_mem, CV_STAGGERED, m_yS);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::resetAdjoint",
+                               "CVodeSensReInit failed. result = {}", flag);
+        }
+    }
+}
+
 void CVodesIntegrator::applyOptions()
 {
     if (m_type == DENSE + NOJAC) {
@@ -365,10 +704,32 @@ void CVodesIntegrator::applyOptions()
         #else
             CVDense(m_cvode_mem, N);
         #endif
+    } else if (m_type == DENSE + JAC) {
+        sd_size_t N = static_cast<sd_size_t>(m_neq);
+        #if SUNDIALS_USE_LAPACK
+            CVLapackDense(m_cvode_mem, N);
+        #else
+            CVDense(m_cvode_mem, N);
+        #endif
+        CVDlsSetDenseJacFn(m_cvode_mem, cvodes_jac);
     } else if (m_type == DIAG) {
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
         CVSpgmr(m_cvode_mem, PREC_NONE, 0);
+    } else if (m_type == SPARSE) {
+        // The sparse direct solvers included with CVODES require external
+        // libraries. Instead, use GMRES preconditioned with the exact sparse
+        // LU factorization of the Newton iteration matrix, which converges in
+        // a single iteration.
+        CVSpgmr(m_cvode_mem, PREC_LEFT, 0);
+        CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                 cvodes_prec_solve);
+    } else if (m_type == GMRES + JAC) {
+        // GMRES preconditioned with the sparse LU factorization of an
+        // approximate Newton iteration matrix
+        CVSpgmr(m_cvode_mem, PREC_LEFT, 0);
+        CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                 cvodes_prec_solve);
     } else if (m_type == BAND + NOJAC) {
         sd_size_t N = static_cast<sd_size_t>(m_neq);
         long int nu = m_mupper;
@@ -402,7 +763,14 @@ void CVodesIntegrator::applyOptions()
 
 void CVodesIntegrator::integrate(double tout)
 {
-    int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
+    int flag;
+    if (m_adjoint) {
+        int ncheck;
+        flag = CVodeF(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL, &ncheck);
+    } else {
+        flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
+    }
+    checkRootError(flag);
     if (flag != CV_SUCCESS) {
         throw CanteraError("CVodesIntegrator::integrate",
             "CVodes error encountered. Error code: {}\n{}\n"
@@ -414,7 +782,14 @@ void CVodesIntegrator::integrate(double tout)
 
 double CVodesIntegrator::step(double tout)
 {
-    int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP);
+    int flag;
+    if (m_adjoint) {
+        int ncheck;
+        flag = CVodeF(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP, &ncheck);
+    } else {
+        flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP);
+    }
+    checkRootError(flag);
     if (flag != CV_SUCCESS) {
         throw CanteraError("CVodesIntegrator::step",
             "CVodes error encountered. Error code: {}\n{}\n"
@@ -426,6 +801,28 @@ double CVodesIntegrator::step(double tout)
     return m_time;
 }
 
+void CVodesIntegrator::checkRootError(int& flag)
+{
+    if (flag == CV_RTFUNC_FAIL && m_fdata->m_rootError) {
+        std::exception_ptr err = m_fdata->m_rootError;
+        m_fdata->m_rootError = nullptr;
+        std::rethrow_exception(err);
+    }
+    m_rootFound = (flag == CV_ROOT_RETURN);
+    if (m_rootFound) {
+        flag = CV_SUCCESS;
+    }
+}
+
+void CVodesIntegrator::getRootInfo(int* roots)
+{
+    if (!m_rootFound) {
+        std::fill(roots, roots + m_nroots, 0);
+        return;
+    }
+    CVodeGetRootInfo(m_cvode_mem, roots);
+}
+
 int CVodesIntegrator::nEvals() const
 {
     long int ne;
@@ -433,12 +830,8 @@ int CVodesIntegrator::nEvals() const
     return ne;
 }
 
-double CVodesIntegrator::sensitivity(size_t k, size_t p)
+void CVodesIntegrator::updateSensitivities()
 {
-    if (m_time == m_t0) {
-        // calls to CVodeGetSens are only allowed after a successful time step.
-        return 0.0;
-    }
     if (!m_sens_ok && m_np) {
         int flag = CVodeGetSens(m_cvode_mem, &m_time, m_yS);
         if (flag != CV_SUCCESS) {
@@ -447,6 +840,15 @@ double CVodesIntegrator::sensitivity(size_t k, size_t p)
         }
         m_sens_ok = true;
     }
+}
+
+double CVodesIntegrator::sensitivity(size_t k, size_t p)
+{
+    if (m_time == m_t0 && !m_sens_ok) {
+        // calls to CVodeGetSens are only allowed after a successful time step.
+        return 0.0;
+    }
+    updateSensitivities();
 
     if (k >= m_neq) {
         throw CanteraError("CVodesIntegrator::sensitivity",
@@ -459,6 +861,267 @@ double CVodesIntegrator::sensitivity(size_t k, size_t p)
     return NV_Ith_S(m_yS[p],k);
 }
 
+std::string CVodesIntegrator::saveState()
+{
+    if (!m_cvode_mem) {
+        throw CanteraError("CVodesIntegrator::saveState",
+                           "Integrator is not initialized.");
+    }
+    double h = 0.0;
+    if (m_time != m_t0) {
+        // Otherwise, no step has been taken since the integrator was
+        // (re)initialized, and the initial step size is estimated by CVODES
+        CVodeGetCurrentStep(m_cvode_mem, &h);
+        updateSensitivities();
+    }
+    CheckpointHeader header;
+    header.magic = checkpointMagic;
+    header.version = checkpointVersion;
+    header.neq = m_neq;
+    header.np = m_np;
+    header.time = m_time;
+    header.step = h;
+
+    size_t n = m_neq * (1 + m_np);
+    std::string state(sizeof(header) + n * sizeof(double), '\0');
+    char* data = &state[0];
+    memcpy(data, &header, sizeof(header));
+    data += sizeof(header);
+    memcpy(data, NV_DATA_S(m_y), m_neq * sizeof(double));
+    data += m_neq * sizeof(double);
+    for (size_t p = 0; p < m_np; p++) {
+        if (m_time == m_t0 && !m_sens_ok) {
+            // Sensitivities are zero at the initial time
+            memset(data, 0, m_neq * sizeof(double));
+        } else {
+            memcpy(data, NV_DATA_S(m_yS[p]), m_neq * sizeof(double));
+        }
+        data += m_neq * sizeof(double);
+    }
+    return state;
+}
+
+void CVodesIntegrator::restoreState(const std::string& state)
+{
+    if (!m_cvode_mem) {
+        throw CanteraError("CVodesIntegrator::restoreState",
+                           "Integrator is not initialized.");
+    }
+    CheckpointHeader header;
+    if (state.size() < sizeof(header)) {
+        throw CanteraError("CVodesIntegrator::restoreState",
+                           "Invalid integrator state.");
+    }
+    memcpy(&header, state.data(), sizeof(header));
+    if (header.magic != checkpointMagic
+        || header.version != checkpointVersion) {
+        throw CanteraError("CVodesIntegrator::restoreState",
+                           "Invalid integrator state.");
+    }
+    if (header.neq != m_neq || header.np != m_np) {
+        throw CanteraError("CVodesIntegrator::restoreState", "Saved state "
+            "has {} equations and {} sensitivity parameters, but the "
+            "integrator has {} and {}.", header.neq, header.np, m_neq, m_np);
+    }
+    size_t n = m_neq * (1 + m_np);
+    if (state.size() != sizeof(header) + n * sizeof(double)) {
+        throw CanteraError("CVodesIntegrator::restoreState",
+                           "Invalid integrator state.");
+    }
+    resetAdjoint();
+
+    const char* data = state.data() + sizeof(header);
+    memcpy(NV_DATA_S(m_y), data, m_neq * sizeof(double));
+    data += m_neq * sizeof(double);
+    for (size_t p = 0; p < m_np; p++) {
+        memcpy(NV_DATA_S(m_yS[p]), data, m_neq * sizeof(double));
+        data += m_neq * sizeof(double);
+    }
+
+    m_t0 = header.time;
+    m_time = header.time;
+    int flag = CVodeReInit(m_cvode_mem, m_t0, m_y);
+    if (flag != CV_SUCCESS) {
+        throw CanteraError("CVodesIntegrator::restoreState",
+                           "CVodeReInit failed. result = {}", flag);
+    }
+    if (m_np) {
+        flag = CVodeSensReInit(m_cvode_mem, CV_STAGGERED, m_yS);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::restoreState",
+                               "CVodeSensReInit failed. result = {}", flag);
+        }
+    }
+    m_rootFound = false;
+    m_sens_ok = true;
+    applyOptions();
+    if (header.step > 0) {
+        CVodeSetInitStep(m_cvode_mem, header.step);
+    }
+}
+
+void CVodesIntegrator::initAdjoint(int steps)
+{
+    if (!m_cvode_mem) {
+        throw CanteraError("CVodesIntegrator::initAdjoint",
+                           "Integrator is not initialized.");
+    }
+    if (m_time != m_t0) {
+        throw CanteraError("CVodesIntegrator::initAdjoint", "The integrator "
+            "must be (re)initialized before calling initAdjoint.");
+    }
+    int flag;
+    if (!m_adjointInit) {
+        flag = CVodeAdjInit(m_cvode_mem, steps, CV_HERMITE);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::initAdjoint",
+                               "CVodeAdjInit failed. result = {}", flag);
+        }
+        m_adjointInit = true;
+    } else {
+        flag = CVodeAdjReInit(m_cvode_mem);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::initAdjoint",
+                               "CVodeAdjReInit failed. result = {}", flag);
+        }
+    }
+
+    // The root functions would interrupt the forward integration, and the
+    // forward sensitivities aren't needed
+    if (m_nroots) {
+        CVodeRootInit(m_cvode_mem, 0, NULL);
+        m_rootFound = false;
+    }
+    if (m_np) {
+        CVodeSensToggleOff(m_cvode_mem);
+        m_sens_ok = false;
+    }
+    m_adjoint = true;
+}
+
+double CVodesIntegrator::solveAdjoint(double tend, const double* lambda,
+                                      AdjointIntegrand* g, double* grad)
+{
+    if (!m_adjoint) {
+        throw CanteraError("CVodesIntegrator::solveAdjoint",
+            "initAdjoint must be called before integrating the system.");
+    }
+    if (tend < m_t0 || tend > m_time) {
+        throw CanteraError("CVodesIntegrator::solveAdjoint", "End time {} is"
+            " outside of the integration interval [{}, {}].", tend, m_t0,
+            m_time);
+    }
+    sd_size_t N = static_cast<sd_size_t>(m_neq);
+    sd_size_t NQ = static_cast<sd_size_t>(m_np + 1);
+    if (!m_yB || NV_LENGTH_S(m_yB) != N) {
+        if (m_yB) {
+            N_VDestroy_Serial(m_yB);
+        }
+        m_yB = N_VNew_Serial(N);
+    }
+    if (!m_qB || NV_LENGTH_S(m_qB) != NQ) {
+        if (m_qB) {
+            N_VDestroy_Serial(m_qB);
+        }
+        m_qB = N_VNew_Serial(NQ);
+    }
+    std::copy(lambda, lambda + m_neq, NV_DATA_S(m_yB));
+    N_VConst(0.0, m_qB);
+
+    // Scale the absolute tolerance by the magnitude of the adjoint
+    // variables, which is given by their final values or, for a functional
+    // with only an integral part, by the derivatives of the integrand times
+    // the length of the integration interval
+    double scale = N_VMaxNorm(m_yB);
+    m_fdata->m_integrand = g;
+    if (g) {
+        vector_fp y(m_neq);
+        m_fdata->m_dgdy.resize(m_neq);
+        getInterpolatedSolution(tend, y.data());
+        g->getGradient(tend, y.data(), m_fdata->m_dgdy.data());
+        for (size_t i = 0; i < m_neq; i++) {
+            scale = std::max(scale,
+                             (tend - m_t0) * fabs(m_fdata->m_dgdy[i]));
+        }
+    }
+    if (scale == 0.0) {
+        scale = 1.0;
+    }
+    m_fdata->m_adjJac.resize(m_neq, m_neq);
+    m_fdata->m_adjJacTime = std::numeric_limits<double>::quiet_NaN();
+
+    int flag;
+    if (m_whichB < 0) {
+        flag = CVodeCreateB(m_cvode_mem, CV_BDF, CV_NEWTON, &m_whichB);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::solveAdjoint",
+                               "CVodeCreateB failed. result = {}", flag);
+        }
+        flag = CVodeInitB(m_cvode_mem, m_whichB, cvodes_rhsB, tend, m_yB);
+        if (flag != CV_SUCCESS) {
+            m_whichB = -1;
+            throw CanteraError("CVodesIntegrator::solveAdjoint",
+                               "CVodeInitB failed. result = {}", flag);
+        }
+        CVodeSetUserDataB(m_cvode_mem, m_whichB, m_fdata.get());
+        #if SUNDIALS_USE_LAPACK
+            CVLapackDenseB(m_cvode_mem, m_whichB, N);
+        #else
+            CVDenseB(m_cvode_mem, m_whichB, N);
+        #endif
+        CVDlsSetDenseJacFnB(m_cvode_mem, m_whichB, cvodes_jacB);
+        flag = CVodeQuadInitB(m_cvode_mem, m_whichB, cvodes_quadB, m_qB);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::solveAdjoint",
+                               "CVodeQuadInitB failed. result = {}", flag);
+        }
+    } else {
+        flag = CVodeReInitB(m_cvode_mem, m_whichB, tend, m_yB);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::solveAdjoint",
+                               "CVodeReInitB failed. result = {}", flag);
+        }
+        CVodeQuadReInitB(m_cvode_mem, m_whichB, m_qB);
+    }
+    CVodeSStolerancesB(m_cvode_mem, m_whichB, m_reltolsens,
+                       m_abstolsens * scale);
+    CVodeQuadSStolerancesB(m_cvode_mem, m_whichB, m_reltolsens,
+                           m_abstolsens * scale);
+    CVodeSetQuadErrConB(m_cvode_mem, m_whichB, TRUE);
+    if (m_maxsteps > 0) {
+        CVodeSetMaxNumStepsB(m_cvode_mem, m_whichB, m_maxsteps);
+    }
+    if (m_hmax > 0) {
+        CVodeSetMaxStepB(m_cvode_mem, m_whichB, m_hmax);
+    }
+
+    flag = CVodeB(m_cvode_mem, m_t0, CV_NORMAL);
+    m_fdata->m_integrand = 0;
+    if (flag < 0) {
+        throw CanteraError("CVodesIntegrator::solveAdjoint",
+            "CVodes error encountered while solving the adjoint equations. "
+            "Error code: {}\n{}", flag, m_error_message);
+    }
+    double tret;
+    CVodeGetB(m_cvode_mem, m_whichB, &tret, m_yB);
+    CVodeGetQuadB(m_cvode_mem, m_whichB, &tret, m_qB);
+    std::copy(NV_DATA_S(m_qB), NV_DATA_S(m_qB) + m_np, grad);
+    return NV_Ith_S(m_qB, m_np);
+}
+
+void CVodesIntegrator::getInterpolatedSolution(double t, double* y)
+{
+    N_Vector yt = N_VNew_Serial(static_cast<sd_size_t>(m_neq));
+    int flag = CVodeGetDky(m_cvode_mem, t, 0, yt);
+    std::copy(NV_DATA_S(yt), NV_DATA_S(yt) + m_neq, y);
+    N_VDestroy_Serial(yt);
+    if (flag != CV_SUCCESS) {
+        throw CanteraError("CVodesIntegrator::getInterpolatedSolution",
+            "Time {} is outside of the last time step. Error code: {}",
+            t, flag);
+    }
+}
+
 string CVodesIntegrator::getErrorInfo(int N)
 {
     N_Vector errs = N_VNew_Serial(static_cast<sd_size_t>(m_neq));
@@ -166,6 +166,9 @@ IDA_Solver::~IDA_Solver()
     if (m_constraints) {
         N_VDestroy_Serial(m_constraints);
     }
+    if (m_id) {
+        N_VDestroy_Serial(m_id);
+    }
 }
 
 doublereal IDA_Solver::solution(int k) const
@@ -234,7 +237,7 @@ void IDA_Solver::setDenseLinearSolver()
 void IDA_Solver::setBandedLinearSolver(int m_upper, int m_lower)
 {
     m_type = 2;
-    m_upper = m_mupper;
+    m_mupper = m_upper;
     m_mlower = m_lower;
 }
 
@@ -455,6 +458,21 @@ void IDA_Solver::init(doublereal t0)
                                "IDASetMaxConvFails failed.");
         }
     }
+    // Identify the algebraic components, which is required by
+    // IDASetSuppressAlg and by IDACalcIC with the IDA_YA_YDP_INIT option
+    bool hasAlgebraic = false;
+    m_id = N_VNew_Serial(m_neq);
+    for (int i = 0; i < m_neq; i++) {
+        bool alg = m_resid.isAlgebraic(i);
+        NV_Ith_S(m_id, i) = alg ? 0.0 : 1.0;
+        hasAlgebraic = hasAlgebraic || alg;
+    }
+    if (hasAlgebraic) {
+        flag = IDASetId(m_ida_mem, m_id);
+        if (flag != IDA_SUCCESS) {
+            throw CanteraError("IDA_Solver::init", "IDASetId failed.");
+        }
+    }
     if (m_setSuppressAlg != 0) {
         flag = IDASetSuppressAlg(m_ida_mem, m_setSuppressAlg);
         if (flag != IDA_SUCCESS) {
@@ -0,0 +1,285 @@
+//! @file SparseMatrix.cpp
+
+#include "cantera/numerics/SparseMatrix.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <set>
+
+using namespace std;
+
+namespace Cantera
+{
+
+SparseMatrix::SparseMatrix() :
+    m_n(0),
+    m_factored(false)
+{
+}
+
+void SparseMatrix::setPattern(const std::vector<std::vector<size_t>>& rows)
+{
+    m_n = rows.size();
+    m_rowStart.assign(1, 0);
+    m_cols.clear();
+    for (size_t i = 0; i < m_n; i++) {
+        vector<size_t> cols = rows[i];
+        cols.push_back(i);
+        sort(cols.begin(), cols.end());
+        cols.erase(unique(cols.begin(), cols.end()), cols.end());
+        if (cols.back() >= m_n) {
+            throw IndexError("SparseMatrix::setPattern", "rows", cols.back(),
+                             m_n - 1);
+        }
+        m_cols.insert(m_cols.end(), cols.begin(), cols.end());
+        m_rowStart.push_back(m_cols.size());
+    }
+    m_values.assign(m_cols.size(), 0.0);
+    m_luStart.clear();
+    m_luCols.clear();
+    m_luDiag.clear();
+    m_luMap.clear();
+    m_lu.clear();
+    m_perm.clear();
+    m_iperm.clear();
+    m_work.assign(m_n, 0.0);
+    m_factored = false;
+}
+
+size_t SparseMatrix::index(size_t i, size_t j) const
+{
+    if (i >= m_n) {
+        return npos;
+    }
+    auto begin = m_cols.begin() + m_rowStart[i];
+    auto end = m_cols.begin() + m_rowStart[i+1];
+    auto iter = lower_bound(begin, end, j);
+    if (iter == end || *iter != j) {
+        return npos;
+    }
+    return iter - m_cols.begin();
+}
+
+double& SparseMatrix::value(size_t i, size_t j)
+{
+    size_t n = index(i, j);
+    if (n == npos) {
+        throw CanteraError("SparseMatrix::value",
+            "Element ({}, {}) is not part of the sparsity pattern", i, j);
+    }
+    return m_values[n];
+}
+
+double SparseMatrix::value(size_t i, size_t j) const
+{
+    size_t n = index(i, j);
+    return (n == npos) ? 0.0 : m_values[n];
+}
+
+void SparseMatrix::zero()
+{
+    fill(m_values.begin(), m_values.end(), 0.0);
+}
+
+void SparseMatrix::setIdentityMinus(double gamma, const SparseMatrix& A)
+{
+    if (A.m_cols.size() != m_cols.size() || A.m_n != m_n) {
+        throw CanteraError("SparseMatrix::setIdentityMinus",
+                           "Sparsity patterns do not match");
+    }
+    for (size_t n = 0; n < m_values.size(); n++) {
+        m_values[n] = -gamma * A.m_values[n];
+    }
+    for (size_t i = 0; i < m_n; i++) {
+        m_values[index(i, i)] += 1.0;
+    }
+}
+
+void SparseMatrix::orderUnknowns()
+{
+    // Greedy minimum degree ordering of the graph of the symmetrized
+    // sparsity pattern. Eliminating a node connects all of its neighbors.
+    vector<vector<size_t>> adj(m_n);
+    for (size_t i = 0; i < m_n; i++) {
+        for (size_t n = m_rowStart[i]; n < m_rowStart[i+1]; n++) {
+            size_t j = m_cols[n];
+            if (j != i) {
+                adj[i].push_back(j);
+                adj[j].push_back(i);
+            }
+        }
+    }
+    set<pair<size_t, size_t>> queue; // (degree, node)
+    for (size_t i = 0; i < m_n; i++) {
+        sort(adj[i].begin(), adj[i].end());
+        adj[i].erase(unique(adj[i].begin(), adj[i].end()), adj[i].end());
+        queue.emplace(adj[i].size(), i);
+    }
+
+    m_perm.clear();
+    vector<size_t> merged;
+    while (!queue.empty()) {
+        size_t p = queue.begin()->second;
+        queue.erase(queue.begin());
+        m_perm.push_back(p);
+        for (size_t a : adj[p]) {
+            queue.erase({adj[a].size(), a});
+            merged.clear();
+            set_union(adj[a].begin(), adj[a].end(), adj[p].begin(),
+                      adj[p].end(), back_inserter(merged));
+            adj[a].clear();
+            for (size_t j : merged) {
+                if (j != a && j != p) {
+                    adj[a].push_back(j);
+                }
+            }
+            queue.emplace(adj[a].size(), a);
+        }
+        adj[p].clear();
+    }
+    m_iperm.resize(m_n);
+    for (size_t i = 0; i < m_n; i++) {
+        m_iperm[m_perm[i]] = i;
+    }
+}
+
+void SparseMatrix::analyze()
+{
+    orderUnknowns();
+
+    // Symbolic elimination: the pattern of row i of the factors is the
+    // pattern of row i of the permuted matrix, plus the pattern of the upper
+    // triangular part of each row k < i for which L(i,k) is nonzero.
+    m_luStart.assign(1, 0);
+    m_luCols.clear();
+    m_luDiag.resize(m_n);
+    vector<char> marked(m_n, 0);
+    vector<size_t> rowCols;
+    priority_queue<size_t, vector<size_t>, greater<size_t>> pending;
+    for (size_t i = 0; i < m_n; i++) {
+        size_t row = m_perm[i];
+        rowCols.clear();
+        for (size_t n = m_rowStart[row]; n < m_rowStart[row+1]; n++) {
+            size_t j = m_iperm[m_cols[n]];
+            rowCols.push_back(j);
+            marked[j] = 1;
+            if (j < i) {
+                pending.push(j);
+            }
+        }
+        while (!pending.empty()) {
+            size_t k = pending.top();
+            pending.pop();
+            for (size_t q = m_luDiag[k] + 1; q < m_luStart[k+1]; q++) {
+                size_t j = m_luCols[q];
+                if (!marked[j]) {
+                    marked[j] = 1;
+                    rowCols.push_back(j);
+                    if (j < i) {
+                        pending.push(j);
+                    }
+                }
+            }
+        }
+        sort(rowCols.begin(), rowCols.end());
+        for (size_t j : rowCols) {
+            marked[j] = 0;
+            if (j == i) {
+                m_luDiag[i] = m_luCols.size();
+            }
+            m_luCols.push_back(j);
+        }
+        m_luStart.push_back(m_luCols.size());
+    }
+
+    // Position of each entry of the matrix within the factors
+    m_luMap.resize(m_cols.size());
+    for (size_t row = 0; row < m_n; row++) {
+        size_t i = m_iperm[row];
+        auto begin = m_luCols.begin() + m_luStart[i];
+        auto end = m_luCols.begin() + m_luStart[i+1];
+        for (size_t n = m_rowStart[row]; n < m_rowStart[row+1]; n++) {
+            m_luMap[n] = lower_bound(begin, end, m_iperm[m_cols[n]])
+                         - m_luCols.begin();
+        }
+    }
+    m_lu.resize(m_luCols.size());
+}
+
+int SparseMatrix::factor()
+{
+    if (m_luStart.size() != m_n + 1) {
+        analyze();
+    }
+    m_factored = false;
+    fill(m_lu.begin(), m_lu.end(), 0.0);
+    for (size_t n = 0; n < m_values.size(); n++) {
+        m_lu[m_luMap[n]] = m_values[n];
+    }
+
+    // Row-by-row (IKJ) elimination using a dense work array for the current
+    // row. All columns touched while eliminating row i are part of the
+    // pattern of row i, as determined by analyze().
+    for (size_t i = 0; i < m_n; i++) {
+        size_t begin = m_luStart[i];
+        size_t end = m_luStart[i+1];
+        for (size_t q = begin; q < end; q++) {
+            m_work[m_luCols[q]] = m_lu[q];
+        }
+        for (size_t q = begin; q < m_luDiag[i]; q++) {
+            size_t k = m_luCols[q];
+            double lik = m_work[k] / m_lu[m_luDiag[k]];
+            m_work[k] = lik;
+            for (size_t r = m_luDiag[k] + 1; r < m_luStart[k+1]; r++) {
+                m_work[m_luCols[r]] -= lik * m_lu[r];
+            }
+        }
+        for (size_t q = begin; q < end; q++) {
+            m_lu[q] = m_work[m_luCols[q]];
+            m_work[m_luCols[q]] = 0.0;
+        }
+        double pivot = m_lu[m_luDiag[i]];
+        if (pivot == 0.0 || !std::isfinite(pivot)) {
+            return static_cast<int>(m_perm[i]) + 1;
+        }
+    }
+    m_factored = true;
+    return 0;
+}
+
+void SparseMatrix::solve(double* b) const
+{
+    if (!m_factored) {
+        throw CanteraError("SparseMatrix::solve",
+                           "Matrix has not been successfully factored");
+    }
+    vector_fp x(m_n);
+    for (size_t i = 0; i < m_n; i++) {
+        x[i] = b[m_perm[i]];
+    }
+    // Forward substitution with the unit lower triangular factor
+    for (size_t i = 0; i < m_n; i++) {
+        double sum = x[i];
+        for (size_t q = m_luStart[i]; q < m_luDiag[i]; q++) {
+            sum -= m_lu[q] * x[m_luCols[q]];
+        }
+        x[i] = sum;
+    }
+    // Back substitution with the upper triangular factor
+    for (size_t i = m_n; i-- > 0;) {
+        double sum = x[i];
+        for (size_t q = m_luDiag[i] + 1; q < m_luStart[i+1]; q++) {
+            sum -= m_lu[q] * x[m_luCols[q]];
+        }
+        x[i] = sum / m_lu[m_luDiag[i]];
+    }
+    for (size_t i = 0; i < m_n; i++) {
+        b[m_perm[i]] = x[i];
+    }
+}
+
+}
@@ -7,6 +7,7 @@
 #include "cantera/oneD/StFlow.h"
 #include "cantera/base/ctml.h"
 #include "cantera/transport/TransportBase.h"
+#include "cantera/transport/DustyGasTransport.h"
 #include "cantera/numerics/funcs.h"
 #include "cantera/oneD/MultiJac.h"
 #include "cantera/oneD/OneDim.h"
@@ -453,11 +454,29 @@ void StFlow::eval(size_t jg, doublereal* xg,
 void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
 {
     if (m_transport_option == c_Mixav_Transport) {
+        // Evaluate the properties at all of the midpoints with a single call,
+        // rather than setting the state of the gas at each point
+        size_t npts = j1 - j0;
+        m_tmid.resize(npts);
+        m_pmid.assign(npts, m_press);
+        m_ymid.resize(npts*m_nsp);
         for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMixDiffCoeffs(&m_diff[j*m_nsp]);
-            m_tcon[j] = m_trans->thermalConductivity();
+            m_tmid[j-j0] = 0.5*(T(x,j) + T(x,j+1));
+            const doublereal* yyj = x + m_nv*j + c_offset_Y;
+            const doublereal* yyjp = x + m_nv*(j+1) + c_offset_Y;
+            doublereal* yy = &m_ymid[(j-j0)*m_nsp];
+            for (size_t k = 0; k < m_nsp; k++) {
+                yy[k] = 0.5*(yyj[k] + yyjp[k]);
+            }
+        }
+        // The mass fractions are used without normalization, as in
+        // setGasAtMidpoint()
+        m_trans->getMixtureProperties_NoNorm(npts, m_tmid.data(),
+                                             m_pmid.data(), m_ymid.data(),
+                                             m_dovisc ? &m_visc[j0] : 0,
+                                             &m_tcon[j0], &m_diff[j0*m_nsp]);
+        if (!m_dovisc) {
+            std::fill(m_visc.begin() + j0, m_visc.begin() + j1, 0.0);
         }
     } else if (m_transport_option == c_Multi_Transport) {
         for (size_t j = j0; j < j1; j++) {
@@ -980,16 +999,25 @@ void PorousFlow::eval(size_t jg, doublereal* xg,
     //              update properties
     //-----------------------------------------------------
 
+    // the porosity and pore diameter are needed by the dusty-gas fluxes
+    updatePoreProperties();
+
     updateThermo(x, j0, j1);
     // update transport properties only if a Jacobian is not
     // being evaluated
     if (jg == npos) {
         updateTransport(x, j0, j1);
+        if (m_dgtran) {
+            updateDustyGasTransport(x, j0, j1);
+        }
     }
 
     // update the species diffusive mass fluxes whether or not a
     // Jacobian is being evaluated
     updateDiffFluxes(x, j0, j1);
+    if (m_dgtran) {
+        updateDustyGasFluxes(x, j0, j1);
+    }
 
 
     //----------------------------------------------------
@@ -1006,8 +1034,6 @@ void PorousFlow::eval(size_t jg, doublereal* xg,
     //initialize property vectors
     //
     //
-    pore.resize(length);
-    diam.resize(length);
     scond.resize(length);
     //vector<double> scond(length);
     vector<double> Omega(length);
@@ -1017,22 +1043,6 @@ void PorousFlow::eval(size_t jg, doublereal* xg,
    
     for (int i=0; i<=length-1;i++)
     {
-      if (z(i)<m_zmid-m_dzmid)
-      {
-        pore[i]=pore1;
-        diam[i]=diam1;
-      }
-      else if (z(i)>m_zmid+m_dzmid)
-      {
-        pore[i]=pore2;
-        diam[i]=diam2;
-      }
-      else
-      {
-        pore[i]=(((pore2-pore1)/(2*m_dzmid))*(z(i)-(m_zmid-m_dzmid) ))+pore1;
-        diam[i]=(((diam2-diam1)/(2*m_dzmid))*(z(i)-(m_zmid-m_dzmid) ))+diam1;
-	
-       }
        RK[i]=(3*(1-pore[i])/diam[i]);   //extinction coefficient, PSZ, Hsu and Howell(1992)
        Cmult[i]=-400*diam[i]+0.687;	// Nusselt number coefficients
        mpow[i]=443.7*diam[i]+0.361;
@@ -1236,6 +1246,89 @@ void PorousFlow::eval(size_t jg, doublereal* xg,
     }
 }
 
+void PorousFlow::updatePoreProperties()
+{
+    pore.resize(m_points);
+    diam.resize(m_points);
+    for (size_t i = 0; i < m_points; i++) {
+        if (z(i) < m_zmid-m_dzmid) {
+            pore[i] = pore1;
+            diam[i] = diam1;
+        } else if (z(i) > m_zmid+m_dzmid) {
+            pore[i] = pore2;
+            diam[i] = diam2;
+        } else {
+            pore[i] = ((pore2-pore1)/(2*m_dzmid))*(z(i)-(m_zmid-m_dzmid)) + pore1;
+            diam[i] = ((diam2-diam1)/(2*m_dzmid))*(z(i)-(m_zmid-m_dzmid)) + diam1;
+        }
+    }
+}
+
+void PorousFlow::setDustyGasTransport(DustyGasTransport* dgt, Tortuosity* tort)
+{
+    std::unique_ptr<Tortuosity> t(tort ? tort : new Tortuosity());
+    if (dgt && dgt->thermo().nSpecies() != m_nsp) {
+        throw CanteraError("PorousFlow::setDustyGasTransport",
+            "The phase of the dusty-gas transport manager has {} species, "
+            "but this domain has {}.", dgt->thermo().nSpecies(), m_nsp);
+    }
+    m_dgtran = dgt;
+    m_tortuosity = std::move(t);
+    m_dgH.clear();
+    m_dgwork.resize(m_nsp);
+}
+
+void PorousFlow::updateDustyGasTransport(const doublereal* x, size_t j0,
+                                         size_t j1)
+{
+    ThermoPhase& gas = m_dgtran->thermo();
+    m_dgH.resize(m_points);
+    for (size_t j = j0; j < j1; j++) {
+        const doublereal* yyj = x + m_nv*j + c_offset_Y;
+        const doublereal* yyjp = x + m_nv*(j+1) + c_offset_Y;
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_dgwork[k] = 0.5*(yyj[k] + yyjp[k]);
+        }
+        gas.setTemperature(0.5*(T(x,j) + T(x,j+1)));
+        gas.setMassFractions_NoNorm(m_dgwork.data());
+        gas.setPressure(m_press);
+
+        // properties of the porous medium at the midpoint
+        doublereal phi = 0.5*(pore[j] + pore[j+1]);
+        doublereal d = 0.5*(diam[j] + diam[j+1]);
+        m_dgtran->setPorosity(phi);
+        m_dgtran->setTortuosity(1.0/m_tortuosity->tortuosityFactor(phi));
+        m_dgtran->setMeanPoreRadius(0.5*d);
+        m_dgtran->setMeanParticleDiameter(d);
+        m_dgtran->getFactoredHMatrix(m_dgH[j]);
+    }
+}
+
+void PorousFlow::updateDustyGasFluxes(const doublereal* x, size_t j0,
+                                      size_t j1)
+{
+    for (size_t j = j0; j < j1; j++) {
+        doublereal dz = z(j+1) - z(j);
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_dgwork[k] = (density(j)*Y(x,k,j) - density(j+1)*Y(x,k,j+1))
+                          / (m_wt[k]*dz);
+        }
+        // molar fluxes per unit total area, J = -H^-1 dC/dz
+        m_dgH[j].solve(m_dgwork.data());
+
+        // m_flux is multiplied by the porosity in the species equations
+        doublereal sum = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_flux(k,j) = m_wt[k]*m_dgwork[k]/pore[j];
+            sum -= m_flux(k,j);
+        }
+        // correction flux to insure that \sum_k Y_k V_k = 0.
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_flux(k,j) += sum*Y(x,k,j);
+        }
+    }
+}
+
 void PorousFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
 {
 	AxiStagnFlow::restore(dom,soln,loglevel);
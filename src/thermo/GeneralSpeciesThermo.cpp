@@ -29,16 +29,7 @@ GeneralSpeciesThermo::GeneralSpeciesThermo(const GeneralSpeciesThermo& b) :
     m_thigh_min(b.m_thigh_min),
     m_p0(b.m_p0)
 {
-    m_sp.clear();
-    // Copy SpeciesThermoInterpTypes from 'b'
-    for (const auto& sp : b.m_sp) {
-        for (size_t k = 0; k < sp.second.size(); k++) {
-            size_t i = sp.second[k].first;
-            shared_ptr<SpeciesThermoInterpType> spec(
-                sp.second[k].second->duplMyselfAsSpeciesThermoInterpType());
-            m_sp[sp.first].emplace_back(i, spec);
-        }
-    }
+    copySTITs(b);
 }
 
 GeneralSpeciesThermo&
@@ -49,16 +40,7 @@ GeneralSpeciesThermo::operator=(const GeneralSpeciesThermo& b)
     }
 
     SpeciesThermo::operator=(b);
-    m_sp.clear();
-    // Copy SpeciesThermoInterpType objects from 'b'
-    for (const auto& sp : b.m_sp) {
-        for (size_t k = 0; k < sp.second.size(); k++) {
-            size_t i = sp.second[k].first;
-            shared_ptr<SpeciesThermoInterpType> spec(
-                sp.second[k].second->duplMyselfAsSpeciesThermoInterpType());
-            m_sp[sp.first].emplace_back(i, spec);
-        }
-    }
+    copySTITs(b);
 
     m_tpoly = b.m_tpoly;
     m_speciesLoc = b.m_speciesLoc;
@@ -68,6 +50,27 @@ GeneralSpeciesThermo::operator=(const GeneralSpeciesThermo& b)
     return *this;
 }
 
+void GeneralSpeciesThermo::copySTITs(const GeneralSpeciesThermo& b)
+{
+    m_sp.clear();
+    m_privateSTITs.clear();
+    for (const auto& sp : b.m_sp) {
+        for (size_t k = 0; k < sp.second.size(); k++) {
+            size_t i = sp.second[k].first;
+            shared_ptr<SpeciesThermoInterpType> spec = sp.second[k].second;
+            // STITbyPDSS objects point back to the PDSS objects of a single
+            // phase, and have to be duplicated. Private copies made by
+            // modifyOneHf298 must also stay private to each object.
+            if (dynamic_cast<STITbyPDSS*>(spec.get()) ||
+                b.m_privateSTITs.count(i)) {
+                spec.reset(spec->duplMyselfAsSpeciesThermoInterpType());
+                m_privateSTITs.insert(i);
+            }
+            m_sp[sp.first].emplace_back(i, spec);
+        }
+    }
+}
+
 SpeciesThermo* GeneralSpeciesThermo::duplMyselfAsSpeciesThermo() const
 {
     return new GeneralSpeciesThermo(*this);
@@ -216,10 +219,19 @@ doublereal GeneralSpeciesThermo::reportOneHf298(const size_t k) const
 
 void GeneralSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298New)
 {
-    SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
-    if (sp_ptr) {
-        sp_ptr->modifyOneHf298(k, Hf298New);
+    auto loc = m_speciesLoc.find(k);
+    if (loc == m_speciesLoc.end()) {
+        return;
+    }
+    shared_ptr<SpeciesThermoInterpType>& stit =
+        m_sp[loc->second.first][loc->second.second].second;
+    // The parameterization may be shared with other phases or with the
+    // corresponding Species object, so only a private copy is modified
+    if (!m_privateSTITs.count(k)) {
+        stit.reset(stit->duplMyselfAsSpeciesThermoInterpType());
+        m_privateSTITs.insert(k);
     }
+    stit->modifyOneHf298(k, Hf298New);
 }
 
 }
@@ -95,22 +95,19 @@ void IdealGasPhase::getActivityCoefficients(doublereal* ac) const
 
 void IdealGasPhase::getStandardChemPotentials(doublereal* muStar) const
 {
-    const vector_fp& gibbsrt = gibbs_RT_ref();
-    scale(gibbsrt.begin(), gibbsrt.end(), muStar, RT());
-    double tmp = log(pressure() / m_spthermo->refPressure()) * RT();
-    for (size_t k = 0; k < m_kk; k++) {
-        muStar[k] += tmp; // add RT*ln(P/P_0)
-    }
+    const vector_fp& mu0 = standardChemPotentials();
+    copy(mu0.begin(), mu0.end(), muStar);
 }
 
 //  Partial Molar Properties of the Solution --------------
 
 void IdealGasPhase::getChemPotentials(doublereal* mu) const
 {
-    getStandardChemPotentials(mu);
+    const vector_fp& mu0 = standardChemPotentials();
+    const vector_fp& logx = logMoleFractions();
+    doublereal rt = RT();
     for (size_t k = 0; k < m_kk; k++) {
-        double xx = std::max(SmallNumber, moleFraction(k));
-        mu[k] += RT() * log(xx);
+        mu[k] = mu0[k] + rt * logx[k];
     }
 }
 
@@ -125,9 +122,9 @@ void IdealGasPhase::getPartialMolarEntropies(doublereal* sbar) const
     const vector_fp& _s = entropy_R_ref();
     scale(_s.begin(), _s.end(), sbar, GasConstant);
     doublereal logp = log(pressure() / m_spthermo->refPressure());
+    const vector_fp& logx = logMoleFractions();
     for (size_t k = 0; k < m_kk; k++) {
-        doublereal xx = std::max(SmallNumber, moleFraction(k));
-        sbar[k] += GasConstant * (-logp - log(xx));
+        sbar[k] += GasConstant * (-logp - logx[k]);
     }
 }
 
@@ -183,12 +180,8 @@ void IdealGasPhase::getGibbs_RT(doublereal* grt) const
 
 void IdealGasPhase::getPureGibbs(doublereal* gpure) const
 {
-    const vector_fp& gibbsrt = gibbs_RT_ref();
-    scale(gibbsrt.begin(), gibbsrt.end(), gpure, RT());
-    double tmp = log(pressure() / m_spthermo->refPressure()) * RT();
-    for (size_t k = 0; k < m_kk; k++) {
-        gpure[k] += tmp;
-    }
+    const vector_fp& mu0 = standardChemPotentials();
+    copy(mu0.begin(), mu0.end(), gpure);
 }
 
 void IdealGasPhase::getIntEnergy_RT(doublereal* urt) const
@@ -300,6 +293,23 @@ void IdealGasPhase::setToEquilState(const doublereal* mu_RT)
     setState_PX(pres, &m_pp[0]);
 }
 
+const vector_fp& IdealGasPhase::standardChemPotentials() const
+{
+    static const int cacheId = m_cache.getId();
+    CachedArray cached = m_cache.getArray(cacheId);
+    doublereal pres = pressure();
+    if (!cached.validate(temperature(), pres)) {
+        const vector_fp& gibbsrt = gibbs_RT_ref();
+        cached.value.resize(m_kk);
+        scale(gibbsrt.begin(), gibbsrt.end(), cached.value.begin(), RT());
+        double tmp = log(pres / m_spthermo->refPressure()) * RT();
+        for (size_t k = 0; k < m_kk; k++) {
+            cached.value[k] += tmp; // add RT*ln(P/P_0)
+        }
+    }
+    return cached.value;
+}
+
 void IdealGasPhase::_updateThermo() const
 {
     static const int cacheId = m_cache.getId();
@@ -324,6 +324,7 @@ void LatticeSolidPhase::installSlavePhases(XML_Node* phaseNode)
     size_t kk = 0;
     size_t kstart = 0;
     m_speciesData.clear();
+    m_speciesDataStore.clear();
 
     XML_Node& la = phaseNode->child("thermo").child("LatticeArray");
     std::vector<XML_Node*> lattices = la.getChildren("phase");
@@ -453,7 +454,9 @@ void LatticeSolidPhase::modifyOneHf298SS(const size_t k, const doublereal Hf298N
             l_spthermo.modifyOneHf298(kk, Hf298New);
         }
     }
+    modifySpeciesHf298(k, Hf298New);
     m_tlast += 0.0001234;
+    invalidateCache();
     _updateThermo();
 }
 
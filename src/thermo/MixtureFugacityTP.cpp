@@ -114,7 +114,9 @@ void MixtureFugacityTP::getEnthalpy_RT(doublereal* hrt) const
 void MixtureFugacityTP::modifyOneHf298SS(const size_t k, const doublereal Hf298New)
 {
     m_spthermo->modifyOneHf298(k, Hf298New);
+    modifySpeciesHf298(k, Hf298New);
     m_Tlast_ref += 0.0001234;
+    invalidateCache();
 }
 
 void MixtureFugacityTP::getEntropy_R(doublereal* sr) const
@@ -582,6 +584,24 @@ doublereal MixtureFugacityTP::densityCalc(doublereal TKelvin, doublereal presPa,
     return densBase;
 }
 
+void MixtureFugacityTP::getDensities_TP(size_t nStates, const doublereal* TKelvin,
+                                        const doublereal* pressure, doublereal* rho,
+                                        int phaseRequested)
+{
+    doublereal tSave = temperature();
+    doublereal rhoSave = density();
+    doublereal mmw = meanMolecularWeight();
+    for (size_t n = 0; n < nStates; n++) {
+        // Without a requested phase, start from the ideal gas density
+        doublereal rhoguess = -1.0;
+        if (phaseRequested == FLUID_UNDEFINED) {
+            rhoguess = pressure[n] * mmw / (GasConstant * TKelvin[n]);
+        }
+        rho[n] = densityCalc(TKelvin[n], pressure[n], phaseRequested, rhoguess);
+    }
+    setState_TR(tSave, rhoSave);
+}
+
 void MixtureFugacityTP::updateMixingExpressions()
 {
 }
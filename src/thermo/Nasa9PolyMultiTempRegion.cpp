@@ -19,13 +19,11 @@ using namespace std;
 
 namespace Cantera
 {
-Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion() :
-    m_currRegion(0)
+Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion()
 {
 }
 
-Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion(vector<Nasa9Poly1*>& regionPts) :
-    m_currRegion(0)
+Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion(vector<Nasa9Poly1*>& regionPts)
 {
     // From now on, we own these pointers
     for (Nasa9Poly1* region : regionPts) {
@@ -56,8 +54,7 @@ Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion(vector<Nasa9Poly1*>& regionPt
 
 Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion(const Nasa9PolyMultiTempRegion& b) :
     SpeciesThermoInterpType(b),
-    m_lowerTempBounds(b.m_lowerTempBounds),
-    m_currRegion(b.m_currRegion)
+    m_lowerTempBounds(b.m_lowerTempBounds)
 {
     m_regionPts.resize(b.m_regionPts.size());
     for (size_t i = 0; i < m_regionPts.size(); i++) {
@@ -71,7 +68,6 @@ Nasa9PolyMultiTempRegion::operator=(const Nasa9PolyMultiTempRegion& b)
     if (&b != this) {
         SpeciesThermoInterpType::operator=(b);
         m_lowerTempBounds = b.m_lowerTempBounds;
-        m_currRegion = b.m_currRegion;
         m_regionPts.resize(b.m_regionPts.size());
         for (size_t i = 0; i < m_regionPts.size(); i++) {
             m_regionPts[i].reset(new Nasa9Poly1(*b.m_regionPts[i]));
@@ -111,15 +107,15 @@ void Nasa9PolyMultiTempRegion::updateProperties(const doublereal* tt,
         doublereal* h_RT,
         doublereal* s_R) const
 {
-    m_currRegion = 0;
+    size_t iRegion = 0;
     for (size_t i = 1; i < m_regionPts.size(); i++) {
         if (tt[0] < m_lowerTempBounds[i]) {
             break;
         }
-        m_currRegion++;
+        iRegion++;
     }
 
-    m_regionPts[m_currRegion]->updateProperties(tt, cp_R, h_RT, s_R);
+    m_regionPts[iRegion]->updateProperties(tt, cp_R, h_RT, s_R);
 }
 
 void Nasa9PolyMultiTempRegion::updatePropertiesTemp(const doublereal temp,
@@ -127,15 +123,15 @@ void Nasa9PolyMultiTempRegion::updatePropertiesTemp(const doublereal temp,
         doublereal* s_R) const
 {
     // Now find the region
-    m_currRegion = 0;
+    size_t iRegion = 0;
     for (size_t i = 1; i < m_regionPts.size(); i++) {
         if (temp < m_lowerTempBounds[i]) {
             break;
         }
-        m_currRegion++;
+        iRegion++;
     }
 
-    m_regionPts[m_currRegion]->updatePropertiesTemp(temp, cp_R, h_RT, s_R);
+    m_regionPts[iRegion]->updatePropertiesTemp(temp, cp_R, h_RT, s_R);
 }
 
 void Nasa9PolyMultiTempRegion::reportParameters(size_t& n, int& type,
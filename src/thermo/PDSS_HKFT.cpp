@@ -879,6 +879,64 @@ doublereal PDSS_HKFT::gstar(const doublereal temp, const doublereal pres, const
     return res;
 }
 
+void PDSS_HKFT::getSolventFunctions(doublereal temp, doublereal pres,
+                                    HKFTSolventFunctions& sf) const
+{
+    // This is g() for all values of ifunc, sharing a single evaluation of
+    // the water standard state
+    m_waterSS->setState_TP(temp, pres);
+    m_densWaterSS = m_waterSS->density();
+    doublereal dens = m_densWaterSS * 1.0E-3;
+    doublereal gvals[4] = {0.0, 0.0, 0.0, 0.0};
+    if (dens < 1.0) {
+        doublereal afunc = ag(temp, 0);
+        doublereal bfunc = bg(temp, 0);
+        doublereal afuncdT = ag(temp, 1);
+        doublereal bfuncdT = bg(temp, 1);
+        doublereal afuncdT2 = ag(temp, 2);
+        doublereal bfuncdT2 = bg(temp, 2);
+        doublereal alpha = m_waterSS->thermalExpansionCoeff();
+        doublereal dalphadT = m_waterSS->dthermalExpansionCoeffdT();
+        doublereal beta = m_waterSS->isothermalCompressibility();
+        doublereal gval = afunc * pow((1.0-dens), bfunc);
+        doublereal lndens = log(1.0 - dens);
+        doublereal ddensdT = - alpha * dens;
+
+        doublereal fac1 = afuncdT * gval / afunc;
+        doublereal fac2 = bfuncdT * gval * lndens;
+        doublereal fac3 = gval * alpha * bfunc * dens / (1.0 - dens);
+        doublereal dgdt = fac1 + fac2 + fac3;
+
+        doublereal dfac1dT = dgdt * afuncdT / afunc + afuncdT2 * gval / afunc
+                             -  afuncdT * afuncdT * gval / (afunc * afunc);
+        doublereal dfac2dT = bfuncdT2 * gval * lndens
+                              + bfuncdT * dgdt * lndens
+                              - bfuncdT * gval /(1.0 - dens) * ddensdT;
+        doublereal dfac3dT = dgdt * alpha * bfunc * dens / (1.0 - dens)
+                             + gval * dalphadT * bfunc * dens / (1.0 - dens)
+                             + gval * alpha * bfuncdT * dens / (1.0 - dens)
+                             + gval * alpha * bfunc * ddensdT / (1.0 - dens)
+                             + gval * alpha * bfunc * dens / ((1.0 - dens) * (1.0 - dens)) * ddensdT;
+
+        gvals[0] = gval;
+        gvals[1] = dgdt;
+        gvals[2] = dfac1dT + dfac2dT + dfac3dT;
+        gvals[3] = - bfunc * gval * dens * beta / (1.0 - dens);
+    }
+    for (int ifunc = 0; ifunc < 4; ifunc++) {
+        sf.gstar[ifunc] = gvals[ifunc] - f(temp, pres, ifunc);
+    }
+
+    doublereal relepsilon = m_waterProps->relEpsilon(temp, pres, 0);
+    doublereal drelepsilondT = m_waterProps->relEpsilon(temp, pres, 1);
+    doublereal d2relepsilondT2 = m_waterProps->relEpsilon(temp, pres, 2);
+    doublereal drelepsilondP = m_waterProps->relEpsilon(temp, pres, 3);
+    sf.Z = -1.0 / relepsilon;
+    sf.Y = drelepsilondT / (relepsilon * relepsilon);
+    sf.X = d2relepsilondT2 / (relepsilon * relepsilon) - 2.0 * relepsilon * sf.Y * sf.Y;
+    sf.Q = drelepsilondP / (relepsilon * relepsilon);
+}
+
 doublereal PDSS_HKFT::LookupGe(const std::string& elemName)
 {
     size_t iE = m_tp->elementIndex(elemName);
@@ -67,8 +67,13 @@ Phase& Phase::operator=(const Phase& right)
     m_molwts = right.m_molwts;
     m_rmolwts = right.m_rmolwts;
     m_stateNum = -1;
+    m_cache.clear();
 
     m_speciesNames = right.m_speciesNames;
+    m_speciesIndices = right.m_speciesIndices;
+    // Species objects are not modified after they are added, so they are
+    // shared with 'right'
+    m_species = right.m_species;
     m_speciesComp = right.m_speciesComp;
     m_speciesCharge = right.m_speciesCharge;
     m_speciesSize = right.m_speciesSize;
@@ -679,7 +684,25 @@ doublereal Phase::mean_X(const vector_fp& Q) const
 
 doublereal Phase::sum_xlogx() const
 {
-    return m_mmw* Cantera::sum_xlogx(m_ym.begin(), m_ym.end()) + log(m_mmw);
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(m_stateNum)) {
+        cached.value = m_mmw* Cantera::sum_xlogx(m_ym.begin(), m_ym.end()) + log(m_mmw);
+    }
+    return cached.value;
+}
+
+const vector_fp& Phase::logMoleFractions() const
+{
+    static const int cacheId = m_cache.getId();
+    CachedArray cached = m_cache.getArray(cacheId);
+    if (!cached.validate(m_stateNum)) {
+        cached.value.resize(m_kk);
+        for (size_t k = 0; k < m_kk; k++) {
+            cached.value[k] = log(std::max(SmallNumber, m_ym[k] * m_mmw));
+        }
+    }
+    return cached.value;
 }
 
 size_t Phase::addElement(const std::string& symbol, doublereal weight,
@@ -805,6 +828,8 @@ bool Phase::addSpecies(shared_ptr<Species> spec) {
     m_molwts.push_back(wt);
     m_rmolwts.push_back(1.0/wt);
     m_kk++;
+    // The length of the composition vectors has changed
+    m_stateNum++;
 
     // Ensure that the Phase has a valid mass fraction vector that sums to
     // one. We will assume that species 0 has a mass fraction of 1.0 and mass
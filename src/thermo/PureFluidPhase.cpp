@@ -39,6 +39,9 @@ PureFluidPhase& PureFluidPhase::operator=(const PureFluidPhase& right)
         ThermoPhase::operator=(right);
         m_subflag = right.m_subflag;
         m_sub.reset(tpx::GetSub(m_subflag));
+        if (m_sub && right.m_sub && right.m_sub->usingTables()) {
+            m_sub->useTables();
+        }
         m_mw = right.m_mw;
         m_verbose = right.m_verbose;
     }
@@ -163,6 +166,16 @@ tpx::Substance& PureFluidPhase::TPX_Substance()
     return *m_sub;
 }
 
+void PureFluidPhase::useTables(bool flag)
+{
+    m_sub->useTables(flag);
+}
+
+bool PureFluidPhase::usingTables() const
+{
+    return m_sub->usingTables();
+}
+
 void PureFluidPhase::getPartialMolarEnthalpies(doublereal* hbar) const
 {
     hbar[0] = enthalpy_mole();
@@ -33,6 +33,7 @@ RedlichKwongMFTP::RedlichKwongMFTP() :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTempLast(-1.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -44,6 +45,7 @@ RedlichKwongMFTP::RedlichKwongMFTP(const std::string& infile, const std::string&
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTempLast(-1.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -56,6 +58,7 @@ RedlichKwongMFTP::RedlichKwongMFTP(XML_Node& phaseRefRoot, const std::string& id
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTempLast(-1.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -68,6 +71,7 @@ RedlichKwongMFTP::RedlichKwongMFTP(const RedlichKwongMFTP& b) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTempLast(-1.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -89,6 +93,7 @@ RedlichKwongMFTP& RedlichKwongMFTP::operator=(const RedlichKwongMFTP& b)
         m_a_current = b.m_a_current;
         a_vec_Curr_ = b.a_vec_Curr_;
         b_vec_Curr_ = b.b_vec_Curr_;
+        m_aTempLast = b.m_aTempLast;
         a_coeff_vec = b.a_coeff_vec;
 
         m_pc_Species = b.m_pc_Species;
@@ -417,8 +422,13 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
 
 void RedlichKwongMFTP::getPartialMolarIntEnergies(doublereal* ubar) const
 {
-    getIntEnergy_RT(ubar);
-    scale(ubar, ubar+m_kk, ubar, RT());
+    // u_k = h_k - P v_k, including the departure from the ideal gas
+    getPartialMolarEnthalpies(ubar);
+    getPartialMolarVolumes(m_partialMolarVolumes.data());
+    double P = pressure();
+    for (size_t k = 0; k < m_kk; k++) {
+        ubar[k] -= P * m_partialMolarVolumes[k];
+    }
 }
 
 void RedlichKwongMFTP::getPartialMolarCp(doublereal* cpbar) const
@@ -462,83 +472,29 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 
 doublereal RedlichKwongMFTP::critTemperature() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return tc;
+    return mixingParameters()[4];
 }
 
 doublereal RedlichKwongMFTP::critPressure() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return pc;
+    return mixingParameters()[3];
 }
 
 doublereal RedlichKwongMFTP::critVolume() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return vc;
+    return mixingParameters()[5];
 }
 
 doublereal RedlichKwongMFTP::critCompressibility() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return pc*vc/tc/GasConstant;
+    const vector_fp& mix = mixingParameters();
+    return mix[3] * mix[5] / mix[4] / GasConstant;
 }
 
 doublereal RedlichKwongMFTP::critDensity() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    double mmw = meanMolecularWeight();
-    return mmw / vc;
+    doublereal mmw = meanMolecularWeight();
+    return mmw / mixingParameters()[5];
 }
 
 void RedlichKwongMFTP::initThermo()
@@ -661,6 +617,11 @@ void RedlichKwongMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
         calcCriticalConditions(ai, bi, a0coeff, aTcoeff, m_pc_Species[i], m_tc_Species[i], m_vc_Species[i]);
     }
 
+    // The mixing parameters may have been evaluated with incomplete
+    // coefficients while the species were being added
+    m_aTempLast = -1.0;
+    m_cache.clear();
+
     MixtureFugacityTP::initThermoXML(phaseNode, id);
 }
 
@@ -939,6 +900,62 @@ doublereal RedlichKwongMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
     return mmw / molarVolLast;
 }
 
+void RedlichKwongMFTP::getDensities_TP(size_t nStates, const doublereal* TKelvin,
+                                       const doublereal* pressure, doublereal* rho,
+                                       int phaseRequested)
+{
+    const vector_fp& mix = mixingParameters();
+    doublereal tcrit = mix[4];
+    doublereal mmw = meanMolecularWeight();
+    doublereal Vroot[3];
+    for (size_t n = 0; n < nStates; n++) {
+        doublereal T = TKelvin[n];
+        doublereal P = pressure[n];
+        doublereal a = mix[0] + mix[1] * T;
+        int nSolns = NicholsSolve(T, P, a, mix[2], Vroot);
+
+        // Root selection and return values follow densityCalc()
+        doublereal molarVol;
+        if (nSolns >= 2) {
+            if (phaseRequested >= FLUID_LIQUID_0) {
+                molarVol = Vroot[0];
+            } else if (phaseRequested == FLUID_GAS ||
+                       phaseRequested == FLUID_SUPERCRIT) {
+                molarVol = Vroot[2];
+            } else {
+                // The ideal gas guess of MixtureFugacityTP::getDensities_TP
+                // is only made for FLUID_UNDEFINED or above the critical
+                // temperature; otherwise densityCalc() sees no guess.
+                doublereal volguess = -1.0;
+                if (phaseRequested == FLUID_UNDEFINED || T > tcrit) {
+                    volguess = GasConstant * T / P;
+                }
+                molarVol = (volguess > Vroot[1]) ? Vroot[2] : Vroot[0];
+            }
+        } else if (nSolns == 1) {
+            if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT
+                || phaseRequested == FLUID_UNDEFINED) {
+                molarVol = Vroot[0];
+            } else {
+                rho[n] = -2.0;
+                continue;
+            }
+        } else if (nSolns == -1) {
+            if (phaseRequested >= FLUID_LIQUID_0 || phaseRequested == FLUID_UNDEFINED
+                || phaseRequested == FLUID_SUPERCRIT || T > tcrit) {
+                molarVol = Vroot[0];
+            } else {
+                rho[n] = -2.0;
+                continue;
+            }
+        } else {
+            rho[n] = -1.0;
+            continue;
+        }
+        rho[n] = mmw / molarVol;
+    }
+}
+
 doublereal RedlichKwongMFTP::densSpinodalLiquid() const
 {
     if (NSolns_ != 3) {
@@ -1019,6 +1036,18 @@ void RedlichKwongMFTP::pressureDerivatives() const
     dpdT_ = (GasConstant / vmb - fac / (sqt * mv * vpb));
 }
 
+doublereal RedlichKwongMFTP::isothermalCompressibility() const
+{
+    pressureDerivatives();
+    return -1.0 / (molarVolume() * dpdV_);
+}
+
+doublereal RedlichKwongMFTP::thermalExpansionCoeff() const
+{
+    pressureDerivatives();
+    return -dpdT_ / (molarVolume() * dpdV_);
+}
+
 void RedlichKwongMFTP::updateMixingExpressions()
 {
     updateAB();
@@ -1027,62 +1056,62 @@ void RedlichKwongMFTP::updateMixingExpressions()
 void RedlichKwongMFTP::updateAB()
 {
     double temp = temperature();
-    if (m_formTempParam == 1) {
+    if (temp != m_aTempLast) {
         for (size_t i = 0; i < m_kk; i++) {
             for (size_t j = 0; j < m_kk; j++) {
                 size_t counter = i * m_kk + j;
                 a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
             }
         }
+        m_aTempLast = temp;
     }
 
-    m_b_current = 0.0;
-    m_a_current = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            m_a_current += a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
-        }
-    }
+    const vector_fp& mix = mixingParameters();
+    m_a_current = mix[0] + mix[1] * temp;
+    m_b_current = mix[2];
 }
 
 void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
 {
-    bCalc = 0.0;
-    aCalc = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
-                aCalc += a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    } else {
+    const vector_fp& mix = mixingParameters();
+    aCalc = mix[0] + mix[1] * temp;
+    bCalc = mix[2];
+}
+
+const vector_fp& RedlichKwongMFTP::mixingParameters() const
+{
+    static const int cacheId = m_cache.getId();
+    CachedArray cached = m_cache.getArray(cacheId);
+    if (cached.stateNum != stateMFNumber()) {
+        cached.value.resize(6);
+        doublereal a0 = 0.0;
+        doublereal aT = 0.0;
+        doublereal b = 0.0;
         for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
+            b += moleFractions_[i] * b_vec_Curr_[i];
+            doublereal a0_i = 0.0;
+            doublereal aT_i = 0.0;
             for (size_t j = 0; j < m_kk; j++) {
                 size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter);
-                aCalc += a_vec_Curr * moleFractions_[i] * moleFractions_[j];
+                a0_i += a_coeff_vec(0,counter) * moleFractions_[j];
+                aT_i += a_coeff_vec(1,counter) * moleFractions_[j];
             }
+            a0 += moleFractions_[i] * a0_i;
+            aT += moleFractions_[i] * aT_i;
         }
-    }
+        cached.value[0] = a0;
+        cached.value[1] = aT;
+        cached.value[2] = b;
+        calcCriticalConditions(a0, b, a0, aT, cached.value[3], cached.value[4],
+                               cached.value[5]);
+        cached.stateNum = stateMFNumber();
+    }
+    return cached.value;
 }
 
 doublereal RedlichKwongMFTP::da_dt() const
 {
-    doublereal dadT = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+= a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    }
-    return dadT;
+    return mixingParameters()[1];
 }
 
 void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
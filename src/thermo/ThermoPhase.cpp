@@ -36,9 +36,6 @@ ThermoPhase::ThermoPhase() :
 
 ThermoPhase::~ThermoPhase()
 {
-    for (size_t k = 0; k < m_speciesData.size(); k++) {
-        delete m_speciesData[k];
-    }
     delete m_spthermo;
 }
 
@@ -62,9 +59,6 @@ ThermoPhase& ThermoPhase::operator=(const ThermoPhase& right)
     }
 
     // We need to destruct first
-    for (size_t k = 0; k < m_speciesData.size(); k++) {
-        delete m_speciesData[k];
-    }
     delete m_spthermo;
 
     // Call the base class assignment operator
@@ -74,10 +68,16 @@ ThermoPhase& ThermoPhase::operator=(const ThermoPhase& right)
     // We own this, so we need to do a deep copy
     m_spthermo = (right.m_spthermo)->duplMyselfAsSpeciesThermo();
 
-    // Do a deep copy of species Data, because we own this
-    m_speciesData.resize(m_kk);
-    for (size_t k = 0; k < m_kk; k++) {
-        m_speciesData[k] = new XML_Node(*(right.m_speciesData[k]));
+    // The species data is never modified, so it is shared with 'right'
+    m_speciesData = right.m_speciesData;
+    m_speciesDataStore = right.m_speciesDataStore;
+
+    // Species objects which were modified by 'right' stay private to each
+    // phase (see modifySpeciesHf298)
+    m_privateSpecies = right.m_privateSpecies;
+    for (size_t k : m_privateSpecies) {
+        auto& spec = m_species[speciesName(k)];
+        spec = make_shared<Species>(*spec);
     }
 
     m_phi = right.m_phi;
@@ -706,12 +706,31 @@ bool ThermoPhase::addSpecies(shared_ptr<Species> spec)
     return added;
 }
 
+void ThermoPhase::modifySpeciesHf298(size_t k, doublereal Hf298New)
+{
+    checkSpeciesIndex(k);
+    auto iter = m_species.find(speciesName(k));
+    if (iter == m_species.end() || !iter->second->thermo) {
+        return;
+    }
+    // The Species object is copied the first time it is modified, and the
+    // copy (which also has its own thermo parameterization) is modified in
+    // place after that
+    if (!m_privateSpecies.count(k)) {
+        iter->second = make_shared<Species>(*iter->second);
+        m_privateSpecies.insert(k);
+    }
+    iter->second->thermo->modifyOneHf298(k, Hf298New);
+}
+
 void ThermoPhase::saveSpeciesData(const size_t k, const XML_Node* const data)
 {
     if (m_speciesData.size() < (k + 1)) {
         m_speciesData.resize(k+1, 0);
+        m_speciesDataStore.resize(k+1);
     }
-    m_speciesData[k] = new XML_Node(*data);
+    m_speciesDataStore[k] = make_shared<XML_Node>(*data);
+    m_speciesData[k] = m_speciesDataStore[k].get();
 }
 
 const std::vector<const XML_Node*> & ThermoPhase::speciesData() const
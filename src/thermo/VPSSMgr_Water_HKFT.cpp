@@ -31,6 +31,9 @@ VPSSMgr_Water_HKFT::VPSSMgr_Water_HKFT(VPStandardStateTP* vp_ptr,
                                        SpeciesThermo* spth) :
     VPSSMgr(vp_ptr, spth),
     m_waterSS(0),
+    m_hkftSS(0),
+    m_Y_pr_tr(0.0),
+    m_Z_pr_tr(0.0),
     m_tlastRef(-1.0)
 {
     m_useTmpRefStateStorage = true;
@@ -40,6 +43,9 @@ VPSSMgr_Water_HKFT::VPSSMgr_Water_HKFT(VPStandardStateTP* vp_ptr,
 VPSSMgr_Water_HKFT::VPSSMgr_Water_HKFT(const VPSSMgr_Water_HKFT& right) :
     VPSSMgr(right.m_vptp_ptr, right.m_spthermo),
     m_waterSS(0),
+    m_hkftSS(0),
+    m_Y_pr_tr(0.0),
+    m_Z_pr_tr(0.0),
     m_tlastRef(-1.0)
 {
     m_useTmpRefStateStorage = true;
@@ -54,6 +60,24 @@ VPSSMgr_Water_HKFT& VPSSMgr_Water_HKFT::operator=(const VPSSMgr_Water_HKFT& b)
     }
     VPSSMgr::operator=(b);
     m_waterSS = dynamic_cast<PDSS_Water*>(m_vptp_ptr->providePDSS(0));
+    m_hkftSS = 0;
+    if (m_kk > 1) {
+        m_hkftSS = dynamic_cast<PDSS_HKFT*>(m_vptp_ptr->providePDSS(1));
+    }
+    m_Mu0_tr_pr = b.m_Mu0_tr_pr;
+    m_Entrop_tr_pr = b.m_Entrop_tr_pr;
+    m_a1 = b.m_a1;
+    m_a2 = b.m_a2;
+    m_a3 = b.m_a3;
+    m_a4 = b.m_a4;
+    m_c1 = b.m_c1;
+    m_c2 = b.m_c2;
+    m_omega_pr_tr = b.m_omega_pr_tr;
+    m_charge_j = b.m_charge_j;
+    m_r_e_j_pr_tr = b.m_r_e_j_pr_tr;
+    m_domega_jdT_prtr = b.m_domega_jdT_prtr;
+    m_Y_pr_tr = b.m_Y_pr_tr;
+    m_Z_pr_tr = b.m_Z_pr_tr;
     m_tlastRef = -1.0;
     return *this;
 }
@@ -146,22 +170,16 @@ void VPSSMgr_Water_HKFT::_updateRefStateThermo() const
     m_cp0_R[0] = (m_waterSS->cp_mole()) / GasConstant;
     m_g0_RT[0] = (m_hss_RT[0] - m_sss_R[0]);
     m_V0[0] = (m_waterSS->density()) / m_vptp_ptr->molecularWeight(0);
-    PDSS* ps;
-    for (size_t k = 1; k < m_kk; k++) {
-        ps = m_vptp_ptr->providePDSS(k);
-        ps->setState_TP(m_tlast, m_p0);
-        m_cp0_R[k] = ps->cp_R();
-        m_s0_R[k] = ps->entropy_mole() / GasConstant;
-        m_g0_RT[k] = ps->gibbs_RT();
-        m_h0_RT[k] = m_g0_RT[k] + m_s0_R[k];
-        m_V0[k] = ps->molarVolume();
-
+    if (m_kk > 1) {
+        HKFTSolventFunctions sf;
+        if (m_charge_j.size() != m_kk) {
+            initHKFTParams();
+        }
+        m_hkftSS->getSolventFunctions(m_tlast, m_p0, sf);
+        evalHKFT(m_tlast, m_p0, sf, &m_g0_RT[0], &m_h0_RT[0], &m_s0_R[0],
+                 &m_cp0_R[0], &m_V0[0]);
     }
     m_waterSS->setState_TP(m_tlast, m_plast);
-    for (size_t k = 1; k < m_kk; k++) {
-        ps = m_vptp_ptr->providePDSS(k);
-        ps->setState_TP(m_tlast, m_plast);
-    }
 }
 
 void VPSSMgr_Water_HKFT::_updateStandardStateThermo()
@@ -174,14 +192,160 @@ void VPSSMgr_Water_HKFT::_updateStandardStateThermo()
     m_gss_RT[0] = (m_hss_RT[0] - m_sss_R[0]);
     m_Vss[0] = (m_vptp_ptr->molecularWeight(0)) / (m_waterSS->density());
 
+    if (m_kk > 1) {
+        // Water properties and Born functions shared by all HKFT species
+        HKFTSolventFunctions sf;
+        if (m_charge_j.size() != m_kk) {
+            initHKFTParams();
+        }
+        m_hkftSS->getSolventFunctions(m_tlast, m_plast, sf);
+        evalHKFT(m_tlast, m_plast, sf, &m_gss_RT[0], &m_hss_RT[0],
+                 &m_sss_R[0], &m_cpss_R[0], &m_Vss[0]);
+    }
+
+    // Keep the individual standard state objects in sync, so that they
+    // can be queried directly
     for (size_t k = 1; k < m_kk; k++) {
-        PDSS* ps = m_vptp_ptr->providePDSS(k);
-        ps->setState_TP(m_tlast, m_plast);
-        m_cpss_R[k] = ps->cp_R();
-        m_sss_R[k] = ps->entropy_R();
-        m_gss_RT[k] = ps->gibbs_RT();
-        m_hss_RT[k] = m_gss_RT[k] + m_sss_R[k];
-        m_Vss[k] = ps->molarVolume();
+        m_vptp_ptr->providePDSS(k)->setState_TP(m_tlast, m_plast);
+    }
+}
+
+void VPSSMgr_Water_HKFT::initHKFTParams() const
+{
+    m_hkftSS = dynamic_cast<PDSS_HKFT*>(m_vptp_ptr->providePDSS(1));
+    if (!m_hkftSS) {
+        throw CanteraError("VPSSMgr_Water_HKFT::initHKFTParams",
+                           "bad dynamic cast");
+    }
+    m_Mu0_tr_pr.assign(m_kk, 0.0);
+    m_Entrop_tr_pr.assign(m_kk, 0.0);
+    m_a1.assign(m_kk, 0.0);
+    m_a2.assign(m_kk, 0.0);
+    m_a3.assign(m_kk, 0.0);
+    m_a4.assign(m_kk, 0.0);
+    m_c1.assign(m_kk, 0.0);
+    m_c2.assign(m_kk, 0.0);
+    m_omega_pr_tr.assign(m_kk, 0.0);
+    m_charge_j.assign(m_kk, 0.0);
+    m_r_e_j_pr_tr.assign(m_kk, 0.0);
+    m_domega_jdT_prtr.assign(m_kk, 0.0);
+
+    // Solvent functions at Tr and Pr, as used in PDSS_HKFT::initThermo()
+    HKFTSolventFunctions sfr;
+    m_hkftSS->getSolventFunctions(273.15 + 25., OneAtm, sfr);
+    m_Y_pr_tr = sfr.Y;
+    m_Z_pr_tr = sfr.Z;
+
+    doublereal nu = 166027;
+    doublereal c[11];
+    for (size_t k = 1; k < m_kk; k++) {
+        const PDSS* ps = m_vptp_ptr->providePDSS(k);
+        size_t kindex;
+        int type;
+        doublereal minTemp, maxTemp, refPressure;
+        ps->reportParams(kindex, type, c, minTemp, maxTemp, refPressure);
+        m_Mu0_tr_pr[k] = c[2];
+        m_Entrop_tr_pr[k] = c[3];
+        m_a1[k] = c[4];
+        m_a2[k] = c[5];
+        m_a3[k] = c[6];
+        m_a4[k] = c[7];
+        m_c1[k] = c[8];
+        m_c2[k] = c[9];
+        m_omega_pr_tr[k] = c[10];
+        doublereal z = m_vptp_ptr->charge(k);
+        m_charge_j[k] = z;
+        if (z != 0.0) {
+            m_r_e_j_pr_tr[k] = z * z / (m_omega_pr_tr[k]/nu + z/3.082);
+            doublereal gval = sfr.gstar[0];
+            doublereal dgvaldT = sfr.gstar[1];
+            doublereal r_e_j = m_r_e_j_pr_tr[k] + fabs(z) * gval;
+            doublereal dr_e_jdT = fabs(z) * dgvaldT;
+            m_domega_jdT_prtr[k] = - nu * (z * z / (r_e_j * r_e_j) * dr_e_jdT)
+                                   + nu * z / (3.082 + gval) / (3.082 + gval) * dgvaldT;
+        }
+    }
+}
+
+void VPSSMgr_Water_HKFT::evalHKFT(doublereal T, doublereal P,
+                                  const HKFTSolventFunctions& sf,
+                                  doublereal* g_RT, doublereal* h_RT,
+                                  doublereal* s_R, doublereal* cp_R,
+                                  doublereal* V) const
+{
+    // These are the formulas of PDSS_HKFT::deltaG(), deltaS(), cp_mole() and
+    // molarVolume(), with all of the terms that don't depend on the species
+    // parameters evaluated once. Intermediate values are in cal gmol-1.
+    const doublereal nu = 166027;
+    const doublereal presR_bar = 1.0;
+    const doublereal calToJ = 1.0E3 * 4.184;
+    doublereal pbar = P * 1.0E-5;
+    doublereal dp = pbar - presR_bar;
+    doublereal lnp = log((2600. + pbar)/(2600. + presR_bar));
+    doublereal tm228 = T - 228.;
+    doublereal lnT = log(T/298.15);
+    doublereal lnTr = log((298.15*tm228) / (T*(298.15-228.)));
+    doublereal dinv = 1.0/tm228 - 1.0/(298.15 - 228.);
+    doublereal c1G = -(T * lnT - (T - 298.15));
+    doublereal c2G = -(dinv * (228. - T)/228. - T / (228.*228.) * lnTr);
+    doublereal c2S = -1.0 / 228. * (dinv + 1.0 / 228. * lnTr);
+    doublereal Zp1 = sf.Z + 1.0;
+    doublereal Zrp1 = m_Z_pr_tr + 1.0;
+    doublereal g0 = sf.gstar[0];
+    doublereal g1 = sf.gstar[1];
+    doublereal g2 = sf.gstar[2];
+    doublereal g3 = sf.gstar[3];
+    doublereal r_e_H = 3.082 + g0;
+    doublereal r_e_H2 = r_e_H * r_e_H;
+    doublereal RT = GasConstant * T;
+
+    for (size_t k = 1; k < m_kk; k++) {
+        doublereal z = m_charge_j[k];
+        doublereal omega_j = m_omega_pr_tr[k];
+        doublereal domega_jdT = 0.0;
+        doublereal d2omega_jdT2 = 0.0;
+        doublereal domega_jdP = 0.0;
+        if (z != 0.0) {
+            doublereal charge2 = z * z;
+            doublereal r_e_j = m_r_e_j_pr_tr[k] + fabs(z) * g0;
+            doublereal r_e_j2 = r_e_j * r_e_j;
+            doublereal dr_e_jdT = fabs(z) * g1;
+            doublereal d2r_e_jdT2 = fabs(z) * g2;
+            doublereal dr_e_jdP = fabs(z) * g3;
+            omega_j = nu * (charge2 / r_e_j - z / r_e_H);
+            domega_jdT = nu * (-(charge2 / r_e_j2 * dr_e_jdT) + z / r_e_H2 * g1);
+            d2omega_jdT2 = nu * (2.0*charge2*dr_e_jdT*dr_e_jdT/(r_e_j2*r_e_j) - charge2*d2r_e_jdT2/r_e_j2
+                                 -2.0*z*g1*g1/(r_e_H2*r_e_H) + z*g2/r_e_H2);
+            domega_jdP = - nu * (charge2 / r_e_j2 * dr_e_jdP) + nu * z / r_e_H2 * g3;
+        }
+        doublereal omega_r = m_omega_pr_tr[k];
+        doublereal domega_r = m_domega_jdT_prtr[k];
+
+        doublereal dG = - m_Entrop_tr_pr[k] * (T - 298.15) + m_c1[k] * c1G
+                        + m_a1[k] * dp + m_a2[k] * lnp + m_c2[k] * c2G
+                        + m_a3[k] / tm228 * dp + m_a4[k] / tm228 * lnp
+                        - omega_j * Zp1 + omega_r * Zrp1
+                        + omega_r * m_Y_pr_tr * (T - 298.15);
+
+        doublereal dS = m_c1[k] * lnT + m_c2[k] * c2S
+                        + (m_a3[k] * dp + m_a4[k] * lnp) / (tm228 * tm228)
+                        + omega_j * sf.Y - omega_r * m_Y_pr_tr
+                        + domega_jdT * Zp1 - domega_r * Zrp1;
+
+        doublereal Cp = m_c1[k] + m_c2[k] / (tm228 * tm228)
+                        - (m_a3[k] * dp + m_a4[k] * lnp) * 2.0 * T / (tm228 * tm228 * tm228)
+                        + 2.0 * T * sf.Y * domega_jdT + omega_j * T * sf.X
+                        + T * d2omega_jdT2 * Zp1 - domega_r * Zrp1;
+
+        doublereal vol = m_a1[k] * 1.0E-5 + m_a2[k] / (2600.E5 + P)
+                         + m_a3[k] * 1.0E-5 / tm228 + m_a4[k] / tm228 / (2600.E5 + P)
+                         - domega_jdP * Zp1 - omega_j * sf.Q;
+
+        g_RT[k] = (m_Mu0_tr_pr[k] + dG * calToJ) / RT;
+        s_R[k] = (m_Entrop_tr_pr[k] + dS) * calToJ / GasConstant;
+        h_RT[k] = g_RT[k] + s_R[k];
+        cp_R[k] = Cp * calToJ / GasConstant;
+        V[k] = vol * calToJ;
     }
 }
 
@@ -214,6 +378,9 @@ void VPSSMgr_Water_HKFT::initThermoXML(XML_Node& phaseNode,
                                "the HKFT standard state model: " + name);
         }
     }
+    if (m_kk > 1) {
+        initHKFTParams();
+    }
 }
 
 PDSS* VPSSMgr_Water_HKFT::createInstallPDSS(size_t k,
@@ -276,6 +443,10 @@ void VPSSMgr_Water_HKFT::initAllPtrs(VPStandardStateTP* vp_ptr,
         throw CanteraError("VPSSMgr_Water_ConstVol::initAllPtrs",
                            "bad dynamic cast");
     }
+    m_hkftSS = 0;
+    if (m_kk > 1) {
+        m_hkftSS = dynamic_cast<PDSS_HKFT*>(m_vptp_ptr->providePDSS(1));
+    }
 }
 
 PDSS_enumType VPSSMgr_Water_HKFT::reportPDSSType(int k) const
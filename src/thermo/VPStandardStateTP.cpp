@@ -132,7 +132,9 @@ void VPStandardStateTP::getEnthalpy_RT(doublereal* hrt) const
 void VPStandardStateTP::modifyOneHf298SS(const size_t k, const doublereal Hf298New)
 {
     m_spthermo->modifyOneHf298(k, Hf298New);
+    modifySpeciesHf298(k, Hf298New);
     m_Tlast_ss += 0.0001234;
+    invalidateCache();
 }
 
 void VPStandardStateTP::getEntropy_R(doublereal* srt) const
@@ -39,14 +39,16 @@ static const doublereal Rgas = 8.314371E3; // Joules kmol-1 K-1
 WaterPropsIAPWS::WaterPropsIAPWS() :
     tau(-1.0),
     delta(-1.0),
-    iState(-30000)
+    iState(-30000),
+    m_table(0)
 {
 }
 
 WaterPropsIAPWS::WaterPropsIAPWS(const WaterPropsIAPWS& b) :
     tau(b.tau),
     delta(b.delta),
-    iState(b.iState)
+    iState(b.iState),
+    m_table(b.m_table)
 {
     m_phi.tdpolycalc(tau, delta);
 }
@@ -59,10 +61,16 @@ WaterPropsIAPWS& WaterPropsIAPWS::operator=(const WaterPropsIAPWS& b)
     tau = b.tau;
     delta = b.delta;
     iState = b.iState;
+    m_table = b.m_table;
     m_phi.tdpolycalc(tau, delta);
     return *this;
 }
 
+void WaterPropsIAPWS::useTables(bool flag)
+{
+    m_table = flag ? &WaterPropsIAPWSTable::defaultTable() : 0;
+}
+
 void WaterPropsIAPWS::calcDim(doublereal temperature, doublereal rho)
 {
     tau = T_c / temperature;
@@ -99,6 +107,20 @@ doublereal WaterPropsIAPWS::pressure() const
 doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
                                     int phase, doublereal rhoguess)
 {
+    doublereal rhoTable;
+    if (m_table && m_table->density(temperature, pressure, phase, rhoguess, rhoTable)) {
+        doublereal p_red = pressure * M_water / (Rgas * temperature * Rho_c);
+        doublereal delta_retn = m_phi.dfindNewton(p_red, T_c / temperature,
+                                                  rhoTable / Rho_c);
+        if (delta_retn > 0.0) {
+            doublereal density_retn = delta_retn * Rho_c;
+            setState_TR(temperature, density_retn);
+            return density_retn;
+        }
+        // Fall back to the exact solver, starting from the tabulated value
+        rhoguess = rhoTable;
+    }
+
     doublereal deltaGuess = 0.0;
     if (rhoguess == -1.0) {
         if (phase != -1) {
@@ -336,6 +358,37 @@ doublereal WaterPropsIAPWS::psat(doublereal temperature, int waterState)
         setState_TR(temperature, densGas);
         return P_c;
     }
+    doublereal pTable;
+    if (m_table && (waterState == WATER_LIQUID || waterState == WATER_GAS) &&
+            m_table->saturation(temperature, pTable, densLiq, densGas)) {
+        // Polish the interpolated saturation pressure with one Newton step
+        // on the exact condition of equal Gibbs functions, as in the
+        // iteration below, using the tabulated densities as starting points
+        doublereal tauSat = T_c / temperature;
+        doublereal p_red = pTable * M_water / (Rgas * temperature * Rho_c);
+        doublereal delL = m_phi.dfindNewton(p_red, tauSat, densLiq / Rho_c);
+        doublereal delG = m_phi.dfindNewton(p_red, tauSat, densGas / Rho_c);
+        if (delL > 0.0 && delG > 0.0 && delL != delG) {
+            m_phi.tdpolycalc(tauSat, delL);
+            delGRT = m_phi.gibbs_RT();
+            m_phi.tdpolycalc(tauSat, delG);
+            delGRT -= m_phi.gibbs_RT();
+            doublereal delV = M_water / Rho_c * (1.0/delL - 1.0/delG);
+            doublereal p = pTable - delGRT * Rgas * temperature / delV;
+
+            // Densities of the requested phase at the corrected pressure
+            p_red = p * M_water / (Rgas * temperature * Rho_c);
+            doublereal delta_retn = m_phi.dfindNewton(
+                p_red, tauSat, (waterState == WATER_LIQUID) ? delL : delG);
+            if (delta_retn > 0.0) {
+                setState_TR(temperature, delta_retn * Rho_c);
+                return p;
+            }
+        }
+        densLiq = -1.0;
+        densGas = -1.0;
+        delGRT = 0.0;
+    }
     doublereal p = psat_est(temperature);
     for (int i = 0; i < 30; i++) {
         if (method == 1) {
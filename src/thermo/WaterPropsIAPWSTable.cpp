@@ -0,0 +1,350 @@
+/**
+ * @file WaterPropsIAPWSTable.cpp
+ * Definitions for a tabulated representation of the IAPWS 1995 formulation
+ * for water (see class \link Cantera::WaterPropsIAPWSTable
+ * WaterPropsIAPWSTable\endlink).
+ */
+#include "cantera/thermo/WaterPropsIAPWSTable.h"
+#include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+namespace {
+
+//! Critical temperature of water (K)
+const doublereal Tcrit_w = 647.096;
+
+//! Critical density of water (kg m-3)
+const doublereal Rhocrit_w = 322.;
+
+//! Solve for the second derivatives of a natural cubic spline through
+//! uniformly spaced values y[0], y[stride], ..., y[(n-1)*stride]
+void naturalSpline(const doublereal* y, size_t n, size_t stride, doublereal h,
+                   doublereal* M)
+{
+    // Tridiagonal system with diagonal 4, off-diagonals 1, solved with the
+    // Thomas algorithm
+    vector_fp c(n, 0.0), d(n, 0.0);
+    M[0] = 0.0;
+    M[(n-1)*stride] = 0.0;
+    for (size_t i = 1; i < n - 1; i++) {
+        doublereal rhs = 6.0 / (h * h) *
+            (y[(i+1)*stride] - 2.0 * y[i*stride] + y[(i-1)*stride]);
+        doublereal denom = 4.0 - c[i-1];
+        c[i] = 1.0 / denom;
+        d[i] = (rhs - d[i-1]) / denom;
+    }
+    for (size_t i = n - 2; i > 0; i--) {
+        M[i*stride] = d[i] - c[i] * M[(i+1)*stride];
+    }
+}
+
+//! Cubic Hermite basis functions
+inline void hermite(doublereal t, doublereal H[4])
+{
+    doublereal t2 = t * t;
+    doublereal t3 = t2 * t;
+    H[0] = 2.0 * t3 - 3.0 * t2 + 1.0;
+    H[1] = t3 - 2.0 * t2 + t;
+    H[2] = -2.0 * t3 + 3.0 * t2;
+    H[3] = t3 - t2;
+}
+
+}
+
+WaterPropsIAPWSTable::WaterPropsIAPWSTable(doublereal rtol) :
+    m_rtol(rtol),
+    m_Tmin(273.16),
+    m_dT(5.0),
+    m_nT(201),
+    m_lnPmin(std::log(100.0)),
+    m_dlnP(std::log(10.0) / 10.0),
+    m_nP(61),
+    m_dTsat(1.0),
+    m_nSat(374),
+    m_maxDensErr(0.0),
+    m_maxSatErr(0.0)
+{
+    buildSaturationTable();
+    buildDensityTable();
+}
+
+const WaterPropsIAPWSTable& WaterPropsIAPWSTable::defaultTable()
+{
+    // Initialization of a function-local static is thread safe
+    static const WaterPropsIAPWSTable table;
+    return table;
+}
+
+void WaterPropsIAPWSTable::buildSaturationTable()
+{
+    WaterPropsIAPWS w;
+    m_satVals.assign(3 * m_nSat, 0.0);
+    m_satCurv.assign(3 * m_nSat, 0.0);
+    m_satErr.assign(m_nSat - 1, -1.0);
+    vector_int ok(m_nSat, 0);
+    for (size_t i = 0; i < m_nSat; i++) {
+        doublereal T = m_Tmin + i * m_dTsat;
+        try {
+            doublereal p = w.psat(T, WATER_LIQUID);
+            doublereal rhoLiq = w.density();
+            doublereal rhoGas = w.density(T, p, WATER_GAS);
+            if (rhoGas > 0.0) {
+                m_satVals[3*i] = std::log(p);
+                m_satVals[3*i+1] = std::log(rhoLiq);
+                m_satVals[3*i+2] = std::log(rhoGas);
+                ok[i] = 1;
+            }
+        } catch (CanteraError&) {
+        }
+    }
+
+    // All nodes must be valid for the splines to be meaningful. Truncate the
+    // table at the first failure.
+    size_t nValid = 0;
+    while (nValid < m_nSat && ok[nValid]) {
+        nValid++;
+    }
+    if (nValid < 3) {
+        throw CanteraError("WaterPropsIAPWSTable::buildSaturationTable",
+                           "Saturation properties could not be evaluated");
+    }
+    m_nSat = nValid;
+    m_satVals.resize(3 * m_nSat);
+    m_satCurv.resize(3 * m_nSat);
+    m_satErr.resize(m_nSat - 1);
+    for (size_t k = 0; k < 3; k++) {
+        naturalSpline(&m_satVals[k], m_nSat, 3, m_dTsat, &m_satCurv[k]);
+    }
+
+    // Accuracy bound of each interval from the error at its midpoint
+    for (size_t i = 0; i < m_nSat - 1; i++) {
+        doublereal T = m_Tmin + (i + 0.5) * m_dTsat;
+        try {
+            doublereal exact[3];
+            exact[0] = w.psat(T, WATER_LIQUID);
+            exact[1] = w.density();
+            exact[2] = w.density(T, exact[0], WATER_GAS);
+            doublereal vals[3];
+            interpSat(i, 0.5, vals);
+            doublereal err = 0.0;
+            for (size_t k = 0; k < 3; k++) {
+                err = std::max(err, fabs(std::exp(vals[k]) - exact[k]) / exact[k]);
+            }
+            if (exact[2] > 0.0 && err <= m_rtol) {
+                m_satErr[i] = err;
+                m_maxSatErr = std::max(m_maxSatErr, err);
+            }
+        } catch (CanteraError&) {
+        }
+    }
+}
+
+void WaterPropsIAPWSTable::buildDensityTable()
+{
+    WaterPropsIAPWS w;
+    size_t nNodes = m_nT * m_nP;
+    m_lnRho.assign(nNodes, 0.0);
+    m_dlnRho_dT.assign(nNodes, 0.0);
+    m_dlnRho_dlnP.assign(nNodes, 0.0);
+    m_d2lnRho.assign(nNodes, 0.0);
+    m_nodePhase.assign(nNodes, -1);
+    m_cellErr.assign((m_nT - 1) * (m_nP - 1), -1.0);
+
+    for (size_t i = 0; i < m_nT; i++) {
+        doublereal T = m_Tmin + i * m_dT;
+        doublereal psat = 0.0;
+        if (T < Tcrit_w) {
+            doublereal rhoLiq, rhoGas;
+            if (!saturation(T, psat, rhoLiq, rhoGas)) {
+                try {
+                    psat = w.psat(T);
+                } catch (CanteraError&) {
+                    continue;
+                }
+            }
+        }
+        doublereal rhoLast = -1.0;
+        int phaseLast = -1;
+        for (size_t j = 0; j < m_nP; j++) {
+            doublereal P = std::exp(m_lnPmin + j * m_dlnP);
+            int phase = WATER_SUPERCRIT;
+            if (T < Tcrit_w) {
+                phase = (P > psat) ? WATER_LIQUID : WATER_GAS;
+            }
+            // Start from the previous node along the isotherm if it is on the
+            // same branch
+            doublereal rhoguess = (phase == phaseLast) ? rhoLast : -1.0;
+            doublereal rho;
+            try {
+                rho = w.density(T, P, phase, rhoguess);
+            } catch (CanteraError&) {
+                rho = -1.0;
+            }
+            if (rho <= 0.0) {
+                phaseLast = -1;
+                continue;
+            }
+            size_t k = node(i, j);
+            m_lnRho[k] = std::log(rho);
+            m_dlnRho_dT[k] = - w.coeffThermExp();
+            m_dlnRho_dlnP[k] = P * w.isothermalCompressibility();
+            if (T < Tcrit_w) {
+                m_nodePhase[k] = (phase == WATER_LIQUID) ? 1 : 0;
+            } else {
+                m_nodePhase[k] = (rho > Rhocrit_w) ? 1 : 0;
+            }
+            rhoLast = rho;
+            phaseLast = phase;
+        }
+    }
+
+    // Mixed derivative from differences of d ln(rho) / d ln(P) along T
+    for (size_t i = 0; i < m_nT; i++) {
+        for (size_t j = 0; j < m_nP; j++) {
+            size_t k = node(i, j);
+            if (m_nodePhase[k] < 0) {
+                continue;
+            }
+            bool lo = (i > 0 && m_nodePhase[node(i-1, j)] == m_nodePhase[k]);
+            bool hi = (i < m_nT - 1 && m_nodePhase[node(i+1, j)] == m_nodePhase[k]);
+            if (lo && hi) {
+                m_d2lnRho[k] = (m_dlnRho_dlnP[node(i+1, j)] -
+                                m_dlnRho_dlnP[node(i-1, j)]) / (2.0 * m_dT);
+            } else if (hi) {
+                m_d2lnRho[k] = (m_dlnRho_dlnP[node(i+1, j)] - m_dlnRho_dlnP[k]) / m_dT;
+            } else if (lo) {
+                m_d2lnRho[k] = (m_dlnRho_dlnP[k] - m_dlnRho_dlnP[node(i-1, j)]) / m_dT;
+            }
+        }
+    }
+
+    // Accuracy bound of each cell from the error at its center
+    for (size_t i = 0; i < m_nT - 1; i++) {
+        for (size_t j = 0; j < m_nP - 1; j++) {
+            int ph = m_nodePhase[node(i, j)];
+            if (ph < 0 || m_nodePhase[node(i+1, j)] != ph ||
+                    m_nodePhase[node(i, j+1)] != ph ||
+                    m_nodePhase[node(i+1, j+1)] != ph) {
+                continue;
+            }
+            doublereal T = m_Tmin + (i + 0.5) * m_dT;
+            doublereal P = std::exp(m_lnPmin + (j + 0.5) * m_dlnP);
+            doublereal rhoInterp = std::exp(interpLnRho(i, j, 0.5, 0.5));
+            int phase = WATER_SUPERCRIT;
+            if (T < Tcrit_w) {
+                phase = (ph == 1) ? WATER_LIQUID : WATER_GAS;
+            }
+            doublereal rho;
+            try {
+                rho = w.density(T, P, phase, rhoInterp);
+            } catch (CanteraError&) {
+                continue;
+            }
+            if (rho <= 0.0) {
+                continue;
+            }
+            doublereal err = fabs(rhoInterp - rho) / rho;
+            if (err <= m_rtol) {
+                m_cellErr[i * (m_nP - 1) + j] = err;
+                m_maxDensErr = std::max(m_maxDensErr, err);
+            }
+        }
+    }
+}
+
+doublereal WaterPropsIAPWSTable::interpLnRho(size_t i, size_t j, doublereal u,
+                                             doublereal v) const
+{
+    doublereal Hu[4], Hv[4];
+    hermite(u, Hu);
+    hermite(v, Hv);
+    doublereal val = 0.0;
+    for (size_t a = 0; a < 2; a++) {
+        doublereal hu0 = Hu[2*a];
+        doublereal hu1 = Hu[2*a+1] * m_dT;
+        for (size_t b = 0; b < 2; b++) {
+            doublereal hv0 = Hv[2*b];
+            doublereal hv1 = Hv[2*b+1] * m_dlnP;
+            size_t k = node(i + a, j + b);
+            val += hu0 * hv0 * m_lnRho[k] + hu1 * hv0 * m_dlnRho_dT[k]
+                   + hu0 * hv1 * m_dlnRho_dlnP[k] + hu1 * hv1 * m_d2lnRho[k];
+        }
+    }
+    return val;
+}
+
+void WaterPropsIAPWSTable::interpSat(size_t i, doublereal t, doublereal vals[3]) const
+{
+    doublereal s = 1.0 - t;
+    doublereal h2 = m_dTsat * m_dTsat / 6.0;
+    for (size_t k = 0; k < 3; k++) {
+        vals[k] = s * m_satVals[3*i+k] + t * m_satVals[3*(i+1)+k]
+                  + h2 * ((s*s*s - s) * m_satCurv[3*i+k] +
+                          (t*t*t - t) * m_satCurv[3*(i+1)+k]);
+    }
+}
+
+bool WaterPropsIAPWSTable::density(doublereal temperature, doublereal pressure,
+                                   int phase, doublereal rhoguess,
+                                   doublereal& rho) const
+{
+    if (temperature < m_Tmin || temperature > maxTemp() || pressure <= 0.0) {
+        return false;
+    }
+    doublereal lnP = std::log(pressure);
+    doublereal x = (temperature - m_Tmin) / m_dT;
+    doublereal y = (lnP - m_lnPmin) / m_dlnP;
+    if (y < 0.0 || y > m_nP - 1) {
+        return false;
+    }
+    size_t i = std::min(static_cast<size_t>(x), m_nT - 2);
+    size_t j = std::min(static_cast<size_t>(y), m_nP - 2);
+    if (m_cellErr[i * (m_nP - 1) + j] < 0.0) {
+        return false;
+    }
+
+    // All nodes of a usable cell are on the same branch, and since the
+    // saturation pressure increases monotonically with T, so is every state
+    // inside the cell. Below T_c, this has to be the requested phase.
+    if (temperature < Tcrit_w) {
+        int requested;
+        if (phase == WATER_LIQUID) {
+            requested = 1;
+        } else if (phase == WATER_GAS || phase == WATER_SUPERCRIT) {
+            requested = 0;
+        } else if (phase == -1) {
+            requested = (rhoguess > Rhocrit_w) ? 1 : 0;
+        } else {
+            return false;
+        }
+        if (requested != m_nodePhase[node(i, j)]) {
+            return false;
+        }
+    }
+    rho = std::exp(interpLnRho(i, j, x - i, y - j));
+    return true;
+}
+
+bool WaterPropsIAPWSTable::saturation(doublereal temperature, doublereal& psat,
+                                      doublereal& rhoLiq, doublereal& rhoGas) const
+{
+    if (temperature < m_Tmin || temperature > maxSatTemp() || m_satErr.empty()) {
+        return false;
+    }
+    doublereal x = (temperature - m_Tmin) / m_dTsat;
+    size_t i = std::min(static_cast<size_t>(x), m_nSat - 2);
+    if (m_satErr[i] < 0.0) {
+        return false;
+    }
+    doublereal vals[3];
+    interpSat(i, x - i, vals);
+    psat = std::exp(vals[0]);
+    rhoLiq = std::exp(vals[1]);
+    rhoGas = std::exp(vals[2]);
+    return true;
+}
+
+}
@@ -0,0 +1,528 @@
+//! @file PropertyTable.cpp
+/*
+ * Tabulated properties of pure substances
+ */
+#include "cantera/tpx/PropertyTable.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/base/global.h"
+
+#include <map>
+#include <mutex>
+
+using namespace Cantera;
+
+namespace {
+
+// number of intervals in the saturation table
+const size_t NSatIntervals = 400;
+
+// number of intervals in the single-phase table in T and ln(P)
+const size_t NTIntervals = 150;
+const size_t NPIntervals = 50;
+
+// range of the single-phase table, relative to the critical point
+const double TminRel = 0.25;
+const double TmaxRel = 5.0;
+const double PminRel = 1.0e-4;
+const double PmaxRel = 10.0;
+
+// relative perturbation used to compute derivatives of the equation of state
+const double Delta = 1.0e-5;
+
+//! Solve for the second derivatives of a cubic spline through uniformly
+//! spaced values y[0], y[stride], ..., y[(n-1)*stride], with n >= 4.
+//! Not-a-knot end conditions are used, since the curvature of the saturation
+//! properties does not vanish at the ends of the table.
+void notAKnotSpline(const double* y, size_t n, size_t stride, double h,
+                    double* M)
+{
+    // With the second derivatives varying linearly over the first two and
+    // the last two intervals, the equations for M[1] and M[n-2] decouple
+    // from their outer neighbors. The remaining tridiagonal system is solved
+    // with the Thomas algorithm.
+    std::vector<double> c(n, 0.0), d(n, 0.0);
+    for (size_t i = 1; i < n - 1; i++) {
+        double rhs = 6.0 / (h * h) *
+            (y[(i+1)*stride] - 2.0 * y[i*stride] + y[(i-1)*stride]);
+        double lower = (i == n - 2) ? 0.0 : 1.0;
+        double upper = (i == 1) ? 0.0 : 1.0;
+        double diag = (i == 1 || i == n - 2) ? 6.0 : 4.0;
+        double denom = diag - lower * c[i-1];
+        c[i] = upper / denom;
+        d[i] = (rhs - lower * d[i-1]) / denom;
+    }
+    M[(n-2)*stride] = d[n-2];
+    for (size_t i = n - 3; i > 0; i--) {
+        M[i*stride] = d[i] - c[i] * M[(i+1)*stride];
+    }
+    M[0] = 2.0 * M[stride] - M[2*stride];
+    M[(n-1)*stride] = 2.0 * M[(n-2)*stride] - M[(n-3)*stride];
+}
+
+//! Cubic Hermite basis functions
+inline void hermite(double t, double H[4])
+{
+    double t2 = t * t;
+    double t3 = t2 * t;
+    H[0] = 2.0 * t3 - 3.0 * t2 + 1.0;
+    H[1] = t3 - 2.0 * t2 + t;
+    H[2] = -2.0 * t3 + 3.0 * t2;
+    H[3] = t3 - t2;
+}
+
+}
+
+namespace tpx
+{
+
+PropertyTable::PropertyTable(Substance& sub, double rtol) :
+    m_rtol(rtol),
+    m_Tmin(std::max(sub.Tmin(), TminRel * sub.Tcrit())),
+    m_dT(0.0),
+    m_nT(NTIntervals + 1),
+    m_lnPmin(log(PminRel * sub.Pcrit())),
+    m_dlnP(log(PmaxRel / PminRel) / NPIntervals),
+    m_nP(NPIntervals + 1),
+    m_Tsat0(m_Tmin),
+    m_dTsat((sub.Tcrit() - m_Tmin) / NSatIntervals),
+    m_nSat(NSatIntervals),
+    m_maxSatErr(0.0),
+    m_maxCellErr(0.0)
+{
+    m_dT = (std::min(sub.Tmax(), TmaxRel * sub.Tcrit()) - m_Tmin) / NTIntervals;
+    if (m_dT <= 0.0 || m_dTsat <= 0.0) {
+        throw CanteraError("PropertyTable::PropertyTable",
+                           "Invalid temperature range for substance '{}'",
+                           sub.name());
+    }
+
+    // The tables are generated by changing the state of the substance
+    // directly, so save its state to be restored afterwards
+    double Tsave = sub.T, Rhosave = sub.Rho, Tslastsave = sub.Tslast;
+    double Rhfsave = sub.Rhf, Rhvsave = sub.Rhv, Pstsave = sub.Pst;
+    std::shared_ptr<const PropertyTable> tablesave = sub.m_table;
+    sub.m_table.reset();
+    try {
+        buildSaturationTable(sub);
+        buildPropertyTable(sub);
+    } catch (...) {
+        sub.T = Tsave;
+        sub.Rho = Rhosave;
+        sub.Tslast = Tslastsave;
+        sub.Rhf = Rhfsave;
+        sub.Rhv = Rhvsave;
+        sub.Pst = Pstsave;
+        sub.m_table = tablesave;
+        throw;
+    }
+    sub.T = Tsave;
+    sub.Rho = Rhosave;
+    sub.Tslast = Tslastsave;
+    sub.Rhf = Rhfsave;
+    sub.Rhv = Rhvsave;
+    sub.Pst = Pstsave;
+    sub.m_table = tablesave;
+}
+
+std::shared_ptr<const PropertyTable> PropertyTable::forSubstance(Substance& sub)
+{
+    static std::mutex table_mutex;
+    static std::map<std::string, std::shared_ptr<const PropertyTable> > tables;
+
+    // Substances such as RedlichKwong can have different parameters
+    // with the same name
+    std::string key = fmt::format("{}:{}:{}:{}", sub.name(), sub.MolWt(),
+                                  sub.Tcrit(), sub.Pcrit());
+    std::unique_lock<std::mutex> lock(table_mutex);
+    std::shared_ptr<const PropertyTable>& table = tables[key];
+    if (!table) {
+        table = std::make_shared<PropertyTable>(sub);
+    }
+    return table;
+}
+
+void PropertyTable::evalTR(Substance& sub, double t, double rho, double vals[3])
+{
+    sub.T = t;
+    sub.Rho = rho;
+    vals[0] = sub.Pp();
+    vals[1] = sub.hp() - sub.m_energy_offset;
+    vals[2] = sub.sp() - sub.m_entropy_offset;
+}
+
+bool PropertyTable::solveTP(Substance& sub, double t, double p, double& rho)
+{
+    // Newton iterations in ln(rho)
+    sub.T = t;
+    for (int n = 0; n < 100; n++) {
+        sub.Rho = rho;
+        double P_here = sub.Pp();
+        if (fabs(P_here - p) < 1.0e-10 * p) {
+            return true;
+        }
+        double dr = Delta * rho;
+        sub.Rho = rho + dr;
+        double dpdr = (sub.Pp() - P_here) / dr;
+        if (dpdr <= 0.0) {
+            // mechanically unstable state
+            return false;
+        }
+        double dlnr = clip((p - P_here) / (rho * dpdr), -0.5, 0.5);
+        rho *= exp(dlnr);
+    }
+    return false;
+}
+
+void PropertyTable::nodeValues(Substance& sub, double t, double rho,
+                               double vals[12])
+{
+    double f0[3], f1[3], f2[3];
+    double dt = Delta * t;
+    double dr = Delta * rho;
+    double dfdt[3], dfdr[3];
+    evalTR(sub, t + dt, rho, f1);
+    evalTR(sub, t - dt, rho, f2);
+    for (size_t k = 0; k < 3; k++) {
+        dfdt[k] = (f1[k] - f2[k]) / (2.0 * dt);
+    }
+    evalTR(sub, t, rho + dr, f1);
+    evalTR(sub, t, rho - dr, f2);
+    for (size_t k = 0; k < 3; k++) {
+        dfdr[k] = (f1[k] - f2[k]) / (2.0 * dr);
+    }
+    evalTR(sub, t, rho, f0);
+
+    // derivatives of rho at constant P and T, respectively
+    double drdt = - dfdt[0] / dfdr[0];
+    double drdp = 1.0 / dfdr[0];
+    double p = f0[0];
+
+    vals[0] = - log(rho);
+    vals[1] = - drdt / rho;
+    vals[2] = - p * drdp / rho;
+    for (size_t k = 1; k < 3; k++) {
+        vals[4*k] = f0[k];
+        vals[4*k+1] = dfdt[k] + dfdr[k] * drdt;
+        vals[4*k+2] = p * dfdr[k] * drdp;
+    }
+}
+
+void PropertyTable::buildSaturationTable(Substance& sub)
+{
+    // The spline is only meaningful if all nodes are valid, so use the
+    // longest run of consecutive nodes where the saturation state can be
+    // found. Failures are expected close to the critical point, and for some
+    // substances at very low saturation pressures.
+    std::vector<double> nodeVals(3 * m_nSat, 0.0);
+    size_t iStart = 0, nValid = 0, iRun = 0;
+    for (size_t i = 0; i < m_nSat; i++) {
+        sub.T = m_Tmin + i * m_dTsat;
+        sub.Tslast = Undef;
+        try {
+            sub.update_sat();
+        } catch (CanteraError&) {
+            iRun = i + 1;
+            continue;
+        }
+        nodeVals[3*i] = log(sub.Pst);
+        nodeVals[3*i+1] = log(sub.Rhf);
+        nodeVals[3*i+2] = log(sub.Rhv);
+        if (i + 1 - iRun > nValid) {
+            iStart = iRun;
+            nValid = i + 1 - iRun;
+        }
+    }
+    m_satVals.assign(nodeVals.begin() + 3 * iStart,
+                     nodeVals.begin() + 3 * (iStart + nValid));
+    m_Tsat0 = m_Tmin + iStart * m_dTsat;
+    if (nValid < 4) {
+        m_nSat = 0;
+        m_satErr.clear();
+        return;
+    }
+    m_nSat = nValid;
+    m_satCurv.assign(3 * m_nSat, 0.0);
+    m_satErr.assign(m_nSat - 1, -1.0);
+    for (size_t k = 0; k < 3; k++) {
+        notAKnotSpline(&m_satVals[k], m_nSat, 3, m_dTsat, &m_satCurv[k]);
+    }
+
+    // Accuracy bound of each interval from the error at its midpoint
+    for (size_t i = 0; i < m_nSat - 1; i++) {
+        sub.T = m_Tsat0 + (i + 0.5) * m_dTsat;
+        sub.Tslast = Undef;
+        try {
+            sub.update_sat();
+        } catch (CanteraError&) {
+            continue;
+        }
+        double exact[3] = {sub.Pst, sub.Rhf, sub.Rhv};
+        double vals[3];
+        interpSat(i, 0.5, vals);
+        double err = 0.0;
+        for (size_t k = 0; k < 3; k++) {
+            err = std::max(err, fabs(exp(vals[k]) - exact[k]) / exact[k]);
+        }
+        if (err <= m_rtol) {
+            m_satErr[i] = err;
+            m_maxSatErr = std::max(m_maxSatErr, err);
+        }
+    }
+    sub.Tslast = Undef;
+}
+
+void PropertyTable::buildPropertyTable(Substance& sub)
+{
+    double Tcrit = sub.Tcrit();
+    m_data.assign(12 * m_nT * m_nP, 0.0);
+    m_nodePhase.assign(m_nT * m_nP, -1);
+    m_cellErr.assign((m_nT - 1) * (m_nP - 1), -1.0);
+
+    double vals[12];
+    for (size_t i = 0; i < m_nT; i++) {
+        double t = m_Tmin + i * m_dT;
+        double psat = 0.0, rhof = 0.0, rhov = 0.0;
+        if (t < Tcrit && !saturation(t, psat, rhof, rhov)) {
+            sub.T = t;
+            sub.Tslast = Undef;
+            try {
+                sub.update_sat();
+            } catch (CanteraError&) {
+                continue;
+            }
+            psat = sub.Pst;
+            rhof = sub.Rhf;
+            rhov = sub.Rhv;
+        }
+        double rhoLast = -1.0;
+        for (size_t j = 0; j < m_nP; j++) {
+            double p = exp(m_lnPmin + j * m_dlnP);
+            double rhoIdeal = p * sub.MolWt() / (8314.47 * t);
+            int phase;
+            double rho;
+            if (t >= Tcrit) {
+                // continue along the supercritical isotherm
+                phase = 2;
+                rho = (rhoLast > 0.0) ? rhoLast : rhoIdeal;
+            } else if (p > psat) {
+                phase = 1;
+                rho = std::max(rhoLast, rhof);
+            } else {
+                phase = 0;
+                rho = std::min(rhoIdeal, rhov);
+            }
+            if (!solveTP(sub, t, p, rho) ||
+                (phase == 1 && rho < (1.0 - 1.0e-3) * rhof) ||
+                (phase == 0 && rho > (1.0 + 1.0e-3) * rhov)) {
+                rhoLast = -1.0;
+                continue;
+            }
+            nodeValues(sub, t, rho, vals);
+            for (size_t q = 0; q < 3; q++) {
+                std::copy(vals + 4*q, vals + 4*q + 3, &m_data[index(i, j, q)]);
+            }
+            m_nodePhase[i * m_nP + j] = phase;
+            rhoLast = (phase == 0) ? -1.0 : rho;
+        }
+    }
+
+    // Mixed derivatives from differences of the ln(P) derivatives along T
+    for (size_t i = 0; i < m_nT; i++) {
+        for (size_t j = 0; j < m_nP; j++) {
+            int ph = m_nodePhase[i * m_nP + j];
+            if (ph < 0) {
+                continue;
+            }
+            bool lo = (i > 0 && m_nodePhase[(i-1) * m_nP + j] == ph);
+            bool hi = (i < m_nT - 1 && m_nodePhase[(i+1) * m_nP + j] == ph);
+            for (size_t q = 0; q < 3; q++) {
+                double& d2 = m_data[index(i, j, q) + 3];
+                if (lo && hi) {
+                    d2 = (m_data[index(i+1, j, q) + 2] -
+                          m_data[index(i-1, j, q) + 2]) / (2.0 * m_dT);
+                } else if (hi) {
+                    d2 = (m_data[index(i+1, j, q) + 2] -
+                          m_data[index(i, j, q) + 2]) / m_dT;
+                } else if (lo) {
+                    d2 = (m_data[index(i, j, q) + 2] -
+                          m_data[index(i-1, j, q) + 2]) / m_dT;
+                }
+            }
+        }
+    }
+
+    // Accuracy of each cell from the error at its center
+    for (size_t i = 0; i < m_nT - 1; i++) {
+        for (size_t j = 0; j < m_nP - 1; j++) {
+            int ph = m_nodePhase[i * m_nP + j];
+            if (ph < 0 || m_nodePhase[(i+1) * m_nP + j] != ph ||
+                    m_nodePhase[i * m_nP + j + 1] != ph ||
+                    m_nodePhase[(i+1) * m_nP + j + 1] != ph) {
+                continue;
+            }
+            double t = m_Tmin + (i + 0.5) * m_dT;
+            double p = exp(m_lnPmin + (j + 0.5) * m_dlnP);
+            double est[3];
+            for (size_t q = 0; q < 3; q++) {
+                est[q] = interp(i, j, q, 0.5, 0.5);
+            }
+            double rho = exp(-est[0]);
+            if (!solveTP(sub, t, p, rho)) {
+                continue;
+            }
+            nodeValues(sub, t, rho, vals);
+            double err = fabs(est[0] - vals[0]);
+            for (size_t q = 1; q < 3; q++) {
+                err = std::max(err, fabs(est[q] - vals[4*q]) / (t * vals[4*q+1]));
+            }
+            m_cellErr[cell(i, j)] = err;
+            m_maxCellErr = std::max(m_maxCellErr, err);
+        }
+    }
+}
+
+void PropertyTable::interpSat(size_t i, double t, double vals[3]) const
+{
+    double s = 1.0 - t;
+    double h2 = m_dTsat * m_dTsat / 6.0;
+    for (size_t k = 0; k < 3; k++) {
+        vals[k] = s * m_satVals[3*i+k] + t * m_satVals[3*(i+1)+k]
+                  + h2 * ((s*s*s - s) * m_satCurv[3*i+k] +
+                          (t*t*t - t) * m_satCurv[3*(i+1)+k]);
+    }
+}
+
+double PropertyTable::interp(size_t i, size_t j, size_t q, double u,
+                             double v) const
+{
+    double Hu[4], Hv[4];
+    hermite(u, Hu);
+    hermite(v, Hv);
+    double val = 0.0;
+    for (size_t a = 0; a < 2; a++) {
+        double hu0 = Hu[2*a];
+        double hu1 = Hu[2*a+1] * m_dT;
+        for (size_t b = 0; b < 2; b++) {
+            double hv0 = Hv[2*b];
+            double hv1 = Hv[2*b+1] * m_dlnP;
+            const double* f = &m_data[index(i + a, j + b, q)];
+            val += hu0 * hv0 * f[0] + hu1 * hv0 * f[1]
+                   + hu0 * hv1 * f[2] + hu1 * hv1 * f[3];
+        }
+    }
+    return val;
+}
+
+double PropertyTable::interpP(size_t i, size_t j, size_t q, double v) const
+{
+    double Hv[4];
+    hermite(v, Hv);
+    const double* f0 = &m_data[index(i, j, q)];
+    const double* f1 = &m_data[index(i, j + 1, q)];
+    return Hv[0] * f0[0] + Hv[1] * m_dlnP * f0[2]
+           + Hv[2] * f1[0] + Hv[3] * m_dlnP * f1[2];
+}
+
+bool PropertyTable::saturation(double t, double& psat, double& rhof,
+                               double& rhov) const
+{
+    if (m_satErr.empty() || t < m_Tsat0 || t > maxSatTemp()) {
+        return false;
+    }
+    double x = (t - m_Tsat0) / m_dTsat;
+    size_t i = std::min(static_cast<size_t>(x), m_nSat - 2);
+    if (m_satErr[i] < 0.0) {
+        return false;
+    }
+    double vals[3];
+    interpSat(i, x - i, vals);
+    psat = exp(vals[0]);
+    rhof = exp(vals[1]);
+    rhov = exp(vals[2]);
+    return true;
+}
+
+bool PropertyTable::density_TP(double t, double p, double& rho) const
+{
+    if (t < m_Tmin || t > maxTemp() || p <= 0.0) {
+        return false;
+    }
+    double x = (t - m_Tmin) / m_dT;
+    double y = (log(p) - m_lnPmin) / m_dlnP;
+    if (y < 0.0 || y > m_nP - 1) {
+        return false;
+    }
+    size_t i = std::min(static_cast<size_t>(x), m_nT - 2);
+    size_t j = std::min(static_cast<size_t>(y), m_nP - 2);
+    if (m_cellErr[cell(i, j)] < 0.0) {
+        return false;
+    }
+    rho = exp(-interp(i, j, 0, x - i, y - j));
+    return true;
+}
+
+bool PropertyTable::state_XP(propertyFlag::type ifx, double x, double p,
+                             double& t, double& rho) const
+{
+    size_t q;
+    if (ifx == propertyFlag::H) {
+        q = 1;
+    } else if (ifx == propertyFlag::S) {
+        q = 2;
+    } else {
+        return false;
+    }
+    if (p <= 0.0) {
+        return false;
+    }
+    double y = (log(p) - m_lnPmin) / m_dlnP;
+    if (y < 0.0 || y > m_nP - 1) {
+        return false;
+    }
+    size_t j = std::min(static_cast<size_t>(y), m_nP - 2);
+    double v = y - j;
+
+    // Both h and s increase monotonically with T at constant P. Find the
+    // cell containing the requested value along the isobar.
+    double flo = interpP(0, j, q, v);
+    for (size_t i = 0; i < m_nT - 1; i++) {
+        double fhi = interpP(i + 1, j, q, v);
+        if (m_cellErr[cell(i, j)] < 0.0 || x < flo || x > fhi) {
+            flo = fhi;
+            continue;
+        }
+
+        // Illinois variant of regula falsi for the position within the cell
+        double ua = 0.0, fa = flo - x;
+        double ub = 1.0, fb = fhi - x;
+        double u = 0.0;
+        int side = 0;
+        for (int n = 0; n < 50 && fa != fb && ub - ua > 1.0e-10; n++) {
+            u = (ua * fb - ub * fa) / (fb - fa);
+            double fu = interp(i, j, q, u, v) - x;
+            if (fu == 0.0) {
+                break;
+            } else if ((fu > 0.0) == (fb > 0.0)) {
+                ub = u;
+                fb = fu;
+                if (side == -1) {
+                    fa *= 0.5;
+                }
+                side = -1;
+            } else {
+                ua = u;
+                fa = fu;
+                if (side == 1) {
+                    fb *= 0.5;
+                }
+                side = 1;
+            }
+        }
+        t = m_Tmin + (i + u) * m_dT;
+        rho = exp(-interp(i, j, 0, u, v));
+        return true;
+    }
+    return false;
+}
+
+}
@@ -4,6 +4,7 @@
  * D. Goodwin, Caltech Nov. 1996
  */
 #include "cantera/tpx/Sub.h"
+#include "cantera/tpx/PropertyTable.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/global.h"
 
@@ -143,6 +144,9 @@ void Substance::Set(PropertyPair::type XY, double x0, double y0)
         if (Lever(Pgiven, y0, x0, propertyFlag::H)) {
             return;
         }
+        if (m_table && set_xP_table(propertyFlag::H, x0, y0)) {
+            return;
+        }
         set_xy(propertyFlag::H, propertyFlag::P,
                x0, y0, TolAbsH, TolAbsP, TolRel, TolRel);
         break;
@@ -150,6 +154,9 @@ void Substance::Set(PropertyPair::type XY, double x0, double y0)
         if (Lever(Pgiven, y0, x0, propertyFlag::S)) {
             return;
         }
+        if (m_table && set_xP_table(propertyFlag::S, x0, y0)) {
+            return;
+        }
         set_xy(propertyFlag::S, propertyFlag::P,
                x0, y0, TolAbsS, TolAbsP, TolRel, TolRel);
         break;
@@ -161,6 +168,9 @@ void Substance::Set(PropertyPair::type XY, double x0, double y0)
                x0, y0, TolAbsP, TolAbsV, TolRel, TolRel);
         break;
     case PropertyPair::TP:
+        if (m_table && set_xP_table(propertyFlag::T, x0, y0)) {
+            return;
+        }
         if (x0 < Tcrit()) {
             set_T(x0);
             if (y0 < Ps()) {
@@ -240,6 +250,16 @@ void Substance::Set(PropertyPair::type XY, double x0, double y0)
     }
 }
 
+void Substance::useTables(bool flag)
+{
+    m_table.reset();
+    if (flag) {
+        m_table = PropertyTable::forSubstance(*this);
+    }
+    // discard saturation properties computed with the other method
+    Tslast = Undef;
+}
+
 //------------------ Protected and Private Functions -------------------
 
 void Substance::set_Rho(double r0)
@@ -283,6 +303,10 @@ double Substance::Ps()
 void Substance::update_sat()
 {
     if ((T != Tslast) && (T < Tcrit())) {
+        if (m_table && m_table->saturation(T, Pst, Rhf, Rhv)) {
+            Tslast = T;
+            return;
+        }
         double Rho_save = Rho;
         double pp = Psat();
         double lps = log(pp);
@@ -512,6 +536,98 @@ void Substance::set_xy(propertyFlag::type ifx, propertyFlag::type ify,
     }
 }
 
+bool Substance::set_xP_table(propertyFlag::type ifx, double X, double Pres)
+{
+    double t0, r0;
+    double atx;
+    if (ifx == propertyFlag::T) {
+        if (X < Tmin() || X > Tmax() || !m_table->density_TP(X, Pres, r0)) {
+            return false;
+        }
+        t0 = X;
+        atx = TolAbsT;
+    } else if (ifx == propertyFlag::H) {
+        if (!m_table->state_XP(ifx, X - m_energy_offset, Pres, t0, r0)) {
+            return false;
+        }
+        atx = TolAbsH;
+    } else if (ifx == propertyFlag::S) {
+        if (!m_table->state_XP(ifx, X - m_entropy_offset, Pres, t0, r0)) {
+            return false;
+        }
+        atx = TolAbsS;
+    } else {
+        return false;
+    }
+
+    // Newton iterations on the single-phase equation of state, using the
+    // same convergence criteria as set_xy
+    double Tsave = T;
+    double Rhosave = Rho;
+    double tolX = atx + TolRel*fabs(X);
+    double tolP = TolAbsP + TolRel*Pres;
+    T = t0;
+    Rho = r0;
+    bool converged = false;
+    for (int n = 0; n < 10; n++) {
+        double t_here = T;
+        double r_here = Rho;
+        double P_here = Pp();
+        double dr = 1.e-6*r_here;
+        if (ifx == propertyFlag::T) {
+            if (fabs(Pres - P_here) < tolP) {
+                converged = true;
+                break;
+            }
+            Rho = r_here + dr;
+            double dpdr = (Pp() - P_here)/dr;
+            if (dpdr <= 0.0) {
+                break;
+            }
+            Rho = r_here + (Pres - P_here)/dpdr;
+        } else {
+            double x_here = vprop(ifx);
+            if (fabs(X - x_here) < tolX && fabs(Pres - P_here) < tolP) {
+                converged = true;
+                break;
+            }
+            double dt = 1.e-6*t_here;
+            T = t_here + dt;
+            double dxdt = (vprop(ifx) - x_here)/dt;
+            double dpdt = (Pp() - P_here)/dt;
+            T = t_here;
+            Rho = r_here + dr;
+            double dxdr = (vprop(ifx) - x_here)/dr;
+            double dpdr = (Pp() - P_here)/dr;
+            double det = dxdt*dpdr - dxdr*dpdt;
+            if (det == 0.0) {
+                break;
+            }
+            T = t_here + ((X - x_here)*dpdr - (Pres - P_here)*dxdr)/det;
+            Rho = r_here + ((Pres - P_here)*dxdt - (X - x_here)*dpdt)/det;
+        }
+        if (Rho <= 0.0 || T < Tmin() || T > Tmax()) {
+            break;
+        }
+    }
+
+    // The result must be on the stable branch, which for (T,P) is given by
+    // comparing P to the saturation pressure, as in Set
+    if (converged && T < Tcrit()) {
+        update_sat();
+        if (ifx == propertyFlag::T) {
+            converged = (Pres < Pst) ? (Rho <= Rhv) : (Rho >= Rhf);
+        } else {
+            converged = (Rho <= Rhv || Rho >= Rhf);
+        }
+    }
+    if (!converged) {
+        T = Tsave;
+        Rho = Rhosave;
+    }
+    return converged;
+}
+
 double Substance::prop(propertyFlag::type ijob)
 {
     if (ijob == propertyFlag::P) {
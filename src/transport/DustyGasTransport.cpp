@@ -18,9 +18,12 @@ namespace Cantera
 DustyGasTransport::DustyGasTransport(thermo_t* thermo) :
     Transport(thermo),
     m_temp(-1.0),
+    m_pres(-1.0),
+    m_iStateMF(-1),
     m_gradP(0.0),
     m_knudsen_ok(false),
     m_bulk_ok(false),
+    m_H_ok(false),
     m_porosity(0.0),
     m_tortuosity(1.0),
     m_pore_radius(0.0),
@@ -31,9 +34,12 @@ DustyGasTransport::DustyGasTransport(thermo_t* thermo) :
 
 DustyGasTransport::DustyGasTransport(const DustyGasTransport& right) :
     m_temp(-1.0),
+    m_pres(-1.0),
+    m_iStateMF(-1),
     m_gradP(0.0),
     m_knudsen_ok(false),
     m_bulk_ok(false),
+    m_H_ok(false),
     m_porosity(0.0),
     m_tortuosity(1.0),
     m_pore_radius(0.0),
@@ -55,12 +61,15 @@ DustyGasTransport& DustyGasTransport::operator=(const DustyGasTransport& right)
     m_x = right.m_x;
     m_dk = right.m_dk;
     m_temp = right.m_temp;
+    m_pres = right.m_pres;
+    m_iStateMF = right.m_iStateMF;
     m_multidiff = right.m_multidiff;
     m_spwork = right.m_spwork;
     m_spwork2 = right.m_spwork2;
     m_gradP = right.m_gradP;
     m_knudsen_ok = right.m_knudsen_ok;
     m_bulk_ok= right.m_bulk_ok;
+    m_H_ok = right.m_H_ok;
     m_porosity = right.m_porosity;
     m_tortuosity = right.m_tortuosity;
     m_pore_radius = right.m_pore_radius;
@@ -108,6 +117,8 @@ void DustyGasTransport::initialize(ThermoPhase* phase, Transport* gastr)
     // set flags all false
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_H_ok = false;
+    m_iStateMF = -1;
 
     m_spwork.resize(m_nsp);
     m_spwork2.resize(m_nsp);
@@ -119,14 +130,9 @@ void DustyGasTransport::updateBinaryDiffCoeffs()
         return;
     }
 
-    // get the gaseous binary diffusion coefficients
+    // get the gaseous binary diffusion coefficients. The porosity and
+    // tortuosity are accounted for in eval_H_matrix().
     m_gastran->getBinaryDiffCoeffs(m_nsp, m_d.ptrColumn(0));
-    doublereal por2tort = m_porosity / m_tortuosity;
-    for (size_t n = 0; n < m_nsp; n++) {
-        for (size_t m = 0; m < m_nsp; m++) {
-            m_d(n,m) *= por2tort;
-        }
-    }
     m_bulk_ok = true;
 }
 
@@ -148,11 +154,12 @@ void DustyGasTransport::eval_H_matrix()
 {
     updateBinaryDiffCoeffs();
     updateKnudsenDiffCoeffs();
+    doublereal tort2por = m_tortuosity / m_porosity;
     doublereal sum;
     for (size_t k = 0; k < m_nsp; k++) {
         // evaluate off-diagonal terms
         for (size_t j = 0; j < m_nsp; j++) {
-            m_multidiff(k,j) = -m_x[k]/m_d(k,j);
+            m_multidiff(k,j) = -tort2por * m_x[k]/m_d(k,j);
         }
 
         // evaluate diagonal term
@@ -162,7 +169,7 @@ void DustyGasTransport::eval_H_matrix()
                 sum += m_x[j]/m_d(k,j);
             }
         }
-        m_multidiff(k,k) = 1.0/m_dk[k] + sum;
+        m_multidiff(k,k) = 1.0/m_dk[k] + tort2por * sum;
     }
 }
 
@@ -201,10 +208,6 @@ void DustyGasTransport::getMolarFluxes(const doublereal* const state1,
     m_thermo->setState_TPX(tbar, pbar, cbar);
     updateMultiDiffCoeffs();
 
-    // Multiply m_multidiff and gradc together and store the result in fluxes[]
-    multiply(m_multidiff, gradc, fluxes);
-    divide_each(cbar, cbar + m_nsp, m_dk.begin());
-
     // if no permeability has been specified, use result for
     // close-packed spheres
     double b = 0.0;
@@ -217,11 +220,13 @@ void DustyGasTransport::getMolarFluxes(const doublereal* const state1,
         b = m_perm;
     }
     b *= gradp / m_gastran->viscosity();
-    scale(cbar, cbar + m_nsp, cbar, b);
 
-    // Multiply m_multidiff with cbar and add it to fluxes
-    increment(m_multidiff, cbar, fluxes);
-    scale(fluxes, fluxes + m_nsp, fluxes, -1.0);
+    // Form the right-hand side and solve for the fluxes using the factored
+    // H matrix
+    for (size_t k = 0; k < m_nsp; k++) {
+        fluxes[k] = -(gradc[k] + b * cbar[k] / m_dk[k]);
+    }
+    m_multidiff.solve(fluxes);
 }
 
 void DustyGasTransport::updateMultiDiffCoeffs()
@@ -231,24 +236,37 @@ void DustyGasTransport::updateMultiDiffCoeffs()
 
     // update the mole fractions
     updateTransport_C();
+    if (m_H_ok) {
+        return;
+    }
     eval_H_matrix();
 
-    // invert H
-    int ierr = invert(m_multidiff);
+    // factor H
+    int ierr = m_multidiff.factor();
     if (ierr != 0) {
         throw CanteraError("DustyGasTransport::updateMultiDiffCoeffs",
-                           "invert returned ierr = {}", ierr);
+                           "factor returned ierr = {}", ierr);
     }
+    m_H_ok = true;
 }
 
 void DustyGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
 {
     updateMultiDiffCoeffs();
-    for (size_t i = 0; i < m_nsp; i++) {
-        for (size_t j = 0; j < m_nsp; j++) {
-            d[ld*j + i] = m_multidiff(i,j);
+    // The multicomponent diffusion coefficients are the columns of the
+    // inverse of H, which are found by back-substitution
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t i = 0; i < m_nsp; i++) {
+            d[ld*j + i] = (i == j) ? 1.0 : 0.0;
         }
     }
+    m_multidiff.solve(d, m_nsp, ld);
+}
+
+void DustyGasTransport::getFactoredHMatrix(SquareMatrix& H)
+{
+    updateMultiDiffCoeffs();
+    H = m_multidiff;
 }
 
 void DustyGasTransport::updateTransport_T()
@@ -259,10 +277,23 @@ void DustyGasTransport::updateTransport_T()
     m_temp = m_thermo->temperature();
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_H_ok = false;
 }
 
 void DustyGasTransport::updateTransport_C()
 {
+    int iStateMF = m_thermo->stateMFNumber();
+    doublereal pres = m_thermo->pressure();
+    if (iStateMF == m_iStateMF && pres == m_pres) {
+        return;
+    }
+    // diffusion coeffs depend on Pressure, but not on the composition
+    if (pres != m_pres) {
+        m_pres = pres;
+        m_bulk_ok = false;
+    }
+    m_iStateMF = iStateMF;
+    m_H_ok = false;
     m_thermo->getMoleFractions(m_x.data());
 
     // add an offset to avoid a pure species condition
@@ -270,28 +301,27 @@ void DustyGasTransport::updateTransport_C()
     for (size_t k = 0; k < m_nsp; k++) {
         m_x[k] = std::max(Tiny, m_x[k]);
     }
-    // diffusion coeffs depend on Pressure
-    m_bulk_ok = false;
 }
 
 void DustyGasTransport::setPorosity(doublereal porosity)
 {
     m_porosity = porosity;
     m_knudsen_ok = false;
-    m_bulk_ok = false;
+    m_H_ok = false;
 }
 
 void DustyGasTransport::setTortuosity(doublereal tort)
 {
     m_tortuosity = tort;
     m_knudsen_ok = false;
-    m_bulk_ok = false;
+    m_H_ok = false;
 }
 
 void DustyGasTransport::setMeanPoreRadius(doublereal rbar)
 {
     m_pore_radius = rbar;
     m_knudsen_ok = false;
+    m_H_ok = false;
 }
 
 void DustyGasTransport::setMeanParticleDiameter(doublereal dbar)
@@ -5,6 +5,10 @@
 #include "cantera/numerics/polyfit.h"
 #include "cantera/transport/TransportData.h"
 
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
 namespace Cantera
 {
 
@@ -12,6 +16,84 @@ namespace Cantera
 //! except in CK mode, where the degree is 6.
 #define COLL_INT_POLY_DEGREE 8
 
+namespace {
+
+//! Number of temperatures used to generate the property fits
+const size_t nFitPoints = 50;
+
+//! Identifier at the start of the fit cache files. Should be changed whenever
+//! the format of the files or the method used to generate the fits changes.
+const char fitCacheMagic[8] = {'C', 'T', 'T', 'R', 'F', 'I', 'T', '1'};
+
+//! Directory used for the fit cache, and the mutex protecting it
+std::string fitCacheDir;
+std::mutex fitCacheMutex;
+
+//! 64-bit FNV-1a hash of the bytes of a vector
+uint64_t hashValues(const vector_fp& values)
+{
+    uint64_t h = 14695981039346656037ULL;
+    const unsigned char* bytes =
+        reinterpret_cast<const unsigned char*>(values.data());
+    for (size_t i = 0; i < values.size() * sizeof(double); i++) {
+        h ^= bytes[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+void writeFits(std::ostream& s, const std::vector<vector_fp>& fits)
+{
+    uint64_t n = fits.size();
+    s.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    for (const auto& fit : fits) {
+        n = fit.size();
+        s.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        s.write(reinterpret_cast<const char*>(fit.data()), n * sizeof(double));
+    }
+}
+
+//! Read fits written by writeFits. Returns false if the file is truncated or
+//! does not contain *nfits* fits of *ncoeffs* coefficients each.
+bool readFits(std::istream& s, std::vector<vector_fp>& fits, size_t nfits,
+              size_t ncoeffs)
+{
+    uint64_t n = 0;
+    s.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if (!s || n != nfits) {
+        return false;
+    }
+    fits.assign(nfits, vector_fp(ncoeffs));
+    for (size_t i = 0; i < nfits; i++) {
+        s.read(reinterpret_cast<char*>(&n), sizeof(n));
+        if (!s || n != ncoeffs) {
+            return false;
+        }
+        s.read(reinterpret_cast<char*>(fits[i].data()), n * sizeof(double));
+    }
+    return static_cast<bool>(s);
+}
+
+//! Rearrange a set of fits so that the n-th coefficients of all of the fits
+//! are stored contiguously
+vector_fp transposeFits(const std::vector<vector_fp>& fits)
+{
+    if (fits.empty()) {
+        return vector_fp();
+    }
+    size_t nfits = fits.size();
+    size_t ncoeffs = fits[0].size();
+    vector_fp coeffs(nfits * ncoeffs);
+    for (size_t i = 0; i < nfits; i++) {
+        for (size_t n = 0; n < ncoeffs; n++) {
+            coeffs[n*nfits + i] = fits[i][n];
+        }
+    }
+    return coeffs;
+}
+
+}
+
 GasTransport::GasTransport(ThermoPhase* thermo) :
     Transport(thermo),
     m_viscmix(0.0),
@@ -28,6 +110,11 @@ GasTransport::GasTransport(ThermoPhase* thermo) :
     m_logt(0.0),
     m_t14(0.0),
     m_t32(0.0),
+    m_bdiffTableLogTmin(0.0),
+    m_bdiffTableDlogT(1.0),
+    m_bdiffTableNT(0),
+    m_bdiffTableRtol(1.0e-5),
+    m_bdiffTableErr(0.0),
     m_log_level(0)
 {
 }
@@ -47,6 +134,11 @@ GasTransport::GasTransport(const GasTransport& right) :
     m_logt(0.0),
     m_t14(0.0),
     m_t32(0.0),
+    m_bdiffTableLogTmin(0.0),
+    m_bdiffTableDlogT(1.0),
+    m_bdiffTableNT(0),
+    m_bdiffTableRtol(1.0e-5),
+    m_bdiffTableErr(0.0),
     m_log_level(0)
 {
 }
@@ -78,6 +170,16 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_diffcoeffs = right.m_diffcoeffs;
     m_bdiff = right.m_bdiff;
     m_condcoeffs = right.m_condcoeffs;
+    m_viscFit = right.m_viscFit;
+    m_condFit = right.m_condFit;
+    m_diffFit = right.m_diffFit;
+    m_bdiffPairs = right.m_bdiffPairs;
+    m_bdiffTable = right.m_bdiffTable;
+    m_bdiffTableLogTmin = right.m_bdiffTableLogTmin;
+    m_bdiffTableDlogT = right.m_bdiffTableDlogT;
+    m_bdiffTableNT = right.m_bdiffTableNT;
+    m_bdiffTableRtol = right.m_bdiffTableRtol;
+    m_bdiffTableErr = right.m_bdiffTableErr;
     m_poly = right.m_poly;
     m_omega22_poly = right.m_omega22_poly;
     m_astar_poly = right.m_astar_poly;
@@ -101,7 +203,11 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
 
 void GasTransport::update_T()
 {
-    double T = m_thermo->temperature();
+    updateTemperature(m_thermo->temperature());
+}
+
+void GasTransport::updateTemperature(doublereal T)
+{
     if (T == m_temp) {
         return;
     }
@@ -128,11 +234,24 @@ void GasTransport::update_T()
     m_bindiff_ok = false;
 }
 
+void GasTransport::updateMoleFractions(const doublereal* const x)
+{
+    // add an offset to avoid a pure species condition
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_molefracs[k] = std::max(Tiny, x[k]);
+    }
+    m_visc_ok = false;
+}
+
 doublereal GasTransport::viscosity()
 {
     update_T();
     update_C();
+    return evalViscosity();
+}
 
+doublereal GasTransport::evalViscosity()
+{
     if (m_visc_ok) {
         return m_viscmix;
     }
@@ -154,21 +273,33 @@ doublereal GasTransport::viscosity()
 
 void GasTransport::updateViscosity_T()
 {
-    doublereal vratiokj, wratiojk, factor1;
     if (!m_spvisc_ok) {
         updateSpeciesViscosities();
     }
 
-    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling
+    // reciprocal square roots of the species viscosities
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_spwork[k] = 1.0 / m_sqvisc[k];
+    }
+
+    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling. Each pair is evaluated
+    // once: the lower triangle of column j is computed from the
+    // mass-dependent factors stored in the same column of m_wratjk and
+    // m_wratkj1, and the transposed entries are obtained from it using
+    // phi(j,k) = phi(k,j) * (visc[j]/visc[k]) * (mw[k]/mw[j]).
     for (size_t j = 0; j < m_nsp; j++) {
+        const doublereal* wrat = m_wratjk.ptrColumn(j);
+        const doublereal* wrat1 = m_wratkj1.ptrColumn(j);
+        doublereal* phi = m_phi.ptrColumn(j);
+        doublereal rsqvisc_j = m_spwork[j];
         for (size_t k = j; k < m_nsp; k++) {
-            vratiokj = m_visc[k]/m_visc[j];
-            wratiojk = m_mw[j]/m_mw[k];
-
-            // Note that m_wratjk(k,j) holds the square root of m_wratjk(j,k)!
-            factor1 = 1.0 + (m_sqvisc[k]/m_sqvisc[j]) * m_wratjk(k,j);
-            m_phi(k,j) = factor1*factor1 / (sqrt(8.0) * m_wratkj1(j,k));
-            m_phi(j,k) = m_phi(k,j)/(vratiokj * wratiojk);
+            doublereal factor1 = 1.0 + m_sqvisc[k] * rsqvisc_j * wrat[k];
+            phi[k] = factor1 * factor1 * wrat1[k];
+        }
+        doublereal sqvisc_j = m_sqvisc[j];
+        for (size_t k = j + 1; k < m_nsp; k++) {
+            doublereal vratiojk = sqvisc_j * m_spwork[k];
+            m_phi(j,k) = phi[k] * vratiojk * vratiojk * m_wratjk(j,k);
         }
     }
     m_viscwt_ok = true;
@@ -176,16 +307,17 @@ void GasTransport::updateViscosity_T()
 
 void GasTransport::updateSpeciesViscosities()
 {
-    update_T();
     if (m_mode == CK_Mode) {
+        evalPolyFits(m_viscFit, m_nsp, m_logt, m_visc.data());
         for (size_t k = 0; k < m_nsp; k++) {
-            m_visc[k] = exp(dot4(m_polytempvec, m_visccoeffs[k]));
+            m_visc[k] = exp(m_visc[k]);
             m_sqvisc[k] = sqrt(m_visc[k]);
         }
     } else {
+        // the polynomial fit is done for sqrt(visc/sqrt(T))
+        evalPolyFits(m_viscFit, m_nsp, m_logt, m_sqvisc.data());
         for (size_t k = 0; k < m_nsp; k++) {
-            // the polynomial fit is done for sqrt(visc/sqrt(T))
-            m_sqvisc[k] = m_t14 * dot5(m_polytempvec, m_visccoeffs[k]);
+            m_sqvisc[k] *= m_t14;
             m_visc[k] = (m_sqvisc[k] * m_sqvisc[k]);
         }
     }
@@ -194,28 +326,141 @@ void GasTransport::updateSpeciesViscosities()
 
 void GasTransport::updateDiff_T()
 {
-    update_T();
     // evaluate binary diffusion coefficients at unit pressure
+    size_t npairs = m_bdiffPairs.size();
+    doublereal u = (m_logt - m_bdiffTableLogTmin) / m_bdiffTableDlogT;
+    if (!m_bdiffTable.empty() && u >= 0.0 && u <= m_bdiffTableNT - 1) {
+        // interpolate linearly in ln(T) between two nodes of the table
+        size_t n = std::min(static_cast<size_t>(u), m_bdiffTableNT - 2);
+        u -= n;
+        const doublereal* f0 = &m_bdiffTable[n * npairs];
+        const doublereal* f1 = f0 + npairs;
+        for (size_t ic = 0; ic < npairs; ic++) {
+            m_bdiffPairs[ic] = m_t32 * (f0[ic] + u * (f1[ic] - f0[ic]));
+        }
+    } else if (m_mode == CK_Mode) {
+        evalPolyFits(m_diffFit, npairs, m_logt, m_bdiffPairs.data());
+        for (size_t ic = 0; ic < npairs; ic++) {
+            m_bdiffPairs[ic] = exp(m_bdiffPairs[ic]);
+        }
+    } else {
+        evalPolyFits(m_diffFit, npairs, m_logt, m_bdiffPairs.data());
+        for (size_t ic = 0; ic < npairs; ic++) {
+            m_bdiffPairs[ic] *= m_t32;
+        }
+    }
     size_t ic = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            m_bdiff(i,j) = m_bdiffPairs[ic];
+            m_bdiff(j,i) = m_bdiffPairs[ic];
+            ic++;
+        }
+    }
+    m_bindiff_ok = true;
+}
+
+void GasTransport::evalPolyFits(const vector_fp& coeffs, size_t n,
+                                doublereal logT, doublereal* const out) const
+{
+    // Evaluate all of the polynomials together using Horner's rule, so that
+    // the inner loops run over contiguous coefficients
+    size_t ncoeffs = coeffs.size() / n;
+    const doublereal* c = &coeffs[(ncoeffs - 1) * n];
+    for (size_t i = 0; i < n; i++) {
+        out[i] = c[i];
+    }
+    for (size_t m = ncoeffs - 1; m > 0; m--) {
+        c = &coeffs[(m - 1) * n];
+        for (size_t i = 0; i < n; i++) {
+            out[i] = out[i] * logT + c[i];
+        }
+    }
+}
+
+void GasTransport::evalDiffFits(doublereal T, doublereal* const f) const
+{
+    size_t npairs = m_bdiffPairs.size();
+    evalPolyFits(m_diffFit, npairs, log(T), f);
     if (m_mode == CK_Mode) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
+        doublereal rt32 = 1.0 / (T * sqrt(T));
+        for (size_t ic = 0; ic < npairs; ic++) {
+            f[ic] = exp(f[ic]) * rt32;
+        }
+    }
+}
+
+void GasTransport::useBinaryDiffTable(bool flag, doublereal rtol)
+{
+    if (rtol <= 0.0) {
+        throw CanteraError("GasTransport::useBinaryDiffTable",
+                           "Tolerance must be positive.");
+    }
+    m_bdiffTableRtol = rtol;
+    m_bdiffTable.clear();
+    m_bdiffTableErr = 0.0;
+    m_bindiff_ok = false;
+    if (flag) {
+        buildBinaryDiffTable();
+    }
+}
+
+const vector_fp& GasTransport::binDiffusivityPolynomial(size_t i,
+                                                        size_t j) const
+{
+    m_thermo->checkSpeciesIndex(i);
+    m_thermo->checkSpeciesIndex(j);
+    if (i > j) {
+        std::swap(i, j);
+    }
+    // index of the pair (i,j) in the order used by m_diffcoeffs
+    size_t ic = i * m_nsp - (i * (i - 1)) / 2 + (j - i);
+    return m_diffcoeffs[ic];
+}
+
+void GasTransport::buildBinaryDiffTable()
+{
+    size_t npairs = m_bdiffPairs.size();
+    doublereal logTmin = log(m_thermo->minTemp());
+    doublereal logTmax = log(m_thermo->maxTemp());
+    vector_fp fmid(npairs);
+
+    // Start with a coarse grid, and double the number of intervals until the
+    // interpolation error is small enough
+    for (size_t nint = 16; nint <= 4096; nint *= 2) {
+        doublereal dlogT = (logTmax - logTmin) / nint;
+        m_bdiffTable.resize((nint + 1) * npairs);
+        for (size_t n = 0; n <= nint; n++) {
+            evalDiffFits(exp(logTmin + n * dlogT), &m_bdiffTable[n * npairs]);
+        }
+
+        doublereal maxerr = 0.0;
+        for (size_t n = 0; n < nint; n++) {
+            evalDiffFits(exp(logTmin + (n + 0.5) * dlogT), fmid.data());
+            const doublereal* f0 = &m_bdiffTable[n * npairs];
+            const doublereal* f1 = f0 + npairs;
+            for (size_t ic = 0; ic < npairs; ic++) {
+                doublereal f = 0.5 * (f0[ic] + f1[ic]);
+                maxerr = std::max(maxerr, fabs(f - fmid[ic]) / fabs(fmid[ic]));
             }
         }
-    } else {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
+
+        if (maxerr <= m_bdiffTableRtol) {
+            m_bdiffTableLogTmin = logTmin;
+            m_bdiffTableDlogT = dlogT;
+            m_bdiffTableNT = nint + 1;
+            m_bdiffTableErr = maxerr;
+            if (m_log_level) {
+                writelogf("Binary diffusion coefficient table: %d nodes, "
+                          "maximum relative error %12.6g\n", nint + 1, maxerr);
             }
+            return;
         }
     }
-    m_bindiff_ok = true;
+    m_bdiffTable.clear();
+    throw CanteraError("GasTransport::buildBinaryDiffTable",
+        "Unable to reach the tolerance of {} for the binary diffusion "
+        "coefficient table.", m_bdiffTableRtol);
 }
 
 void GasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
@@ -240,15 +485,18 @@ void GasTransport::getMixDiffCoeffs(doublereal* const d)
 {
     update_T();
     update_C();
+    evalMixDiffCoeffs(m_thermo->pressure(), m_thermo->meanMolecularWeight(), d);
+}
 
+void GasTransport::evalMixDiffCoeffs(doublereal p, doublereal mmw,
+                                     doublereal* const d)
+{
     // update the binary diffusion coefficients if necessary
     if (!m_bindiff_ok) {
         updateDiff_T();
     }
 
-    doublereal mmw = m_thermo->meanMolecularWeight();
     doublereal sumxw = 0.0;
-    doublereal p = m_thermo->pressure();
     if (m_nsp == 1) {
         d[0] = m_bdiff(0,0) / p;
     } else {
@@ -256,11 +504,13 @@ void GasTransport::getMixDiffCoeffs(doublereal* const d)
             sumxw += m_molefracs[k] * m_mw[k];
         }
         for (size_t k = 0; k < m_nsp; k++) {
+            const doublereal* bdiff_k = m_bdiff.ptrColumn(k);
             double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
+            for (size_t j = 0; j < k; j++) {
+                sum2 += m_molefracs[j] / bdiff_k[j];
+            }
+            for (size_t j = k + 1; j < m_nsp; j++) {
+                sum2 += m_molefracs[j] / bdiff_k[j];
             }
             if (sum2 <= 0.0) {
                 d[k] = m_bdiff(k,k) / p;
@@ -286,11 +536,13 @@ void GasTransport::getMixDiffCoeffsMole(doublereal* const d)
         d[0] = m_bdiff(0,0) / p;
     } else {
         for (size_t k = 0; k < m_nsp; k++) {
+            const doublereal* bdiff_k = m_bdiff.ptrColumn(k);
             double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
+            for (size_t j = 0; j < k; j++) {
+                sum2 += m_molefracs[j] / bdiff_k[j];
+            }
+            for (size_t j = k + 1; j < m_nsp; j++) {
+                sum2 += m_molefracs[j] / bdiff_k[j];
             }
             if (sum2 <= 0.0) {
                 d[k] = m_bdiff(k,k) / p;
@@ -318,14 +570,17 @@ void GasTransport::getMixDiffCoeffsMass(doublereal* const d)
         d[0] = m_bdiff(0,0) / p;
     } else {
         for (size_t k=0; k<m_nsp; k++) {
+            // m_bdiff is symmetric, so column k can be used in place of row k
+            const doublereal* bdiff_k = m_bdiff.ptrColumn(k);
             double sum1 = 0.0;
             double sum2 = 0.0;
-            for (size_t i=0; i<m_nsp; i++) {
-                if (i==k) {
-                    continue;
-                }
-                sum1 += m_molefracs[i] / m_bdiff(k,i);
-                sum2 += m_molefracs[i] * m_mw[i] / m_bdiff(k,i);
+            for (size_t i=0; i<k; i++) {
+                sum1 += m_molefracs[i] / bdiff_k[i];
+                sum2 += m_molefracs[i] * m_mw[i] / bdiff_k[i];
+            }
+            for (size_t i=k+1; i<m_nsp; i++) {
+                sum1 += m_molefracs[i] / bdiff_k[i];
+                sum2 += m_molefracs[i] * m_mw[i] / bdiff_k[i];
             }
             sum1 *= p;
             sum2 *= p * m_molefracs[k] / (mmw - m_mw[k]*m_molefracs[k]);
@@ -334,6 +589,80 @@ void GasTransport::getMixDiffCoeffsMass(doublereal* const d)
     }
 }
 
+void GasTransport::getMixtureProperties(size_t npoints, const doublereal* T,
+        const doublereal* P, const doublereal* X, doublereal* visc,
+        doublereal* cond, doublereal* diff, doublereal* dtherm)
+{
+    vector_fp x(m_nsp);
+    for (size_t i = 0; i < npoints; i++) {
+        // Normalize the mole fractions in the same way as
+        // Phase::setMoleFractions
+        const doublereal* xi = X + i*m_nsp;
+        doublereal norm = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            x[k] = std::max(xi[k], 0.0);
+            norm += x[k];
+        }
+        doublereal mmw = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            x[k] /= norm;
+            mmw += x[k] * m_mw[k];
+        }
+
+        evalMixtureProperties(i, T[i], P[i], x.data(), mmw, visc, cond, diff,
+                              dtherm);
+    }
+
+    // The internal state no longer corresponds to the state of the phase, so
+    // it needs to be updated before the next property evaluation.
+    m_temp = -1.0;
+}
+
+void GasTransport::getMixtureProperties_NoNorm(size_t npoints,
+        const doublereal* T, const doublereal* P, const doublereal* Y,
+        doublereal* visc, doublereal* cond, doublereal* diff,
+        doublereal* dtherm)
+{
+    vector_fp x(m_nsp);
+    for (size_t i = 0; i < npoints; i++) {
+        // Form the mole fractions and mean molecular weight in the same way
+        // as Phase::setMassFractions_NoNorm
+        const doublereal* yi = Y + i*m_nsp;
+        doublereal sum = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            x[k] = yi[k] / m_mw[k];
+            sum += x[k];
+        }
+        doublereal mmw = 1.0 / sum;
+        for (size_t k = 0; k < m_nsp; k++) {
+            x[k] *= mmw;
+        }
+        evalMixtureProperties(i, T[i], P[i], x.data(), mmw, visc, cond, diff,
+                              dtherm);
+    }
+    m_temp = -1.0;
+}
+
+void GasTransport::evalMixtureProperties(size_t i, doublereal T, doublereal P,
+        const doublereal* x, doublereal mmw, doublereal* visc,
+        doublereal* cond, doublereal* diff, doublereal* dtherm)
+{
+    updateTemperature(T);
+    updateMoleFractions(x);
+    if (visc) {
+        visc[i] = evalViscosity();
+    }
+    if (cond) {
+        cond[i] = evalThermalConductivity();
+    }
+    if (diff) {
+        evalMixDiffCoeffs(P, mmw, diff + i*m_nsp);
+    }
+    if (dtherm) {
+        evalThermalDiffCoeffs(dtherm + i*m_nsp);
+    }
+}
+
 void GasTransport::init(thermo_t* thermo, int mode, int log_level)
 {
     m_thermo = thermo;
@@ -357,9 +686,9 @@ void GasTransport::init(thermo_t* thermo, int mode, int log_level)
     m_wratkj1.resize(m_nsp, m_nsp, 0.0);
     for (size_t j = 0; j < m_nsp; j++) {
         for (size_t k = j; k < m_nsp; k++) {
-            m_wratjk(j,k) = sqrt(m_mw[j]/m_mw[k]);
-            m_wratjk(k,j) = sqrt(m_wratjk(j,k));
-            m_wratkj1(j,k) = sqrt(1.0 + m_mw[k]/m_mw[j]);
+            m_wratjk(j,k) = m_mw[k]/m_mw[j];
+            m_wratjk(k,j) = sqrt(sqrt(m_mw[j]/m_mw[k]));
+            m_wratkj1(k,j) = 1.0 / sqrt(8.0 * (1.0 + m_mw[k]/m_mw[j]));
         }
     }
 
@@ -439,6 +768,21 @@ void GasTransport::setupMM()
         tstar_max = 99.9;
     }
 
+    // use the fits from the cache, if they are available
+    std::string cacheDir = fitCacheDirectory();
+    std::string cacheFile;
+    vector_fp key;
+    if (!cacheDir.empty()) {
+        key = fitCacheKey(tstar_min, tstar_max);
+        cacheFile = fmt::format("{}/transport-fits-{:016x}.bin", cacheDir,
+                                hashValues(key));
+        if (loadFits(cacheFile, key)) {
+            debuglog("*** fits read from " + cacheFile + " ***\n", m_log_level);
+            prepareFits();
+            return;
+        }
+    }
+
     // initialize the collision integral calculator for the desired T* range
     debuglog("*** collision_integrals ***\n", m_log_level);
     MMCollisionInt integrals;
@@ -449,6 +793,153 @@ void GasTransport::setupMM()
     debuglog("*** property fits ***\n", m_log_level);
     fitProperties(integrals);
     debuglog("*** end of property fits ***\n", m_log_level);
+
+    if (!cacheFile.empty()) {
+        saveFits(cacheFile, key);
+    }
+}
+
+void GasTransport::setFitCacheDirectory(const std::string& dir)
+{
+    std::unique_lock<std::mutex> lock(fitCacheMutex);
+    fitCacheDir = dir;
+}
+
+std::string GasTransport::fitCacheDirectory()
+{
+    std::unique_lock<std::mutex> lock(fitCacheMutex);
+    return fitCacheDir;
+}
+
+vector_fp GasTransport::fitCacheKey(doublereal tstar_min, doublereal tstar_max)
+{
+    vector_fp key {static_cast<double>(m_mode), COLL_INT_POLY_DEGREE,
+                   static_cast<double>(nFitPoints), tstar_min, tstar_max,
+                   m_thermo->minTemp(), m_thermo->maxTemp(),
+                   static_cast<double>(m_nsp)};
+    const vector_fp& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        double data[] = {mw[k], m_crot[k], m_sigma[k], m_eps[k],
+                         m_dipole(k,k), m_alpha[k], m_zrot[k]};
+        key.insert(key.end(), data, data + 7);
+    }
+
+    // The conductivity fits depend on the reference-state heat capacities at
+    // the temperatures used by fitProperties
+    double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(nFitPoints-1);
+    vector_fp cp_R(m_nsp);
+    for (size_t n = 0; n < nFitPoints; n++) {
+        m_thermo->setTemperature(m_thermo->minTemp() + dt*n);
+        m_thermo->getCp_R_ref(cp_R.data());
+        key.insert(key.end(), cp_R.begin(), cp_R.end());
+    }
+    return key;
+}
+
+bool GasTransport::loadFits(const std::string& fname, const vector_fp& key)
+{
+    std::ifstream s(fname, std::ios::binary);
+    if (!s) {
+        return false;
+    }
+    char magic[sizeof(fitCacheMagic)];
+    s.read(magic, sizeof(magic));
+    if (!s || !std::equal(magic, magic + sizeof(magic), fitCacheMagic)) {
+        return false;
+    }
+    uint64_t nkey = 0;
+    s.read(reinterpret_cast<char*>(&nkey), sizeof(nkey));
+    if (!s || nkey != key.size()) {
+        return false;
+    }
+    vector_fp fileKey(key.size());
+    s.read(reinterpret_cast<char*>(fileKey.data()), nkey * sizeof(double));
+    if (!s || fileKey != key) {
+        return false;
+    }
+
+    // Read into temporaries, so that nothing is changed if the file is
+    // truncated
+    size_t degree = (m_mode == CK_Mode ? 3 : 4);
+    size_t collDegree = (m_mode == CK_Mode ? 6 : COLL_INT_POLY_DEGREE);
+    std::vector<vector_fp> visc, cond, diff, om22, astar, bstar, cstar;
+    if (!readFits(s, visc, m_nsp, degree + 1) ||
+        !readFits(s, cond, m_nsp, degree + 1) ||
+        !readFits(s, diff, m_nsp * (m_nsp + 1) / 2, degree + 1)) {
+        return false;
+    }
+    uint64_t npoly = 0;
+    s.read(reinterpret_cast<char*>(&npoly), sizeof(npoly));
+    if (!s || npoly == 0 || npoly > m_nsp * (m_nsp + 1) / 2 ||
+        !readFits(s, om22, npoly, collDegree + 1) ||
+        !readFits(s, astar, npoly, collDegree + 1) ||
+        !readFits(s, bstar, npoly, collDegree + 1) ||
+        !readFits(s, cstar, npoly, collDegree + 1)) {
+        return false;
+    }
+    std::vector<vector_int> poly(m_nsp, vector_int(m_nsp));
+    for (size_t i = 0; i < m_nsp; i++) {
+        s.read(reinterpret_cast<char*>(poly[i].data()), m_nsp * sizeof(int));
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (poly[i][j] < 0 || static_cast<uint64_t>(poly[i][j]) >= npoly) {
+                return false;
+            }
+        }
+    }
+    if (!s) {
+        return false;
+    }
+
+    m_visccoeffs.swap(visc);
+    m_condcoeffs.swap(cond);
+    m_diffcoeffs.swap(diff);
+    m_omega22_poly.swap(om22);
+    m_astar_poly.swap(astar);
+    m_bstar_poly.swap(bstar);
+    m_cstar_poly.swap(cstar);
+    m_poly.swap(poly);
+    return true;
+}
+
+void GasTransport::saveFits(const std::string& fname, const vector_fp& key) const
+{
+    // Write to a temporary file which is then renamed, so that other
+    // processes never read a partially written file
+    std::string tmpname = fmt::format("{}.{}.{}.tmp", fname,
+        std::chrono::steady_clock::now().time_since_epoch().count(),
+        static_cast<const void*>(this));
+    {
+        std::ofstream s(tmpname, std::ios::binary);
+        if (!s) {
+            debuglog("*** unable to write " + tmpname + " ***\n", m_log_level);
+            return;
+        }
+        s.write(fitCacheMagic, sizeof(fitCacheMagic));
+        uint64_t n = key.size();
+        s.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        s.write(reinterpret_cast<const char*>(key.data()), n * sizeof(double));
+        writeFits(s, m_visccoeffs);
+        writeFits(s, m_condcoeffs);
+        writeFits(s, m_diffcoeffs);
+        n = m_astar_poly.size();
+        s.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        writeFits(s, m_omega22_poly);
+        writeFits(s, m_astar_poly);
+        writeFits(s, m_bstar_poly);
+        writeFits(s, m_cstar_poly);
+        for (size_t i = 0; i < m_nsp; i++) {
+            s.write(reinterpret_cast<const char*>(m_poly[i].data()),
+                    m_nsp * sizeof(int));
+        }
+        if (!s) {
+            s.close();
+            std::remove(tmpname.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpname.c_str(), fname.c_str()) != 0) {
+        std::remove(tmpname.c_str());
+    }
 }
 
 void GasTransport::getTransportData()
@@ -559,7 +1050,7 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
 {
     int ndeg = 0;
     // number of points to use in generating fit data
-    const size_t np = 50;
+    const size_t np = nFitPoints;
     int degree = (m_mode == CK_Mode ? 3 : 4);
     double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
     vector_fp tlog(np), spvisc(np), spcond(np);
@@ -784,6 +1275,19 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         writelogf("Maximum binary diffusion coefficient relative error:"
                  "%12.6g", mxrelerr);
     }
+
+    prepareFits();
+}
+
+void GasTransport::prepareFits()
+{
+    m_viscFit = transposeFits(m_visccoeffs);
+    m_condFit = transposeFits(m_condcoeffs);
+    m_diffFit = transposeFits(m_diffcoeffs);
+    m_bdiffPairs.resize(m_diffcoeffs.size());
+    if (!m_bdiffTable.empty()) {
+        buildBinaryDiffTable();
+    }
 }
 
 void GasTransport::getBinDiffCorrection(double t, MMCollisionInt& integrals,
@@ -23,13 +23,83 @@ using namespace std;
 namespace Cantera
 {
 
+namespace {
+
+// Constants of the Takahashi correlation at each reduced pressure of the chart
+const size_t nTakahashi = 17;
+const double Pr_lookup[nTakahashi] = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.8, 1.0,
+    1.2, 1.4, 1.6, 1.8, 2.0, 2.5, 3.0, 4.0, 5.0};
+const double DP_Rt_lookup[nTakahashi] = {1.01, 1.01, 1.01, 1.01, 1.01, 1.01,
+    1.01, 1.02, 1.02, 1.02, 1.02, 1.03, 1.03, 1.04, 1.05, 1.06, 1.07};
+const double A_ij_lookup[nTakahashi] = {0.038042, 0.067433, 0.098317,
+    0.137610, 0.175081, 0.216376, 0.314051, 0.385736, 0.514553, 0.599184,
+    0.557725, 0.593007, 0.696001, 0.790770, 0.502100, 0.837452, 0.890390};
+const double B_ij_lookup[nTakahashi] = {1.52267, 2.16794, 2.42910, 2.77605,
+    2.98256, 3.11384, 3.50264, 3.07773, 3.54744, 3.61216, 3.41882, 3.18415,
+    3.37660, 3.27984, 3.39031, 3.23513, 3.13001};
+const double C_ij_lookup[nTakahashi] = {0., 0., 0., 0., 0., 0., 0., 0.141211,
+    0.278407, 0.372683, 0.504894, 0.678469, 0.665702, 0., 0.602907, 0., 0.};
+const double E_ij_lookup[nTakahashi] = {1., 1., 1., 1., 1., 1., 1., 13.45454,
+    14., 10.00900, 8.57519, 10.37483, 11.21674, 1., 6.19043, 1., 1.};
+
+// Range of reduced temperatures covered by the table of correction factors
+const double Tr_table_min = 0.5;
+const double Tr_table_max = 100.0;
+
+// Largest number of intervals in the table of correction factors
+const size_t max_table_intervals = 16384;
+
+// Takahashi correction factor at reduced pressure Pr_lookup[n]
+double takahashiNode(size_t n, double Tr)
+{
+    return DP_Rt_lookup[n]*(1.0 - A_ij_lookup[n]*pow(Tr,-B_ij_lookup[n]))
+        *(1 - C_ij_lookup[n]*pow(Tr,-E_ij_lookup[n]));
+}
+
+// Find the interval of the Takahashi chart containing Pr. Returns the index of
+// the lower node and sets 'frac' to the relative position of Pr within the
+// interval.
+size_t takahashiInterval(double Pr, double& frac)
+{
+    if (Pr < Pr_lookup[0]) {
+        frac = (Pr - Pr_lookup[0])/(Pr_lookup[1] - Pr_lookup[0]);
+        return 0;
+    }
+    for (size_t j = 1; j < nTakahashi; j++) {
+        if (Pr_lookup[j] > Pr) {
+            frac = (Pr - Pr_lookup[j-1])/(Pr_lookup[j] - Pr_lookup[j-1]);
+            return j - 1;
+        }
+    }
+    // If Pr is greater than the greatest value used by Takahashi (5.0), use
+    // the final table value. Should eventually add in an extrapolation:
+    frac = 1.0;
+    return nTakahashi - 2;
+}
+
+}
+
 HighPressureGasTransport::HighPressureGasTransport(thermo_t* thermo)
 : MultiTransport(thermo)
+, m_pcorrLogTrMin(0.0)
+, m_pcorrDlogTr(0.0)
+, m_pcorrNT(0)
+, m_pcorrTableErr(0.0)
 {
 }
 
 double HighPressureGasTransport::thermalConductivity()
 {
+    updateCriticalProperties();
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    doublereal T = m_thermo->temperature();
+    doublereal P = m_thermo->pressure();
+    int iState = m_thermo->stateMFNumber();
+    if (cached.state1 == T && cached.state2 == P && cached.stateNum == iState) {
+        return cached.value;
+    }
+
     //  Method of Ely and Hanley:
     update_T();
     doublereal Lprime_m = 0.0;
@@ -49,8 +119,8 @@ double HighPressureGasTransport::thermalConductivity()
     doublereal L_i_min = BigNumber;
 
     for (size_t i = 0; i < m_nsp; i++) {
-        doublereal Tc_i = Tcrit_i(i);
-        doublereal Vc_i = Vcrit_i(i);
+        doublereal Tc_i = m_Tcrit[i];
+        doublereal Vc_i = m_Vcrit[i];
         doublereal T_r = m_thermo->temperature()/Tc_i;
         doublereal V_r = V_k[i]/Vc_i;
         doublereal T_p = std::min(T_r,2.0);
@@ -60,7 +130,7 @@ double HighPressureGasTransport::thermalConductivity()
         doublereal theta_p = 1.0 + (m_w_ac[i] - 0.011)*(0.56553
             - 0.86276*log(T_p) - 0.69852/T_p);
         doublereal phi_p = (1.0 + (m_w_ac[i] - 0.011)*(0.38560
-            - 1.1617*log(T_p)))*0.288/Zcrit_i(i);
+            - 1.1617*log(T_p)))*0.288/m_Zcrit[i];
         doublereal f_fac = Tc_i*theta_p/190.4;
         doublereal h_fac = 1000*Vc_i*phi_p/99.2;
         doublereal T_0 = m_temp/f_fac;
@@ -76,7 +146,7 @@ double HighPressureGasTransport::thermalConductivity()
         doublereal theta_s = 1 + (m_w_ac[i] - 0.011)*(0.09057 - 0.86276*log(T_p)
             + (0.31664 - 0.46568/T_p)*(V_p - 0.5));
         doublereal phi_s = (1 + (m_w_ac[i] - 0.011)*(0.39490*(V_p - 1.02355)
-            - 0.93281*(V_p - 0.75464)*log(T_p)))*0.288/Zcrit_i(i);
+            - 0.93281*(V_p - 0.75464)*log(T_p)))*0.288/m_Zcrit[i];
         f_i[i] = Tc_i*theta_s/190.4;
         h_i[i] = 1000*Vc_i*phi_s/99.2;
     }
@@ -115,7 +185,11 @@ double HighPressureGasTransport::thermalConductivity()
                 *sqrt(rho_0)*(0.3594685 + 69.79841/T_0 - 872.8833*pow(T_0,-2))) - 1.)*1e-3;
     doublereal H_m = sqrt(f_m*16.04/mw_m)*pow(h_m,-2./3.);
     doublereal Lstar_m = H_m*(L_1m + L_2m + L_3m);
-    return Lprime_m + Lstar_m;
+    cached.value = Lprime_m + Lstar_m;
+    cached.state1 = T;
+    cached.state2 = P;
+    cached.stateNum = iState;
+    return cached.value;
 }
 
 void HighPressureGasTransport::getThermalDiffCoeffs(doublereal* const dt)
@@ -132,56 +206,24 @@ void HighPressureGasTransport::getThermalDiffCoeffs(doublereal* const dt)
 
 void HighPressureGasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
 {
-    doublereal P_corr_ij, Tr_ij, Pr_ij;
-    vector_fp PcP(5);
     size_t nsp = m_thermo->nSpecies();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
-
-    update_T();
-    // Evaluate the binary diffusion coefficients from the polynomial fits.
-    // This should perhaps be preceded by a check to see whether any of T, P, or
-    //   C have changed.
-    //if (!m_bindiff_ok) {
-    updateDiff_T();
-    //}
     if (ld < nsp) {
         throw CanteraError("HighPressureTransport::getBinaryDiffCoeffs()", "ld is too small");
     }
+    const vector_fp& P_corr = pressureCorrections();
+
+    // Evaluate the binary diffusion coefficients from the polynomial fits if
+    // the temperature has changed
+    update_T();
+    if (!m_bindiff_ok) {
+        updateDiff_T();
+    }
     doublereal rp = 1.0/m_thermo->pressure();
     for (size_t i = 0; i < nsp; i++) {
         for (size_t j = 0; j < nsp; j++) {
-            // Add an offset to avoid a condition where x_i and x_j both equal
-            // zero (this would lead to Pr_ij = Inf):
-            doublereal x_i = std::max(Tiny, molefracs[i]);
-            doublereal x_j = std::max(Tiny, molefracs[j]);
-
-            // Weight mole fractions of i and j so that X_i + X_j = 1.0:
-            x_i = x_i/(x_i + x_j);
-            x_j = x_j/(x_i + x_j);
-
-            //Calculate Tr and Pr based on mole-fraction-weighted crit constants:
-            Tr_ij = m_temp/(x_i*Tcrit_i(i) + x_j*Tcrit_i(j));
-            Pr_ij = m_thermo->pressure()/(x_i*Pcrit_i(i) + x_j*Pcrit_i(j));
-
-            if (Pr_ij < 0.1) {
-                // If pressure is low enough, no correction is needed:
-                P_corr_ij = 1;
-            }else {
-                // Otherwise, calculate the parameters for Takahashi correlation
-                // by interpolating on Pr_ij:
-                P_corr_ij = setPcorr(Pr_ij, Tr_ij);
-
-                // If the reduced temperature is too low, the correction factor
-                // P_corr_ij will be < 0:
-                if (P_corr_ij<0) {
-                    P_corr_ij = Tiny;
-                }
-            }
-
             // Multiply the standard low-pressure binary diffusion coefficient
             // (m_bdiff) by the Takahashi correction factor P_corr_ij:
-            d[ld*j + i] = P_corr_ij*rp * m_bdiff(i,j);
+            d[ld*j + i] = P_corr[nsp*j + i]*rp * m_bdiff(i,j);
         }
     }
 }
@@ -204,14 +246,14 @@ void HighPressureGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* c
 
     // Correct the binary diffusion coefficients for high-pressure effects; this
     // is basically the same routine used in 'getBinaryDiffCoeffs,' above:
-    doublereal P_corr_ij, Tr_ij, Pr_ij;
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
     m_thermo->getMoleFractions(&molefracs[0]);
+    const vector_fp& P_corr = pressureCorrections();
     update_T();
-    // Evaluate the binary diffusion coefficients from the polynomial fits -
-    // this should perhaps be preceded by a check for changes in T, P, or C.
-    updateDiff_T();
+    if (!m_bindiff_ok) {
+        updateDiff_T();
+    }
 
     if (ld < m_nsp) {
         throw CanteraError("HighPressureTransport::getMultiDiffCoeffs()",
@@ -219,25 +261,7 @@ void HighPressureGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* c
     }
     for (size_t i = 0; i < m_nsp; i++) {
         for (size_t j = 0; j < m_nsp; j++) {
-            // Add an offset to avoid a condition where x_i and x_j both equal
-            //   zero (this would lead to Pr_ij = Inf):
-            doublereal x_i = std::max(Tiny, molefracs[i]);
-            doublereal x_j = std::max(Tiny, molefracs[j]);
-            x_i = x_i/(x_i+x_j);
-            x_j = x_j/(x_i+x_j);
-            Tr_ij = m_temp/(x_i*Tcrit_i(i) + x_j*Tcrit_i(j));
-            Pr_ij = m_thermo->pressure()/(x_i*Pcrit_i(i) + x_j*Pcrit_i(j));
-
-            if (Pr_ij < 0.1) {
-                P_corr_ij = 1;
-            }else {
-                P_corr_ij = setPcorr(Pr_ij, Tr_ij);
-                if (P_corr_ij<0) {
-                    P_corr_ij = Tiny;
-                }
-            }
-
-            m_bdiff(i,j) *= P_corr_ij;
+            m_bdiff(i,j) *= P_corr[nsp*j + i];
         }
     }
     m_bindiff_ok = false; // m_bdiff is overwritten by the above routine.
@@ -275,6 +299,17 @@ void HighPressureGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* c
 
 doublereal HighPressureGasTransport::viscosity()
 {
+    updateCriticalProperties();
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    doublereal tKelvin = m_thermo->temperature();
+    doublereal pres = m_thermo->pressure();
+    int iState = m_thermo->stateMFNumber();
+    if (cached.state1 == tKelvin && cached.state2 == pres &&
+        cached.stateNum == iState) {
+        return cached.value;
+    }
+
     // Calculate the high-pressure mixture viscosity, based on the Lucas method.
     double Tc_mix = 0.;
     double Pc_mix_n = 0.;
@@ -285,8 +320,6 @@ doublereal HighPressureGasTransport::viscosity()
     double MW_L = m_mw[0];
     doublereal FP_mix_o = 0;
     doublereal FQ_mix_o = 0;
-    doublereal tKelvin = m_thermo->temperature();
-    double Pvp_mix = m_thermo->satPressure(tKelvin);
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
     m_thermo->getMoleFractions(&molefracs[0]);
@@ -295,12 +328,12 @@ doublereal HighPressureGasTransport::viscosity()
     for (size_t i = 0; i < m_nsp; i++) {
         // Calculate pure-species critical constants and add their contribution
         // to the mole-fraction-weighted mixture averages:
-        Tc = Tcrit_i(i);
+        Tc = m_Tcrit[i];
         Tr = tKelvin/Tc;
-        Zc = Zcrit_i(i);
+        Zc = m_Zcrit[i];
         Tc_mix += Tc*molefracs[i];
         Pc_mix_n += molefracs[i]*Zc; //numerator
-        Pc_mix_d += molefracs[i]*Vcrit_i(i); //denominator
+        Pc_mix_d += molefracs[i]*m_Vcrit[i]; //denominator
 
         // Need to calculate ratio of heaviest to lightest species:
         if (m_mw[i] > MW_H) {
@@ -311,7 +344,7 @@ doublereal HighPressureGasTransport::viscosity()
 
         // Calculate reduced dipole moment for polar correction term:
         doublereal mu_ri = 52.46*100000*m_dipole(i,i)*m_dipole(i,i)
-            *Pcrit_i(i)/(Tc*Tc);
+            *m_Pcrit[i]/(Tc*Tc);
         if (mu_ri < 0.022) {
             FP_mix_o += molefracs[i];
         } else if (mu_ri < 0.075) {
@@ -320,18 +353,10 @@ doublereal HighPressureGasTransport::viscosity()
                                     *fabs(0.96 + 0.1*(Tr - 0.7)));
         }
 
-        // Calculate contribution to quantum correction term.
-        // SCD Note:  This assumes the species of interest (He, H2, and D2) have
-        //   been named in this specific way.  They are perhaps the most obvious
-        //   names, butit would of course be preferred to have a more general
-        //   approach, here.
-        std::vector<std::string> spnames = m_thermo->speciesNames();
-        if (spnames[i] == "He") {
-            FQ_mix_o += molefracs[i]*FQ_i(1.38,Tr,m_mw[i]);
-        } else if (spnames[i] == "H2") {
-            FQ_mix_o += molefracs[i]*(FQ_i(0.76,Tr,m_mw[i]));
-        } else if (spnames[i] == "D2") {
-            FQ_mix_o += molefracs[i]*(FQ_i(0.52,Tr,m_mw[i]));
+        // Calculate contribution to quantum correction term (see
+        // updateCriticalProperties):
+        if (m_quantumQ[i] != 0.0) {
+            FQ_mix_o += molefracs[i]*FQ_i(m_quantumQ[i],Tr,m_mw[i]);
         } else {
             FQ_mix_o += molefracs[i];
         }
@@ -339,7 +364,7 @@ doublereal HighPressureGasTransport::viscosity()
 
     double Tr_mix = tKelvin/Tc_mix;
     double Pc_mix = GasConstant*Tc_mix*Pc_mix_n/Pc_mix_d;
-    double Pr_mix = m_thermo->pressure()/Pc_mix;
+    double Pr_mix = pres/Pc_mix;
     double ratio = MW_H/MW_L;
     double ksi = pow(GasConstant*Tc_mix*3.6277*pow(10.0,53.0)/(pow(MW_mix,3)
                         *pow(Pc_mix,4)),1.0/6.0);
@@ -357,6 +382,9 @@ doublereal HighPressureGasTransport::viscosity()
 
     // Calculate Z2m:
     if (Tr_mix <= 1.0) {
+        // The saturation pressure is only needed (and only evaluated) below
+        // the pseudo-critical temperature of the mixture
+        double Pvp_mix = m_thermo->satPressure(tKelvin);
         if (Pr_mix < Pvp_mix/Pc_mix) {
             doublereal alpha = 3.262 + 14.98*pow(Pr_mix,5.508);
             doublereal beta = 1.390 + 5.746*Pr_mix;
@@ -388,9 +416,228 @@ doublereal HighPressureGasTransport::viscosity()
     // Calculate Y:
     doublereal Y = Z2m/Z1m;
 
-    // Return the viscosity:
-    return Z2m*(1 + (FP_mix_o - 1)*pow(Y,-3))*(1 + (FQ_mix_o - 1)
+    // Store and return the viscosity:
+    cached.value = Z2m*(1 + (FP_mix_o - 1)*pow(Y,-3))*(1 + (FQ_mix_o - 1)
             *(1/Y - 0.007*pow(log(Y),4)))/(ksi*FP_mix_o*FQ_mix_o);
+    cached.state1 = tKelvin;
+    cached.state2 = pres;
+    cached.stateNum = iState;
+    return cached.value;
+}
+
+void HighPressureGasTransport::getHighPressureProperties(size_t npoints,
+        const doublereal* T, const doublereal* P, const doublereal* X,
+        doublereal* visc, doublereal* cond, doublereal* bdiff)
+{
+    vector_fp state;
+    m_thermo->saveState(state);
+    try {
+        for (size_t i = 0; i < npoints; i++) {
+            const doublereal* x = X + i*m_nsp;
+            if (i > 0 && std::equal(x, x + m_nsp, x - m_nsp)) {
+                // Leave the composition (and the stateMFNumber) unchanged
+                m_thermo->setState_TP(T[i], P[i]);
+            } else {
+                m_thermo->setState_TPX(T[i], P[i], x);
+            }
+            if (visc) {
+                visc[i] = viscosity();
+            }
+            if (cond) {
+                cond[i] = thermalConductivity();
+            }
+            if (bdiff) {
+                getBinaryDiffCoeffs(m_nsp, bdiff + i*m_nsp*m_nsp);
+            }
+        }
+    } catch (...) {
+        m_thermo->restoreState(state);
+        throw;
+    }
+    m_thermo->restoreState(state);
+}
+
+void HighPressureGasTransport::updateCriticalProperties()
+{
+    if (m_Tcrit.size() == m_nsp) {
+        return;
+    }
+    vector_fp Tc(m_nsp), Pc(m_nsp), Vc(m_nsp), Zc(m_nsp);
+    for (size_t i = 0; i < m_nsp; i++) {
+        Tc[i] = Tcrit_i(i);
+        Pc[i] = Pcrit_i(i);
+        Vc[i] = Vcrit_i(i);
+        Zc[i] = Zcrit_i(i);
+    }
+
+    // Quantum parameters for the viscosity correction.
+    // SCD Note:  This assumes the species of interest (He, H2, and D2) have
+    //   been named in this specific way.  They are perhaps the most obvious
+    //   names, butit would of course be preferred to have a more general
+    //   approach, here.
+    m_quantumQ.assign(m_nsp, 0.0);
+    for (size_t i = 0; i < m_nsp; i++) {
+        const std::string& name = m_thermo->speciesName(i);
+        if (name == "He") {
+            m_quantumQ[i] = 1.38;
+        } else if (name == "H2") {
+            m_quantumQ[i] = 0.76;
+        } else if (name == "D2") {
+            m_quantumQ[i] = 0.52;
+        }
+    }
+    m_Tcrit.swap(Tc);
+    m_Pcrit.swap(Pc);
+    m_Vcrit.swap(Vc);
+    m_Zcrit.swap(Zc);
+}
+
+const vector_fp& HighPressureGasTransport::pairCriticalProperties()
+{
+    updateCriticalProperties();
+    static const int cacheId = m_cache.getId();
+    CachedArray cached = m_cache.getArray(cacheId);
+    if (cached.validate(m_thermo->stateMFNumber())) {
+        return cached.value;
+    }
+
+    size_t nsp = m_nsp;
+    vector_fp& crit = cached.value;
+    crit.resize(2*nsp*nsp);
+    vector_fp molefracs(nsp);
+    m_thermo->getMoleFractions(&molefracs[0]);
+    for (size_t i = 0; i < nsp; i++) {
+        for (size_t j = 0; j < nsp; j++) {
+            // Add an offset to avoid a condition where x_i and x_j both equal
+            // zero (this would lead to Pr_ij = Inf):
+            doublereal x_i = std::max(Tiny, molefracs[i]);
+            doublereal x_j = std::max(Tiny, molefracs[j]);
+
+            // Weight mole fractions of i and j so that X_i + X_j = 1.0:
+            x_i = x_i/(x_i + x_j);
+            x_j = x_j/(x_i + x_j);
+
+            // Mole-fraction-weighted critical constants:
+            crit[nsp*j + i] = x_i*m_Tcrit[i] + x_j*m_Tcrit[j];
+            crit[nsp*nsp + nsp*j + i] = x_i*m_Pcrit[i] + x_j*m_Pcrit[j];
+        }
+    }
+    return cached.value;
+}
+
+const vector_fp& HighPressureGasTransport::pressureCorrections()
+{
+    const vector_fp& crit = pairCriticalProperties();
+    static const int cacheId = m_cache.getId();
+    CachedArray cached = m_cache.getArray(cacheId);
+    doublereal T = m_thermo->temperature();
+    doublereal P = m_thermo->pressure();
+    if (cached.validate(T, P, m_thermo->stateMFNumber())) {
+        return cached.value;
+    }
+
+    size_t nsp = m_nsp;
+    vector_fp& P_corr = cached.value;
+    P_corr.resize(nsp*nsp);
+    for (size_t n = 0; n < nsp*nsp; n++) {
+        //Calculate Tr and Pr based on mole-fraction-weighted crit constants:
+        doublereal Tr_ij = T/crit[n];
+        doublereal Pr_ij = P/crit[nsp*nsp + n];
+
+        if (Pr_ij < 0.1) {
+            // If pressure is low enough, no correction is needed:
+            P_corr[n] = 1;
+        } else {
+            // Otherwise, calculate the parameters for Takahashi correlation
+            // by interpolating on Pr_ij:
+            P_corr[n] = correctionFactor(Pr_ij, Tr_ij);
+
+            // If the reduced temperature is too low, the correction factor
+            // P_corr_ij will be < 0:
+            if (P_corr[n] < 0) {
+                P_corr[n] = Tiny;
+            }
+        }
+    }
+    return cached.value;
+}
+
+doublereal HighPressureGasTransport::correctionFactor(doublereal Pr,
+                                                      doublereal Tr)
+{
+    if (m_pcorrTable.empty() || Tr < Tr_table_min || Tr > Tr_table_max) {
+        return setPcorr(Pr, Tr);
+    }
+    double frac;
+    size_t n = takahashiInterval(Pr, frac);
+
+    // Linear interpolation in ln(Tr) between the table nodes
+    double u = (log(Tr) - m_pcorrLogTrMin)/m_pcorrDlogTr;
+    size_t k = std::min(static_cast<size_t>(u), m_pcorrNT - 1);
+    u -= k;
+    const double* g0 = &m_pcorrTable[k*nTakahashi];
+    const double* g1 = g0 + nTakahashi;
+    doublereal P_corr_1 = (1.0 - u)*g0[n] + u*g1[n];
+    doublereal P_corr_2 = (1.0 - u)*g0[n+1] + u*g1[n+1];
+    return P_corr_1*(1.0-frac) + P_corr_2*frac;
+}
+
+void HighPressureGasTransport::useCorrectionTable(bool flag, doublereal rtol)
+{
+    if (flag) {
+        if (rtol <= 0.0) {
+            throw CanteraError("HighPressureGasTransport::useCorrectionTable",
+                               "Tolerance must be positive; got {}", rtol);
+        }
+        buildCorrectionTable(rtol);
+    } else {
+        m_pcorrTable.clear();
+        m_pcorrNT = 0;
+        m_pcorrTableErr = 0.0;
+    }
+    // Correction factors and properties computed with the previous setting
+    // are no longer valid
+    m_cache.clear();
+}
+
+void HighPressureGasTransport::buildCorrectionTable(doublereal rtol)
+{
+    double lnTrMin = log(Tr_table_min);
+    double lnTrMax = log(Tr_table_max);
+    vector_fp table;
+    double err = 0.0;
+    size_t nt = 16;
+    while (true) {
+        double dlnTr = (lnTrMax - lnTrMin)/nt;
+        table.resize((nt + 1)*nTakahashi);
+        for (size_t k = 0; k <= nt; k++) {
+            double Tr = exp(lnTrMin + k*dlnTr);
+            for (size_t n = 0; n < nTakahashi; n++) {
+                table[k*nTakahashi + n] = takahashiNode(n, Tr);
+            }
+        }
+
+        // Check the interpolation error at the midpoint of each interval
+        err = 0.0;
+        for (size_t k = 0; k < nt; k++) {
+            double Tr = exp(lnTrMin + (k + 0.5)*dlnTr);
+            for (size_t n = 0; n < nTakahashi; n++) {
+                double g = takahashiNode(n, Tr);
+                double gi = 0.5*(table[k*nTakahashi + n]
+                                 + table[(k+1)*nTakahashi + n]);
+                err = std::max(err, fabs(gi - g)/std::max(fabs(g), 1.0));
+            }
+        }
+        if (err < rtol || nt >= max_table_intervals) {
+            m_pcorrLogTrMin = lnTrMin;
+            m_pcorrDlogTr = dlnTr;
+            m_pcorrNT = nt;
+            break;
+        }
+        nt *= 2;
+    }
+    m_pcorrTable.swap(table);
+    m_pcorrTableErr = err;
 }
 
 // Pure species critical properties - Tc, Pc, Vc, Zc:
@@ -468,48 +715,12 @@ doublereal HighPressureGasTransport::FQ_i(doublereal Q, doublereal Tr, doublerea
 //   table of constants vs. Pr:
 doublereal HighPressureGasTransport::setPcorr(doublereal Pr, doublereal Tr)
 {
-    const static double Pr_lookup[17] = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.8, 1.0,
-        1.2, 1.4, 1.6, 1.8, 2.0, 2.5, 3.0, 4.0, 5.0};
-    const static double DP_Rt_lookup[17] = {1.01, 1.01, 1.01, 1.01, 1.01, 1.01,
-        1.01, 1.02, 1.02, 1.02, 1.02, 1.03, 1.03, 1.04, 1.05, 1.06, 1.07};
-    const static double A_ij_lookup[17] = {0.038042, 0.067433, 0.098317,
-        0.137610, 0.175081, 0.216376, 0.314051, 0.385736, 0.514553, 0.599184,
-        0.557725, 0.593007, 0.696001, 0.790770, 0.502100, 0.837452, 0.890390};
-    const static double B_ij_lookup[17] = {1.52267, 2.16794, 2.42910, 2.77605,
-        2.98256, 3.11384, 3.50264, 3.07773, 3.54744, 3.61216, 3.41882, 3.18415,
-        3.37660, 3.27984, 3.39031, 3.23513, 3.13001};
-    const static double C_ij_lookup[17] = {0., 0., 0., 0., 0., 0., 0., 0.141211,
-        0.278407, 0.372683, 0.504894, 0.678469, 0.665702, 0., 0.602907, 0., 0.};
-    const static double E_ij_lookup[17] = {1., 1., 1., 1., 1., 1., 1., 13.45454,
-        14., 10.00900, 8.57519, 10.37483, 11.21674, 1., 6.19043, 1., 1.};
-
     // Interpolate Pr vs. those used in Takahashi table:
-    int Pr_i = 0;
-    double frac = 0.;
-
-    if (Pr < 0.1) {
-        frac = (Pr - Pr_lookup[0])/(Pr_lookup[1] - Pr_lookup[0]);
-    } else {
-        for (int j = 1; j < 17; j++) {
-            if (Pr_lookup[j] > Pr) {
-                frac = (Pr - Pr_lookup[j-1])/(Pr_lookup[j] - Pr_lookup[j-1]);
-                break;
-            }
-            Pr_i++;
-        }
-    }
-    // If Pr is greater than the greatest value used by Takahashi (5.0), use the
-    //   final table value.  Should eventually add in an extrapolation:
-    if (Pr_i == 17) {
-        frac = 1.0;
-    }
+    double frac;
+    size_t Pr_i = takahashiInterval(Pr, frac);
 
-    doublereal P_corr_1 = DP_Rt_lookup[Pr_i]*(1.0 - A_ij_lookup[Pr_i]
-        *pow(Tr,-B_ij_lookup[Pr_i]))*(1-C_ij_lookup[Pr_i]
-        *pow(Tr,-E_ij_lookup[Pr_i]));
-    doublereal P_corr_2 = DP_Rt_lookup[Pr_i+1]*(1.0 - A_ij_lookup[Pr_i+1]
-        *pow(Tr,-B_ij_lookup[Pr_i+1]))*(1-C_ij_lookup[Pr_i+1]
-        *pow(Tr,-E_ij_lookup[Pr_i+1]));
+    doublereal P_corr_1 = takahashiNode(Pr_i, Tr);
+    doublereal P_corr_2 = takahashiNode(Pr_i+1, Tr);
     return P_corr_1*(1.0-frac) + P_corr_2*frac;
 }
 
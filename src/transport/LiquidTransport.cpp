@@ -21,6 +21,7 @@ LiquidTransport::LiquidTransport(thermo_t* thermo, int ndim) :
     concTot_(0.0),
     concTot_tran_(0.0),
     dens_(0.0),
+    m_velocityBasis_A(VB_MASSAVG),
     m_temp(-1.0),
     m_press(-1.0),
     m_lambda(-1.0),
@@ -62,6 +63,7 @@ LiquidTransport::LiquidTransport(const LiquidTransport& right) :
     concTot_(0.0),
     concTot_tran_(0.0),
     dens_(0.0),
+    m_velocityBasis_A(VB_MASSAVG),
     m_temp(-1.0),
     m_press(-1.0),
     m_lambda(-1.0),
@@ -140,6 +142,7 @@ LiquidTransport& LiquidTransport::operator=(const LiquidTransport& right)
     m_chargeSpecies = right.m_chargeSpecies;
     m_B = right.m_B;
     m_A = right.m_A;
+    m_velocityBasis_A = right.m_velocityBasis_A;
     m_temp = right.m_temp;
     m_press = right.m_press;
     m_flux = right.m_flux;
@@ -380,6 +383,7 @@ doublereal LiquidTransport::viscosity()
     }
     ////// LiquidTranInteraction method
     m_viscmix = m_viscMixModel->getMixTransProp(m_viscTempDep_Ns);
+    m_visc_mix_ok = true;
     return m_viscmix;
 }
 
@@ -401,6 +405,7 @@ doublereal LiquidTransport::ionConductivity()
     }
     ////// LiquidTranInteraction method
     m_ionCondmix = m_ionCondMixModel->getMixTransProp(m_ionCondTempDep_Ns);
+    m_ionCond_mix_ok = true;
     return m_ionCondmix;
 }
 
@@ -427,6 +432,7 @@ void LiquidTransport::mobilityRatio(doublereal* mobRat)
                 }
             }
         }
+        m_mobRat_mix_ok = true;
     }
     for (size_t k = 0; k < m_nsp2; k++) {
         mobRat[k] = m_mobRatMix[k];
@@ -454,6 +460,7 @@ void LiquidTransport::selfDiffusion(doublereal* const selfDiff)
         for (size_t k = 0; k < m_nsp; k++) {
             m_selfDiffMix[k] = m_selfDiffMixModel[k]->getMixTransProp(m_selfDiffTempDep_Ns[k]);
         }
+        m_selfDiff_mix_ok = true;
     }
     for (size_t k = 0; k < m_nsp; k++) {
         selfDiff[k] = m_selfDiffMix[k];
@@ -488,7 +495,7 @@ doublereal LiquidTransport::thermalConductivity()
     update_C();
     if (!m_lambda_mix_ok) {
         m_lambda = m_lambdaMixModel->getMixTransProp(m_lambdaTempDep_Ns);
-        m_cond_mix_ok = true;
+        m_lambda_mix_ok = true;
     }
     return m_lambda;
 }
@@ -686,6 +693,30 @@ void LiquidTransport::getSpeciesFluxesExt(size_t ldf, doublereal* fluxes)
     }
 }
 
+void LiquidTransport::getSpeciesFluxesESMulti(size_t npoints,
+        const doublereal* T, const doublereal* P, const doublereal* X,
+        const doublereal* grad_T, const doublereal* grad_X,
+        const doublereal* grad_Phi, doublereal* fluxes)
+{
+    size_t nd = m_nDim;
+    size_t nsd = m_nsp * m_nDim;
+    vector_fp state;
+    m_thermo->saveState(state);
+    try {
+        for (size_t n = 0; n < npoints; n++) {
+            m_thermo->setState_TPX(T[n], P[n], X + n*m_nsp);
+            set_Grad_T(grad_T + n*nd);
+            set_Grad_X(grad_X + n*nsd);
+            set_Grad_V(grad_Phi + n*nd);
+            getSpeciesFluxesExt(m_nsp, fluxes + n*nsd);
+        }
+    } catch (...) {
+        m_thermo->restoreState(state);
+        throw;
+    }
+    m_thermo->restoreState(state);
+}
+
 void LiquidTransport::getMixDiffCoeffs(doublereal* const d)
 {
     stefan_maxwell_solve();
@@ -903,16 +934,62 @@ void LiquidTransport::update_Grad_lnAC()
     return;
 }
 
+void LiquidTransport::updateStefanMaxwellMatrix()
+{
+    if (m_diff_mix_ok && m_velocityBasis == m_velocityBasis_A) {
+        return;
+    }
+    m_A.resize(m_nsp, m_nsp, 0.0);
+
+    // Just for Note, m_A(i,j) refers to the ith row and jth column.
+    // They are still fortran ordered, so that i varies fastest.
+
+    // equation for the reference velocity
+    for (size_t j = 0; j < m_nsp; j++) {
+        if (m_velocityBasis == VB_MOLEAVG) {
+            m_A(0,j) = m_molefracs_tran[j];
+        } else if (m_velocityBasis == VB_MASSAVG) {
+            m_A(0,j) = m_massfracs_tran[j];
+        } else if ((m_velocityBasis >= 0)
+                   && (m_velocityBasis < static_cast<int>(m_nsp))) {
+            // use species number m_velocityBasis as reference velocity
+            if (m_velocityBasis == static_cast<int>(j)) {
+                m_A(0,j) = 1.0;
+            } else {
+                m_A(0,j) = 0.0;
+            }
+        } else {
+            throw CanteraError("LiquidTransport::stefan_maxwell_solve",
+                               "Unknown reference velocity provided.");
+        }
+    }
+    for (size_t i = 1; i < m_nsp; i++) {
+        m_A(i,i) = 0.0;
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (j != i) {
+                doublereal tmp = m_molefracs_tran[j] * m_bdiff(i,j);
+                m_A(i,i) -= tmp;
+                m_A(i,j) = tmp;
+            }
+        }
+    }
+
+    // The LU factorization is reused for all right-hand sides at this state
+    m_A.factor();
+    m_velocityBasis_A = m_velocityBasis;
+    m_diff_mix_ok = true;
+}
+
 void LiquidTransport::stefan_maxwell_solve()
 {
-    doublereal tmp;
+    if (m_nDim < 1 || m_nDim > 3) {
+        throw CanteraError("LiquidTransport::stefan_maxwell_solve",
+                           "not done for {} dimensions", m_nDim);
+    }
     m_B.resize(m_nsp, m_nDim, 0.0);
-    m_A.resize(m_nsp, m_nsp, 0.0);
 
     //! grab a local copy of the molecular weights
     const vector_fp& M = m_thermo->molecularWeights();
-    //! grad a local copy of the ion molar volume (inverse total ion concentration)
-    const doublereal vol = m_thermo->molarVolume();
 
     //! Update the temperature, concentrations and diffusion coefficients in the
     //! mixture.
@@ -921,10 +998,10 @@ void LiquidTransport::stefan_maxwell_solve()
     if (!m_diff_temp_ok) {
         updateDiff_T();
     }
+    updateStefanMaxwellMatrix();
 
     double T = m_thermo->temperature();
     update_Grad_lnAC();
-    m_thermo->getActivityCoefficients(m_actCoeff.data());
 
     /*
      *  Calculate the electrochemical potential gradient. This is the
@@ -971,133 +1048,19 @@ void LiquidTransport::stefan_maxwell_solve()
         }
     }
 
-    // Just for Note, m_A(i,j) refers to the ith row and jth column.
-    // They are still fortran ordered, so that i varies fastest.
-    double condSum1;
+    // One right-hand side for each spatial dimension. The first equation is
+    // the definition of the reference velocity.
     const doublereal invRT = 1.0 / (GasConstant * T);
-    switch (m_nDim) {
-    case 1: // 1-D approximation
-        m_B(0,0) = 0.0;
-        // equation for the reference velocity
-        for (size_t j = 0; j < m_nsp; j++) {
-            if (m_velocityBasis == VB_MOLEAVG) {
-                m_A(0,j) = m_molefracs_tran[j];
-            } else if (m_velocityBasis == VB_MASSAVG) {
-                m_A(0,j) = m_massfracs_tran[j];
-            } else if ((m_velocityBasis >= 0)
-                       && (m_velocityBasis < static_cast<int>(m_nsp))) {
-                // use species number m_velocityBasis as reference velocity
-                if (m_velocityBasis == static_cast<int>(j)) {
-                    m_A(0,j) = 1.0;
-                } else {
-                    m_A(0,j) = 0.0;
-                }
-            } else {
-                throw CanteraError("LiquidTransport::stefan_maxwell_solve",
-                                   "Unknown reference velocity provided.");
-            }
-        }
-        for (size_t i = 1; i < m_nsp; i++) {
-            m_B(i,0) = m_Grad_mu[i] * invRT;
-            m_A(i,i) = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != i) {
-                    tmp = m_molefracs_tran[j] * m_bdiff(i,j);
-                    m_A(i,i) -= tmp;
-                    m_A(i,j) = tmp;
-                }
-            }
-        }
-
-        // invert and solve the system  Ax = b. Answer is in m_B
-        solve(m_A, m_B);
-        condSum1 = 0;
-        for (size_t i = 0; i < m_nsp; i++) {
-            condSum1 -= Faraday*m_chargeSpecies[i]*m_B(i,0)*m_molefracs_tran[i]/vol;
-        }
-        break;
-    case 2: // 2-D approximation
-        m_B(0,0) = 0.0;
-        m_B(0,1) = 0.0;
-        //equation for the reference velocity
-        for (size_t j = 0; j < m_nsp; j++) {
-            if (m_velocityBasis == VB_MOLEAVG) {
-                m_A(0,j) = m_molefracs_tran[j];
-            } else if (m_velocityBasis == VB_MASSAVG) {
-                m_A(0,j) = m_massfracs_tran[j];
-            } else if ((m_velocityBasis >= 0)
-                       && (m_velocityBasis < static_cast<int>(m_nsp))) {
-                // use species number m_velocityBasis as reference velocity
-                if (m_velocityBasis == static_cast<int>(j)) {
-                    m_A(0,j) = 1.0;
-                } else {
-                    m_A(0,j) = 0.0;
-                }
-            } else {
-                throw CanteraError("LiquidTransport::stefan_maxwell_solve",
-                                   "Unknown reference velocity provided.");
-            }
-        }
-        for (size_t i = 1; i < m_nsp; i++) {
-            m_B(i,0) = m_Grad_mu[i] * invRT;
-            m_B(i,1) = m_Grad_mu[m_nsp + i] * invRT;
-            m_A(i,i) = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != i) {
-                    tmp = m_molefracs_tran[j] * m_bdiff(i,j);
-                    m_A(i,i) -= tmp;
-                    m_A(i,j) = tmp;
-                }
-            }
-        }
-
-        // invert and solve the system  Ax = b. Answer is in m_B
-        solve(m_A, m_B);
-        break;
-    case 3: // 3-D approximation
-        m_B(0,0) = 0.0;
-        m_B(0,1) = 0.0;
-        m_B(0,2) = 0.0;
-        // equation for the reference velocity
-        for (size_t j = 0; j < m_nsp; j++) {
-            if (m_velocityBasis == VB_MOLEAVG) {
-                m_A(0,j) = m_molefracs_tran[j];
-            } else if (m_velocityBasis == VB_MASSAVG) {
-                m_A(0,j) = m_massfracs_tran[j];
-            } else if ((m_velocityBasis >= 0)
-                       && (m_velocityBasis < static_cast<int>(m_nsp))) {
-                // use species number m_velocityBasis as reference velocity
-                if (m_velocityBasis == static_cast<int>(j)) {
-                    m_A(0,j) = 1.0;
-                } else {
-                    m_A(0,j) = 0.0;
-                }
-            } else {
-                throw CanteraError("LiquidTransport::stefan_maxwell_solve",
-                                   "Unknown reference velocity provided.");
-            }
-        }
+    for (size_t a = 0; a < m_nDim; a++) {
+        m_B(0,a) = 0.0;
         for (size_t i = 1; i < m_nsp; i++) {
-            m_B(i,0) = m_Grad_mu[i] * invRT;
-            m_B(i,1) = m_Grad_mu[m_nsp + i] * invRT;
-            m_B(i,2) = m_Grad_mu[2*m_nsp + i] * invRT;
-            m_A(i,i) = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != i) {
-                    tmp = m_molefracs_tran[j] * m_bdiff(i,j);
-                    m_A(i,i) -= tmp;
-                    m_A(i,j) = tmp;
-                }
-            }
+            m_B(i,a) = m_Grad_mu[a*m_nsp + i] * invRT;
         }
-
-        // invert and solve the system  Ax = b. Answer is in m_B
-        solve(m_A, m_B);
-        break;
-    default:
-        throw CanteraError("routine", "not done");
     }
 
+    // solve the system  Ax = b using the factored matrix. Answer is in m_B
+    m_A.solve(m_B.ptrColumn(0), m_nDim, m_nsp);
+
     for (size_t a = 0; a < m_nDim; a++) {
         for (size_t j = 0; j < m_nsp; j++) {
             m_Vdiff(j,a) = m_B(j,a);
@@ -15,6 +15,7 @@ MixTransport::MixTransport() :
     m_lambda(0.0),
     m_spcond_ok(false),
     m_condmix_ok(false),
+    m_iStateMF(-1),
     m_debug(false)
 {
 }
@@ -24,6 +25,7 @@ MixTransport::MixTransport(const MixTransport& right) :
     m_lambda(0.0),
     m_spcond_ok(false),
     m_condmix_ok(false),
+    m_iStateMF(-1),
     m_debug(false)
 {
     *this = right;
@@ -40,6 +42,7 @@ MixTransport& MixTransport::operator=(const MixTransport& right)
     m_lambda = right.m_lambda;
     m_spcond_ok = right.m_spcond_ok;
     m_condmix_ok = right.m_condmix_ok;
+    m_iStateMF = -1;
     m_debug = right.m_debug;
 
     return *this;
@@ -58,6 +61,7 @@ void MixTransport::init(ThermoPhase* thermo, int mode, int log_level)
     // set flags all false
     m_spcond_ok = false;
     m_condmix_ok = false;
+    m_iStateMF = -1;
 }
 
 void MixTransport::getMobilities(doublereal* const mobil)
@@ -73,6 +77,11 @@ doublereal MixTransport::thermalConductivity()
 {
     update_T();
     update_C();
+    return evalThermalConductivity();
+}
+
+doublereal MixTransport::evalThermalConductivity()
+{
     if (!m_spcond_ok) {
         updateCond_T();
     }
@@ -89,6 +98,11 @@ doublereal MixTransport::thermalConductivity()
 }
 
 void MixTransport::getThermalDiffCoeffs(doublereal* const dt)
+{
+    evalThermalDiffCoeffs(dt);
+}
+
+void MixTransport::evalThermalDiffCoeffs(doublereal* const dt)
 {
     for (size_t k = 0; k < m_nsp; k++) {
         dt[k] = 0.0;
@@ -120,17 +134,16 @@ void MixTransport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_T,
     }
 }
 
-void MixTransport::update_T()
+void MixTransport::updateTemperature(doublereal T)
 {
-    doublereal t = m_thermo->temperature();
-    if (t == m_temp) {
+    if (T == m_temp) {
         return;
     }
-    if (t < 0.0) {
-        throw CanteraError("MixTransport::update_T",
-                           "negative temperature {}", t);
+    if (T < 0.0) {
+        throw CanteraError("MixTransport::updateTemperature",
+                           "negative temperature {}", T);
     }
-    GasTransport::update_T();
+    GasTransport::updateTemperature(T);
     // temperature has changed, so polynomial fits will need to be redone.
     m_spcond_ok = false;
     m_bindiff_ok = false;
@@ -139,27 +152,37 @@ void MixTransport::update_T()
 
 void MixTransport::update_C()
 {
-    // signal that concentration-dependent quantities will need to be recomputed
-    // before use, and update the local mole fractions.
-    m_visc_ok = false;
-    m_condmix_ok = false;
+    // Nothing depends on the composition if it hasn't changed since the last
+    // call
+    int iStateNew = m_thermo->stateMFNumber();
+    if (iStateNew == m_iStateMF) {
+        return;
+    }
     m_thermo->getMoleFractions(m_molefracs.data());
+    updateMoleFractions(m_molefracs.data());
+    m_iStateMF = iStateNew;
+}
 
-    // add an offset to avoid a pure species condition
-    for (size_t k = 0; k < m_nsp; k++) {
-        m_molefracs[k] = std::max(Tiny, m_molefracs[k]);
-    }
+void MixTransport::updateMoleFractions(const doublereal* const x)
+{
+    // signal that concentration-dependent quantities will need to be recomputed
+    // before use, and that the local mole fractions may no longer match the
+    // phase.
+    GasTransport::updateMoleFractions(x);
+    m_condmix_ok = false;
+    m_iStateMF = -1;
 }
 
 void MixTransport::updateCond_T()
 {
+    evalPolyFits(m_condFit, m_nsp, m_logt, m_cond.data());
     if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = exp(dot4(m_polytempvec, m_condcoeffs[k]));
+            m_cond[k] = exp(m_cond[k]);
         }
     } else {
         for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = m_sqrt_t * dot5(m_polytempvec, m_condcoeffs[k]);
+            m_cond[k] *= m_sqrt_t;
         }
     }
     m_spcond_ok = true;
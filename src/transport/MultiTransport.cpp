@@ -32,10 +32,123 @@ doublereal Frot(doublereal tr, doublereal sqtr)
     return 1.0 + c1*sqtr + c2*tr + c3*sqtr*tr;
 }
 
+/**
+ * Solve A x = b using GMRES, with right preconditioning by the LU
+ * factorization P of a matrix close to A.
+ *
+ * @param A      Matrix of the system
+ * @param P      Factored preconditioner matrix
+ * @param b      Right-hand side
+ * @param x      On input, the initial estimate of the solution. On output,
+ *               the improved estimate.
+ * @param rtol   Required reduction of the residual norm relative to |b|
+ * @param maxit  Maximum number of iterations
+ * @returns true if the iterations converged
+ */
+static bool gmresSolve(const DenseMatrix& A, SquareMatrix& P,
+                       const vector_fp& b, vector_fp& x,
+                       doublereal rtol, size_t maxit)
+{
+    size_t n = b.size();
+    vector_fp r(n), z(n);
+    multiply(A, x.data(), r.data());
+    for (size_t i = 0; i < n; i++) {
+        r[i] = b[i] - r[i];
+    }
+    doublereal tol = rtol * sqrt(dot(b.begin(), b.end(), b.begin()));
+    doublereal beta = sqrt(dot(r.begin(), r.end(), r.begin()));
+    if (beta <= tol) {
+        return true;
+    }
+
+    // Krylov basis vectors, Hessenberg matrix and Givens rotations
+    DenseMatrix V(n, maxit + 1);
+    DenseMatrix H(maxit + 1, maxit);
+    vector_fp cs(maxit), sn(maxit), g(maxit + 1, 0.0);
+    g[0] = beta;
+    for (size_t i = 0; i < n; i++) {
+        V(i,0) = r[i] / beta;
+    }
+
+    size_t m = 0;
+    bool converged = false;
+    for (size_t j = 0; j < maxit; j++) {
+        // z = A P^-1 v_j
+        copy(V.ptrColumn(j), V.ptrColumn(j) + n, r.begin());
+        if (P.solve(r.data())) {
+            return false;
+        }
+        multiply(A, r.data(), z.data());
+
+        // modified Gram-Schmidt orthogonalization
+        for (size_t i = 0; i <= j; i++) {
+            H(i,j) = dot(z.begin(), z.end(), V.ptrColumn(i));
+            for (size_t k = 0; k < n; k++) {
+                z[k] -= H(i,j) * V(k,i);
+            }
+        }
+        H(j+1,j) = sqrt(dot(z.begin(), z.end(), z.begin()));
+        if (H(j+1,j) > 0.0) {
+            for (size_t k = 0; k < n; k++) {
+                V(k,j+1) = z[k] / H(j+1,j);
+            }
+        }
+
+        // apply the previous rotations to the new column, and eliminate the
+        // subdiagonal element
+        for (size_t i = 0; i < j; i++) {
+            doublereal tmp = cs[i] * H(i,j) + sn[i] * H(i+1,j);
+            H(i+1,j) = -sn[i] * H(i,j) + cs[i] * H(i+1,j);
+            H(i,j) = tmp;
+        }
+        doublereal d = hypot(H(j,j), H(j+1,j));
+        if (d == 0.0) {
+            return false;
+        }
+        cs[j] = H(j,j) / d;
+        sn[j] = H(j+1,j) / d;
+        H(j,j) = d;
+        H(j+1,j) = 0.0;
+        g[j+1] = -sn[j] * g[j];
+        g[j] *= cs[j];
+        m = j + 1;
+        if (fabs(g[j+1]) <= tol) {
+            converged = true;
+            break;
+        }
+    }
+
+    // solve the upper triangular system H y = g, and update the solution
+    // with x += P^-1 V y
+    for (size_t i = m; i-- > 0;) {
+        for (size_t k = i + 1; k < m; k++) {
+            g[i] -= H(i,k) * g[k];
+        }
+        g[i] /= H(i,i);
+    }
+    fill(z.begin(), z.end(), 0.0);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t k = 0; k < n; k++) {
+            z[k] += g[i] * V(k,i);
+        }
+    }
+    if (P.solve(z.data())) {
+        return false;
+    }
+    for (size_t k = 0; k < n; k++) {
+        x[k] += z[k];
+    }
+    return converged;
+}
+
 //////////////////// class MultiTransport methods //////////////
 
 MultiTransport::MultiTransport(thermo_t* thermo)
-    : GasTransport(thermo)
+    : GasTransport(thermo),
+      m_iterative(false),
+      m_iter_rtol(1.0e-8),
+      m_iter_max(20),
+      m_Lprec_ok(false)
 {
 }
 
@@ -62,6 +175,7 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     m_l0000_ok = false;
     m_lmatrix_soln_ok = false;
     m_thermal_tlast = 0.0;
+    m_Lprec_ok = false;
 
     // some work space
     m_spwork1.resize(m_nsp);
@@ -88,7 +202,28 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     }
 }
 
+void MultiTransport::useIterativeSolver(bool iterative, doublereal rtol,
+                                        size_t maxIterations)
+{
+    if (rtol <= 0.0 || maxIterations == 0) {
+        throw CanteraError("MultiTransport::useIterativeSolver",
+                           "Tolerance and number of iterations must be "
+                           "positive.");
+    }
+    m_iterative = iterative;
+    m_iter_rtol = rtol;
+    m_iter_max = maxIterations;
+    m_Lprec_ok = false;
+}
+
 doublereal MultiTransport::thermalConductivity()
+{
+    update_T();
+    update_C();
+    return evalThermalConductivity();
+}
+
+doublereal MultiTransport::evalThermalConductivity()
 {
     solveLMatrixEquation();
     doublereal sum = 0.0;
@@ -99,6 +234,13 @@ doublereal MultiTransport::thermalConductivity()
 }
 
 void MultiTransport::getThermalDiffCoeffs(doublereal* const dt)
+{
+    update_T();
+    update_C();
+    evalThermalDiffCoeffs(dt);
+}
+
+void MultiTransport::evalThermalDiffCoeffs(doublereal* const dt)
 {
     solveLMatrixEquation();
     const doublereal c = 1.6/GasConstant;
@@ -111,7 +253,6 @@ void MultiTransport::solveLMatrixEquation()
 {
     // if T has changed, update the temperature-dependent properties.
     updateThermal_T();
-    update_C();
     if (m_lmatrix_soln_ok) {
         return;
     }
@@ -154,10 +295,31 @@ void MultiTransport::solveLMatrixEquation()
     eval_L0110();
     eval_L0101(m_molefracs.data());
 
-    // Solve it using GMRES or LU decomposition. The last solution in m_a should
-    // provide a good starting guess, so convergence should be fast.
-    m_a = m_b;
-    solve(m_Lmatrix, m_a.data());
+    if (m_iterative) {
+        // Solve it using GMRES, preconditioned with the factorization of the L
+        // matrix at an earlier state. The last solution in m_a should provide
+        // a good starting guess, so convergence should be fast. If it isn't,
+        // update the factorization and use it to solve the system directly.
+        if (!m_Lprec_ok || !gmresSolve(m_Lmatrix, m_Lprec, m_b, m_a,
+                                       m_iter_rtol, m_iter_max)) {
+            m_Lprec.resize(3*m_nsp, 3*m_nsp);
+            copy(m_Lmatrix.begin(), m_Lmatrix.end(), m_Lprec.begin());
+            int info = m_Lprec.factor();
+            if (info) {
+                m_Lprec_ok = false;
+                throw CanteraError("MultiTransport::solveLMatrixEquation",
+                                   "Error factorizing the L matrix. "
+                                   "Info = {}", info);
+            }
+            m_Lprec_ok = true;
+            m_a = m_b;
+            m_Lprec.solve(m_a.data());
+        }
+    } else {
+        // Solve it using LU decomposition
+        m_a = m_b;
+        solve(m_Lmatrix, m_a.data());
+    }
     m_lmatrix_soln_ok = true;
     m_molefracs_last = m_molefracs;
     // L matrix is overwritten with LU decomposition
@@ -170,6 +332,7 @@ void MultiTransport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_
 {
     // update the binary diffusion coefficients if necessary
     update_T();
+    update_C();
     updateDiff_T();
 
     // If any component of grad_T is non-zero, then get the
@@ -408,12 +571,12 @@ void MultiTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
     }
 }
 
-void MultiTransport::update_T()
+void MultiTransport::updateTemperature(doublereal T)
 {
-    if (m_temp == m_thermo->temperature()) {
+    if (m_temp == T) {
         return;
     }
-    GasTransport::update_T();
+    GasTransport::updateTemperature(T);
     // temperature has changed, so polynomial fits will need to be
     // redone, and the L matrix reevaluated.
     m_abc_ok = false;
@@ -425,10 +588,13 @@ void MultiTransport::update_C()
 {
     // Update the local mole fraction array
     m_thermo->getMoleFractions(m_molefracs.data());
+    updateMoleFractions(m_molefracs.data());
+}
 
+void MultiTransport::updateMoleFractions(const doublereal* const x)
+{
+    GasTransport::updateMoleFractions(x);
     for (size_t k = 0; k < m_nsp; k++) {
-        // add an offset to avoid a pure species condition
-        m_molefracs[k] = std::max(Tiny, m_molefracs[k]);
         if (m_molefracs[k] != m_molefracs_last[k]) {
             // If any mole fractions have changed, signal that concentration-
             // dependent quantities will need to be recomputed before use.
@@ -440,7 +606,7 @@ void MultiTransport::update_C()
 
 void MultiTransport::updateThermal_T()
 {
-    if (m_thermal_tlast == m_thermo->temperature()) {
+    if (m_thermal_tlast == m_temp) {
         return;
     }
     // we need species viscosities and binary diffusion coefficients
@@ -498,11 +664,18 @@ void MultiTransport::updateThermal_T()
      *       The original Dixon-Lewis paper subtracted 1.5 here.
      */
     vector_fp cp(m_thermo->nSpecies());
-    m_thermo->getCp_R_ref(&cp[0]);
+    if (m_temp == m_thermo->temperature()) {
+        m_thermo->getCp_R_ref(&cp[0]);
+    } else {
+        // Evaluating properties at a state other than that of the phase (see
+        // getMixtureProperties)
+        vector_fp h(m_nsp), s(m_nsp);
+        m_thermo->speciesThermo().update(m_temp, &cp[0], &h[0], &s[0]);
+    }
     for (size_t k = 0; k < m_nsp; k++) {
         m_cinternal[k] = cp[k] - 2.5;
     }
-    m_thermal_tlast = m_thermo->temperature();
+    m_thermal_tlast = m_temp;
 }
 
 //! Constant to compare dimensionless heat capacities against zero
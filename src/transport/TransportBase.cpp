@@ -110,6 +110,68 @@ void Transport::finalize()
     }
 }
 
+void Transport::getMixtureProperties(size_t npoints, const doublereal* T,
+                                     const doublereal* P, const doublereal* X,
+                                     doublereal* visc, doublereal* cond,
+                                     doublereal* diff, doublereal* dtherm)
+{
+    vector_fp state;
+    m_thermo->saveState(state);
+    try {
+        for (size_t i = 0; i < npoints; i++) {
+            m_thermo->setState_TPX(T[i], P[i], X + i*m_nsp);
+            if (visc) {
+                visc[i] = viscosity();
+            }
+            if (cond) {
+                cond[i] = thermalConductivity();
+            }
+            if (diff) {
+                getMixDiffCoeffs(diff + i*m_nsp);
+            }
+            if (dtherm) {
+                getThermalDiffCoeffs(dtherm + i*m_nsp);
+            }
+        }
+    } catch (...) {
+        m_thermo->restoreState(state);
+        throw;
+    }
+    m_thermo->restoreState(state);
+}
+
+void Transport::getMixtureProperties_NoNorm(size_t npoints,
+        const doublereal* T, const doublereal* P, const doublereal* Y,
+        doublereal* visc, doublereal* cond, doublereal* diff,
+        doublereal* dtherm)
+{
+    vector_fp state;
+    m_thermo->saveState(state);
+    try {
+        for (size_t i = 0; i < npoints; i++) {
+            m_thermo->setTemperature(T[i]);
+            m_thermo->setMassFractions_NoNorm(Y + i*m_nsp);
+            m_thermo->setPressure(P[i]);
+            if (visc) {
+                visc[i] = viscosity();
+            }
+            if (cond) {
+                cond[i] = thermalConductivity();
+            }
+            if (diff) {
+                getMixDiffCoeffs(diff + i*m_nsp);
+            }
+            if (dtherm) {
+                getThermalDiffCoeffs(dtherm + i*m_nsp);
+            }
+        }
+    } catch (...) {
+        m_thermo->restoreState(state);
+        throw;
+    }
+    m_thermo->restoreState(state);
+}
+
 void Transport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_T,
                                  size_t ldx, const doublereal* const grad_X,
                                  size_t ldf, doublereal* const fluxes)
@@ -29,8 +29,12 @@ void ConstPressureReactor::getState(double* y)
     // set the first component to the total mass
     y[0] = m_thermo->density() * m_vol;
 
-    // set the second component to the total enthalpy
-    y[1] = m_thermo->enthalpy_mass() * m_thermo->density() * m_vol;
+    // set the second component to the temperature or the total enthalpy
+    if (m_tempState) {
+        y[1] = m_thermo->temperature();
+    } else {
+        y[1] = m_thermo->enthalpy_mass() * m_thermo->density() * m_vol;
+    }
 
     // set components y+2 ... y+K+1 to the mass fractions Y_k of each species
     m_thermo->getMassFractions(y+2);
@@ -44,16 +48,19 @@ void ConstPressureReactor::initialize(doublereal t0)
 {
     Reactor::initialize(t0);
     m_nv -= 1; // Constant pressure reactor has one fewer state variable
+    m_hk.resize(m_nsp, 0.0);
 }
 
 void ConstPressureReactor::updateState(doublereal* y)
 {
-    // The components of y are [0] the total mass, [1] the total enthalpy,
-    // [2...K+2) are the mass fractions of each species, and [K+2...] are the
-    // coverages of surface species on each wall.
+    // The components of y are [0] the total mass, [1] the total enthalpy or
+    // the temperature, [2...K+2) are the mass fractions of each species, and
+    // [K+2...] are the coverages of surface species on each wall.
     m_mass = y[0];
     m_thermo->setMassFractions_NoNorm(y+2);
-    if (m_energy) {
+    if (m_tempState) {
+        m_thermo->setState_TP(y[1], m_pressure);
+    } else if (m_energy) {
         m_thermo->setState_HP(y[1]/m_mass, m_pressure, 1.0e-4);
     } else {
         m_thermo->setPressure(m_pressure);
@@ -95,27 +102,40 @@ void ConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     // external heat transfer
     double dHdt = - m_Q;
 
-    // add terms for outlets
-    for (size_t i = 0; i < m_outlet.size(); i++) {
-        double mdot_out = m_outlet[i]->massFlowRate(time); // mass flow out of system
-        dmdt -= mdot_out;
-        dHdt -= mdot_out * m_enthalpy;
-    }
+    // The inlets and outlets are omitted while the reaction terms are
+    // integrated separately (see disableCoupling())
+    if (m_coupled) {
+        // add terms for outlets
+        for (size_t i = 0; i < m_outlet.size(); i++) {
+            double mdot_out = m_outlet[i]->massFlowRate(time);
+            dmdt -= mdot_out; // mass flow out of system
+            dHdt -= mdot_out * m_enthalpy;
+        }
 
-    // add terms for inlets
-    for (size_t i = 0; i < m_inlet.size(); i++) {
-        double mdot_in = m_inlet[i]->massFlowRate(time);
-        dmdt += mdot_in; // mass flow into system
-        for (size_t n = 0; n < m_nsp; n++) {
-            double mdot_spec = m_inlet[i]->outletSpeciesMassFlowRate(n);
-            // flow of species into system and dilution by other species
-            dYdt[n] += (mdot_spec - mdot_in * Y[n]) / m_mass;
+        // add terms for inlets
+        for (size_t i = 0; i < m_inlet.size(); i++) {
+            double mdot_in = m_inlet[i]->massFlowRate(time);
+            dmdt += mdot_in; // mass flow into system
+            for (size_t n = 0; n < m_nsp; n++) {
+                double mdot_spec = m_inlet[i]->outletSpeciesMassFlowRate(n);
+                // flow of species into system and dilution by other species
+                dYdt[n] += (mdot_spec - mdot_in * Y[n]) / m_mass;
+            }
+            dHdt += mdot_in * m_inlet[i]->enthalpy_mass();
         }
-        dHdt += mdot_in * m_inlet[i]->enthalpy_mass();
     }
 
     ydot[0] = dmdt;
-    if (m_energy) {
+    if (m_tempState && m_energy) {
+        // Convert dH/dt to dT/dt. At constant pressure, with H = H(T, n_k),
+        //     dH/dt = m c_p dT/dt + sum_k h_k dn_k/dt
+        m_thermo->getPartialMolarEnthalpies(m_hk.data());
+        double mcpdTdt = dHdt;
+        for (size_t k = 0; k < m_nsp; k++) {
+            mcpdTdt -= m_hk[k] * (dmdt * Y[k] + m_mass * dYdt[k]) / mw[k];
+        }
+        ydot[1] = mcpdTdt / (m_mass * m_thermo->cp_mass());
+    } else if (m_energy) {
         ydot[1] = dHdt;
     } else {
         ydot[1] = 0.0;
@@ -137,7 +157,9 @@ size_t ConstPressureReactor::componentIndex(const string& nm) const
                 "disabled after Cantera 2.3. Use 'mass' instead.");
         }
         return 0;
-    } else if (nm == "H" || nm == "enthalpy") {
+    } else if (m_tempState && nm == "temperature") {
+        return 1;
+    } else if (!m_tempState && (nm == "H" || nm == "enthalpy")) {
         if (nm == "H") {
             warn_deprecated("ConstPressureReactor::componentIndex(\"H\")",
                 "Using the name 'H' for enthalpy is deprecated, and will be "
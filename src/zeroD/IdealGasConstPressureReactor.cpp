@@ -22,6 +22,14 @@ void IdealGasConstPressureReactor::setThermoMgr(ThermoPhase& thermo)
 }
 
 
+void IdealGasConstPressureReactor::setTemperatureState(bool tstate)
+{
+    if (!tstate) {
+        throw CanteraError("IdealGasConstPressureReactor::setTemperatureState",
+            "The temperature is always a state variable of this reactor.");
+    }
+}
+
 void IdealGasConstPressureReactor::getInitialConditions(double t0, size_t leny,
                                                         double* y)
 {
@@ -109,21 +117,25 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
         dYdt[n] -= Y[n] * mdot_surf / m_mass;
     }
 
-    // add terms for outlets
-    for (size_t i = 0; i < m_outlet.size(); i++) {
-        dmdt -= m_outlet[i]->massFlowRate(time); // mass flow out of system
-    }
+    // The inlets and outlets are omitted while the reaction terms are
+    // integrated separately (see disableCoupling())
+    if (m_coupled) {
+        // add terms for outlets
+        for (size_t i = 0; i < m_outlet.size(); i++) {
+            dmdt -= m_outlet[i]->massFlowRate(time); // mass flow out of system
+        }
 
-    // add terms for inlets
-    for (size_t i = 0; i < m_inlet.size(); i++) {
-        double mdot_in = m_inlet[i]->massFlowRate(time);
-        dmdt += mdot_in; // mass flow into system
-        mcpdTdt += m_inlet[i]->enthalpy_mass() * mdot_in;
-        for (size_t n = 0; n < m_nsp; n++) {
-            double mdot_spec = m_inlet[i]->outletSpeciesMassFlowRate(n);
-            // flow of species into system and dilution by other species
-            dYdt[n] += (mdot_spec - mdot_in * Y[n]) / m_mass;
-            mcpdTdt -= m_hk[n] / mw[n] * mdot_spec;
+        // add terms for inlets
+        for (size_t i = 0; i < m_inlet.size(); i++) {
+            double mdot_in = m_inlet[i]->massFlowRate(time);
+            dmdt += mdot_in; // mass flow into system
+            mcpdTdt += m_inlet[i]->enthalpy_mass() * mdot_in;
+            for (size_t n = 0; n < m_nsp; n++) {
+                double mdot_spec = m_inlet[i]->outletSpeciesMassFlowRate(n);
+                // flow of species into system and dilution by other species
+                dYdt[n] += (mdot_spec - mdot_in * Y[n]) / m_mass;
+                mcpdTdt -= m_hk[n] / mw[n] * mdot_spec;
+            }
         }
     }
 
@@ -137,6 +149,185 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+bool IdealGasConstPressureReactor::hasChemistryJacobian() const
+{
+    return m_chem && m_kin->type() == cGasKinetics;
+}
+
+void IdealGasConstPressureReactor::getChemistryJacobian(double* params,
+                                                        Array2D& jac)
+{
+    jac.resize(m_nv, m_nv);
+    jac.zero();
+    m_thermo->restoreState(m_state);
+    applySensitivity(params);
+    m_dwdot_dC.resize(m_nsp * m_nsp);
+    m_dwdot_dT.resize(m_nsp);
+    m_kin->getNetProductionRates(m_wdot.data());
+    m_kin->getNetProductionRates_ddC(m_dwdot_dC.data());
+    m_kin->getNetProductionRates_ddT(m_dwdot_dT.data());
+    resetSensitivity(params);
+
+    m_thermo->getPartialMolarEnthalpies(m_hk.data());
+    vector_fp cpk(m_nsp), conc(m_nsp), dwdot_dlnrho(m_nsp);
+    m_thermo->getPartialMolarCp(cpk.data());
+    m_thermo->getConcentrations(conc.data());
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double rho = m_thermo->density();
+    double cp = m_thermo->cp_mass();
+    double Wmean = m_thermo->meanMolecularWeight();
+    double T = m_thermo->temperature();
+
+    // The components of y are [0] the total mass, [1] the temperature,
+    // [2...K+2) are the mass fractions of each species. The reaction terms
+    // do not depend on the mass. At constant pressure, the concentrations are
+    // C_k = rho Y_k / W_k, where the density rho = P Wmean / (R T) depends on
+    // the temperature and the mass fractions. The derivatives of the
+    // production rates with respect to ln(rho) at constant composition are
+    // dwdot/dC . C
+    double dTdt = 0.0; // reaction terms in the energy equation
+    for (size_t k = 0; k < m_nsp; k++) {
+        dTdt -= m_wdot[k] * m_hk[k] / (rho * cp);
+        double sum = 0.0;
+        for (size_t j = 0; j < m_nsp; j++) {
+            sum += m_dwdot_dC[j * m_nsp + k] * conc[j];
+        }
+        dwdot_dlnrho[k] = sum;
+    }
+
+    double dEdT = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        double dYdt = m_wdot[k] * mw[k] / rho;
+        double dwdot_dT = m_dwdot_dT[k] - dwdot_dlnrho[k] / T;
+        jac(k+2, 1) = dwdot_dT * mw[k] / rho + dYdt / T;
+        dEdT += dwdot_dT * m_hk[k] + m_wdot[k] * cpk[k];
+    }
+
+    for (size_t j = 0; j < m_nsp; j++) {
+        // dwdot_k/dY_j = dwdot_k/dC_j * rho / W_j - dwdot_k/dln(rho) * Wmean / W_j
+        double* dwdot_dC = &m_dwdot_dC[j * m_nsp];
+        double dEdY = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            double dwdot = (dwdot_dC[k] * rho - dwdot_dlnrho[k] * Wmean) / mw[j];
+            double dYdt = m_wdot[k] * mw[k] / rho;
+            jac(k+2, j+2) = dwdot * mw[k] / rho + dYdt * Wmean / mw[j];
+            dEdY += dwdot * m_hk[k];
+        }
+        if (m_energy) {
+            jac(1, j+2) = - dEdY / (rho * cp)
+                          + dTdt * (Wmean - cpk[j] / cp) / mw[j];
+        }
+    }
+
+    if (m_energy) {
+        jac(1, 1) = - dEdT / (rho * cp) + dTdt / T;
+    }
+}
+
+void IdealGasConstPressureReactor::evalParameterAdjoint(double t, double* y,
+                                                       double* params,
+                                                       const double* lambda,
+                                                       double* out)
+{
+    if (!m_pnum.empty()) {
+        // Derivatives of the species and energy equations with respect to
+        // the net production rates, weighted by the adjoint variables
+        m_thermo->restoreState(m_state);
+        m_thermo->getPartialMolarEnthalpies(m_hk.data());
+        const vector_fp& mw = m_thermo->molecularWeights();
+        double mcp = m_mass * m_thermo->cp_mass();
+        vector_fp a(m_nsp);
+        for (size_t k = 0; k < m_nsp; k++) {
+            a[k] = lambda[k+2] * mw[k] * m_vol / m_mass;
+            if (m_energy) {
+                a[k] -= lambda[1] * m_hk[k] * m_vol / mcp;
+            }
+        }
+        getReactionAdjoint(params, a.data(), out);
+    }
+    evalParameterAdjointFD(t, y, params, lambda, out, m_pnum.size());
+}
+
+bool IdealGasConstPressureReactor::hasPreconditioner() const
+{
+    return hasChemistryJacobian();
+}
+
+void IdealGasConstPressureReactor::getPreconditionerPattern(
+    vector<vector<size_t>>& rows)
+{
+    vector<vector<size_t>> species;
+    m_kin->getNetProductionRates_ddCPattern(species);
+    m_dwdot_dC_sparse.setPattern(species);
+    rows.assign(m_nv, vector<size_t>());
+    for (size_t k = 0; k < m_nsp; k++) {
+        rows[k+2].push_back(1);
+        for (size_t j : species[k]) {
+            rows[k+2].push_back(j+2);
+        }
+        if (m_energy) {
+            rows[1].push_back(k+2);
+        }
+    }
+}
+
+void IdealGasConstPressureReactor::evalPreconditioner(double* params,
+                                                      SparseMatrix& jac,
+                                                      size_t start)
+{
+    if (!m_chem) {
+        return;
+    }
+    m_thermo->restoreState(m_state);
+    applySensitivity(params);
+    m_dwdot_dT.resize(m_nsp);
+    m_kin->getNetProductionRates(m_wdot.data());
+    m_kin->getNetProductionRates_ddC(m_dwdot_dC_sparse);
+    m_kin->getNetProductionRates_ddT(m_dwdot_dT.data());
+    resetSensitivity(params);
+
+    m_thermo->getPartialMolarEnthalpies(m_hk.data());
+    vector_fp cpk(m_nsp), conc(m_nsp), dEdY(m_nsp, 0.0);
+    m_thermo->getPartialMolarCp(cpk.data());
+    m_thermo->getConcentrations(conc.data());
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double rho = m_thermo->density();
+    double cp = m_thermo->cp_mass();
+    double Wmean = m_thermo->meanMolecularWeight();
+    double T = m_thermo->temperature();
+
+    // Same terms as in getChemistryJacobian, except that the derivatives
+    // with respect to the mass fractions at constant density are used. The
+    // sums over the species for the energy equation are accumulated while
+    // traversing the rows of the sparse derivatives.
+    const vector<size_t>& rowStart = m_dwdot_dC_sparse.rowStart();
+    const vector<size_t>& cols = m_dwdot_dC_sparse.columns();
+    const double* dwdot = m_dwdot_dC_sparse.data();
+    double dTdt = 0.0, dEdT = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        dTdt -= m_wdot[k] * m_hk[k] / (rho * cp);
+        double dwdot_dlnrho = 0.0;
+        for (size_t n = rowStart[k]; n < rowStart[k+1]; n++) {
+            size_t j = cols[n];
+            dwdot_dlnrho += dwdot[n] * conc[j];
+            jac.value(start + k + 2, start + j + 2) += dwdot[n] * mw[k] / mw[j];
+            dEdY[j] += dwdot[n] * rho / mw[j] * m_hk[k];
+        }
+        double dYdt = m_wdot[k] * mw[k] / rho;
+        double dwdot_dT = m_dwdot_dT[k] - dwdot_dlnrho / T;
+        jac.value(start + k + 2, start + 1) += dwdot_dT * mw[k] / rho + dYdt / T;
+        dEdT += dwdot_dT * m_hk[k] + m_wdot[k] * cpk[k];
+    }
+
+    if (m_energy) {
+        for (size_t j = 0; j < m_nsp; j++) {
+            jac.value(start + 1, start + j + 2) += - dEdY[j] / (rho * cp)
+                + dTdt * (Wmean - cpk[j] / cp) / mw[j];
+        }
+        jac.value(start + 1, start + 1) += - dEdT / (rho * cp) + dTdt / T;
+    }
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
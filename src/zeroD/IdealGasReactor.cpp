@@ -20,6 +20,14 @@ void IdealGasReactor::setThermoMgr(ThermoPhase& thermo)
     Reactor::setThermoMgr(thermo);
 }
 
+void IdealGasReactor::setTemperatureState(bool tstate)
+{
+    if (!tstate) {
+        throw CanteraError("IdealGasReactor::setTemperatureState",
+            "The temperature is always a state variable of this reactor.");
+    }
+}
+
 void IdealGasReactor::getInitialConditions(double t0, size_t leny, double* y)
 {
     warn_deprecated("IdealGasReactor::getInitialConditions",
@@ -111,26 +119,30 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
         dYdt[n] -= Y[n] * mdot_surf / m_mass;
     }
 
-    // add terms for outlets
-    for (size_t i = 0; i < m_outlet.size(); i++) {
-        double mdot_out = m_outlet[i]->massFlowRate(time);
-        dmdt -= mdot_out; // mass flow out of system
-        mcvdTdt -= mdot_out * m_pressure * m_vol / m_mass; // flow work
-    }
+    // The inlets and outlets are omitted while the reaction terms are
+    // integrated separately (see disableCoupling())
+    if (m_coupled) {
+        // add terms for outlets
+        for (size_t i = 0; i < m_outlet.size(); i++) {
+            double mdot_out = m_outlet[i]->massFlowRate(time);
+            dmdt -= mdot_out; // mass flow out of system
+            mcvdTdt -= mdot_out * m_pressure * m_vol / m_mass; // flow work
+        }
 
-    // add terms for inlets
-    for (size_t i = 0; i < m_inlet.size(); i++) {
-        double mdot_in = m_inlet[i]->massFlowRate(time);
-        dmdt += mdot_in; // mass flow into system
-        mcvdTdt += m_inlet[i]->enthalpy_mass() * mdot_in;
-        for (size_t n = 0; n < m_nsp; n++) {
-            double mdot_spec = m_inlet[i]->outletSpeciesMassFlowRate(n);
-            // flow of species into system and dilution by other species
-            dYdt[n] += (mdot_spec - mdot_in * Y[n]) / m_mass;
+        // add terms for inlets
+        for (size_t i = 0; i < m_inlet.size(); i++) {
+            double mdot_in = m_inlet[i]->massFlowRate(time);
+            dmdt += mdot_in; // mass flow into system
+            mcvdTdt += m_inlet[i]->enthalpy_mass() * mdot_in;
+            for (size_t n = 0; n < m_nsp; n++) {
+                double mdot_spec = m_inlet[i]->outletSpeciesMassFlowRate(n);
+                // flow of species into system and dilution by other species
+                dYdt[n] += (mdot_spec - mdot_in * Y[n]) / m_mass;
 
-            // In combintion with h_in*mdot_in, flow work plus thermal
-            // energy carried with the species
-            mcvdTdt -= m_uk[n] / mw[n] * mdot_spec;
+                // In combintion with h_in*mdot_in, flow work plus thermal
+                // energy carried with the species
+                mcvdTdt -= m_uk[n] / mw[n] * mdot_spec;
+            }
         }
     }
 
@@ -145,6 +157,175 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+bool IdealGasReactor::hasChemistryJacobian() const
+{
+    return m_chem && m_kin->type() == cGasKinetics;
+}
+
+void IdealGasReactor::getChemistryJacobian(double* params, Array2D& jac)
+{
+    jac.resize(m_nv, m_nv);
+    jac.zero();
+    m_thermo->restoreState(m_state);
+    applySensitivity(params);
+    m_dwdot_dC.resize(m_nsp * m_nsp);
+    m_dwdot_dT.resize(m_nsp);
+    m_kin->getNetProductionRates(m_wdot.data());
+    m_kin->getNetProductionRates_ddC(m_dwdot_dC.data());
+    m_kin->getNetProductionRates_ddT(m_dwdot_dT.data());
+    resetSensitivity(params);
+
+    m_thermo->getPartialMolarIntEnergies(m_uk.data());
+    vector_fp cvk(m_nsp), conc(m_nsp), dwdot_dlnrho(m_nsp);
+    m_thermo->getPartialMolarCp(cvk.data());
+    m_thermo->getConcentrations(conc.data());
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double rho = m_mass / m_vol;
+    double mcv = m_mass * m_thermo->cv_mass();
+
+    // The components of y are [0] the total mass, [1] the total volume,
+    // [2] the temperature, [3...K+3] are the mass fractions of each species.
+    // The concentrations are C_k = m Y_k / (V W_k), so the derivatives of the
+    // production rates with respect to the mass and volume follow from their
+    // derivatives with respect to ln(rho) at constant composition, which are
+    // dwdot/dC . C
+    double dTdt = 0.0; // reaction terms in the energy equation
+    for (size_t k = 0; k < m_nsp; k++) {
+        cvk[k] -= GasConstant;
+        dTdt -= m_wdot[k] * m_uk[k] * m_vol / mcv;
+        double sum = 0.0;
+        for (size_t j = 0; j < m_nsp; j++) {
+            sum += m_dwdot_dC[j * m_nsp + k] * conc[j];
+        }
+        dwdot_dlnrho[k] = sum;
+    }
+
+    double dEdlnrho = 0.0, dEdT = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        double dYdt = m_wdot[k] * mw[k] / rho;
+        jac(k+3, 0) = (dwdot_dlnrho[k] * mw[k] / rho - dYdt) / m_mass;
+        jac(k+3, 1) = (dYdt - dwdot_dlnrho[k] * mw[k] / rho) / m_vol;
+        jac(k+3, 2) = m_dwdot_dT[k] * mw[k] / rho;
+        dEdlnrho += dwdot_dlnrho[k] * m_uk[k];
+        dEdT += m_dwdot_dT[k] * m_uk[k] + m_wdot[k] * cvk[k];
+    }
+
+    for (size_t j = 0; j < m_nsp; j++) {
+        // dwdot_k/dY_j = dwdot_k/dC_j * rho / W_j
+        double* dwdot = &m_dwdot_dC[j * m_nsp];
+        double dEdY = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            jac(k+3, j+3) = dwdot[k] * mw[k] / mw[j];
+            dEdY += dwdot[k] * m_uk[k];
+        }
+        if (m_energy) {
+            jac(2, j+3) = - dEdY * rho * m_vol / (mw[j] * mcv)
+                          - dTdt * cvk[j] / (mw[j] * m_thermo->cv_mass());
+        }
+    }
+
+    if (m_energy) {
+        jac(2, 0) = - (dEdlnrho * m_vol / mcv + dTdt) / m_mass;
+        jac(2, 1) = dTdt / m_vol + dEdlnrho / mcv;
+        jac(2, 2) = - dEdT * m_vol / mcv;
+    }
+}
+
+void IdealGasReactor::evalParameterAdjoint(double t, double* y,
+                                           double* params,
+                                           const double* lambda, double* out)
+{
+    if (!m_pnum.empty()) {
+        // Derivatives of the species and energy equations with respect to
+        // the net production rates, weighted by the adjoint variables
+        m_thermo->restoreState(m_state);
+        m_thermo->getPartialMolarIntEnergies(m_uk.data());
+        const vector_fp& mw = m_thermo->molecularWeights();
+        double mcv = m_mass * m_thermo->cv_mass();
+        vector_fp a(m_nsp);
+        for (size_t k = 0; k < m_nsp; k++) {
+            a[k] = lambda[k+3] * mw[k] * m_vol / m_mass;
+            if (m_energy) {
+                a[k] -= lambda[2] * m_uk[k] * m_vol / mcv;
+            }
+        }
+        getReactionAdjoint(params, a.data(), out);
+    }
+    evalParameterAdjointFD(t, y, params, lambda, out, m_pnum.size());
+}
+
+bool IdealGasReactor::hasPreconditioner() const
+{
+    return hasChemistryJacobian();
+}
+
+void IdealGasReactor::getPreconditionerPattern(vector<vector<size_t>>& rows)
+{
+    vector<vector<size_t>> species;
+    m_kin->getNetProductionRates_ddCPattern(species);
+    m_dwdot_dC_sparse.setPattern(species);
+    rows.assign(m_nv, vector<size_t>());
+    for (size_t k = 0; k < m_nsp; k++) {
+        rows[k+3].push_back(2);
+        for (size_t j : species[k]) {
+            rows[k+3].push_back(j+3);
+        }
+        if (m_energy) {
+            rows[2].push_back(k+3);
+        }
+    }
+}
+
+void IdealGasReactor::evalPreconditioner(double* params, SparseMatrix& jac,
+                                         size_t start)
+{
+    if (!m_chem) {
+        return;
+    }
+    m_thermo->restoreState(m_state);
+    applySensitivity(params);
+    m_dwdot_dT.resize(m_nsp);
+    m_kin->getNetProductionRates(m_wdot.data());
+    m_kin->getNetProductionRates_ddC(m_dwdot_dC_sparse);
+    m_kin->getNetProductionRates_ddT(m_dwdot_dT.data());
+    resetSensitivity(params);
+
+    m_thermo->getPartialMolarIntEnergies(m_uk.data());
+    vector_fp cvk(m_nsp), dEdY(m_nsp, 0.0);
+    m_thermo->getPartialMolarCp(cvk.data());
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double rho = m_mass / m_vol;
+    double mcv = m_mass * m_thermo->cv_mass();
+
+    // Same terms as in getChemistryJacobian, omitting the mass and volume
+    // columns. The sums over the species for the energy equation are
+    // accumulated while traversing the rows of the sparse derivatives.
+    const vector<size_t>& rowStart = m_dwdot_dC_sparse.rowStart();
+    const vector<size_t>& cols = m_dwdot_dC_sparse.columns();
+    const double* dwdot = m_dwdot_dC_sparse.data();
+    double dTdt = 0.0, dEdT = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        cvk[k] -= GasConstant;
+        dTdt -= m_wdot[k] * m_uk[k] * m_vol / mcv;
+        dEdT += m_dwdot_dT[k] * m_uk[k] + m_wdot[k] * cvk[k];
+        jac.value(start + k + 3, start + 2) += m_dwdot_dT[k] * mw[k] / rho;
+        for (size_t n = rowStart[k]; n < rowStart[k+1]; n++) {
+            size_t j = cols[n];
+            jac.value(start + k + 3, start + j + 3) += dwdot[n] * mw[k] / mw[j];
+            dEdY[j] += dwdot[n] * m_uk[k];
+        }
+    }
+
+    if (m_energy) {
+        for (size_t j = 0; j < m_nsp; j++) {
+            jac.value(start + 2, start + j + 3) +=
+                - dEdY[j] * rho * m_vol / (mw[j] * mcv)
+                - dTdt * cvk[j] / (mw[j] * m_thermo->cv_mass());
+        }
+        jac.value(start + 2, start + 2) -= dEdT * m_vol / mcv;
+    }
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
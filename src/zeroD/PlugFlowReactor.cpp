@@ -0,0 +1,391 @@
+//! @file PlugFlowReactor.cpp
+
+#include "cantera/zeroD/PlugFlowReactor.h"
+#include "cantera/numerics/IDA_Solver.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/SurfPhase.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+PlugFlowReactor::PlugFlowReactor(ThermoPhase& thermo, Kinetics& kin) :
+    m_thermo(&thermo),
+    m_kin(&kin),
+    m_area(0),
+    m_callback(0),
+    m_nsp(thermo.nSpecies()),
+    m_mdot(0.0),
+    m_areaConst(1.0),
+    m_energy(true),
+    m_init(false),
+    m_rtol(1.0e-9),
+    m_atol(1.0e-15),
+    m_z(0.0)
+{
+    if (thermo.eosType() != cIdealGas) {
+        throw CanteraError("PlugFlowReactor::PlugFlowReactor",
+                           "Incompatible phase type provided");
+    }
+    if (&kin.thermo(0) != &thermo) {
+        throw CanteraError("PlugFlowReactor::PlugFlowReactor",
+                           "Kinetics manager is not for the given phase");
+    }
+    neq_ = 0;
+}
+
+PlugFlowReactor::~PlugFlowReactor()
+{
+}
+
+void PlugFlowReactor::addSurface(InterfaceKinetics& kin, double areaToVolume)
+{
+    if (&kin.thermo(0) != m_thermo) {
+        throw CanteraError("PlugFlowReactor::addSurface",
+                           "First phase of the kinetics manager must be the"
+                           " gas.");
+    }
+    Surface s;
+    s.kin = &kin;
+    size_t ns = kin.surfacePhaseIndex();
+    s.phase = dynamic_cast<SurfPhase*>(&kin.thermo(ns));
+    s.areaToVolume = areaToVolume;
+    s.start = npos;
+    s.kinStart = kin.kineticsSpeciesIndex(0, ns);
+    m_surfaces.push_back(s);
+    m_init = false;
+}
+
+void PlugFlowReactor::setMassFlowRate(double mdot)
+{
+    if (mdot <= 0.0) {
+        throw CanteraError("PlugFlowReactor::setMassFlowRate",
+                           "Mass flow rate must be positive. Got {}.", mdot);
+    }
+    m_mdot = mdot;
+    m_init = false;
+}
+
+void PlugFlowReactor::setArea(double area)
+{
+    m_area = 0;
+    m_areaConst = area;
+    m_init = false;
+}
+
+void PlugFlowReactor::setArea(Func1& area)
+{
+    m_area = &area;
+    m_init = false;
+}
+
+double PlugFlowReactor::area(double z) const
+{
+    return (m_area) ? m_area->eval(z) : m_areaConst;
+}
+
+double PlugFlowReactor::dAdz(double z) const
+{
+    if (!m_area) {
+        return 0.0;
+    }
+    double h = 1e-6 * std::max(std::abs(z), 1e-2);
+    return (m_area->eval(z + h) - m_area->eval(z - h)) / (2 * h);
+}
+
+void PlugFlowReactor::setTolerances(double rtol, double atol)
+{
+    if (rtol >= 0.0) {
+        m_rtol = rtol;
+    }
+    if (atol >= 0.0) {
+        m_atol = atol;
+    }
+    m_init = false;
+}
+
+void PlugFlowReactor::getCoverages(size_t n, double* theta) const
+{
+    const Surface& s = m_surfaces.at(n);
+    copy(m_y.begin() + s.start, m_y.begin() + s.start + s.phase->nSpecies(),
+         theta);
+}
+
+void PlugFlowReactor::initialize(double z0)
+{
+    if (m_mdot <= 0.0) {
+        throw CanteraError("PlugFlowReactor::initialize",
+                           "Mass flow rate has not been set.");
+    }
+    double A = area(z0);
+    if (A <= 0.0) {
+        throw CanteraError("PlugFlowReactor::initialize",
+                           "Area must be positive. Got {}.", A);
+    }
+
+    // The gas-phase variables are [u, rho, P, T, Y_k], followed by the
+    // coverages of each surface, which are algebraic
+    neq_ = static_cast<int>(m_nsp + 4);
+    size_t maxnt = 0;
+    for (auto& s : m_surfaces) {
+        s.start = neq_;
+        neq_ += static_cast<int>(s.phase->nSpecies());
+        maxnt = std::max(maxnt, s.kin->nTotalSpecies());
+    }
+    m_alg.clear();
+    initSizes();
+    for (const auto& s : m_surfaces) {
+        for (size_t k = 0; k < s.phase->nSpecies(); k++) {
+            setAlgebraic(static_cast<int>(s.start + k));
+        }
+    }
+    m_wdot.assign(m_nsp, 0.0);
+    m_sdot.assign(m_nsp, 0.0);
+    m_hk.assign(m_nsp, 0.0);
+    m_work.assign(maxnt, 0.0);
+
+    m_y.assign(neq_, 0.0);
+    m_y[0] = m_mdot / (m_thermo->density() * A);
+    m_y[1] = m_thermo->density();
+    m_y[2] = m_thermo->pressure();
+    m_y[3] = m_thermo->temperature();
+    m_thermo->getMassFractions(&m_y[4]);
+    for (auto& s : m_surfaces) {
+        // Starting guess for the coverages, which are refined by the
+        // integrator
+        s.phase->setTemperature(m_y[3]);
+        s.kin->solvePseudoSteadyStateProblem();
+        s.phase->getCoverages(&m_y[s.start]);
+    }
+
+    m_solver.reset(new IDA_Solver(*this));
+    vector_fp atol(neq_, m_atol);
+    for (size_t i = 0; i < 4; i++) {
+        atol[i] = m_atol * std::max(1.0, std::abs(m_y[i]));
+    }
+    m_solver->setTolerances(m_rtol, atol.data());
+    m_solver->setDenseLinearSolver();
+    if (!m_surfaces.empty()) {
+        m_solver->inclAlgebraicInErrorTest(false);
+    }
+    m_residError = nullptr;
+    m_solver->init(z0);
+    if (!m_surfaces.empty()) {
+        vector_fp ydot(neq_);
+        try {
+            m_solver->correctInitial_YaYp_given_Yd(m_y.data(), ydot.data(),
+                                                   z0 + 1.0e-5);
+        } catch (CanteraError&) {
+            checkResidError();
+            throw;
+        }
+    }
+    m_z = z0;
+    updateState(m_z, m_y.data());
+    m_init = true;
+}
+
+void PlugFlowReactor::advance(double z)
+{
+    if (!m_init) {
+        initialize(m_z);
+    }
+    if (z == m_z) {
+        return;
+    } else if (z < m_z) {
+        throw CanteraError("PlugFlowReactor::advance", "Can't integrate "
+            "backwards from z = {} to z = {}.", m_z, z);
+    }
+    try {
+        m_solver->solve(z);
+    } catch (CanteraError&) {
+        checkResidError();
+        throw;
+    }
+    const double* y = m_solver->solutionVector();
+    copy(y, y + neq_, m_y.begin());
+    m_z = z;
+    updateState(m_z, m_y.data());
+}
+
+void PlugFlowReactor::solve(double length, double dz)
+{
+    if (dz <= 0.0) {
+        throw CanteraError("PlugFlowReactor::solve",
+                           "Output interval must be positive. Got {}.", dz);
+    }
+    if (!m_init) {
+        initialize(m_z);
+    }
+    double z0 = m_z;
+    if (m_callback) {
+        m_callback->eval(m_z);
+    }
+    for (size_t i = 1; m_z < length; i++) {
+        // Stations are computed from their index to avoid accumulating
+        // round-off errors over many steps
+        double z = z0 + i * dz;
+        if (z > length - 1e-8 * dz) {
+            z = length;
+        }
+        advance(z);
+        if (m_callback) {
+            m_callback->eval(m_z);
+        }
+    }
+}
+
+void PlugFlowReactor::checkResidError()
+{
+    if (m_residError) {
+        std::exception_ptr err = m_residError;
+        m_residError = nullptr;
+        m_init = false;
+        rethrow_exception(err);
+    }
+}
+
+void PlugFlowReactor::updateState(double z, const double* y)
+{
+    m_thermo->setMassFractions_NoNorm(y + 4);
+    m_thermo->setState_TR(y[3], y[1]);
+    for (const auto& s : m_surfaces) {
+        s.phase->setTemperature(y[3]);
+        s.phase->setCoveragesNoNorm(y + s.start);
+    }
+}
+
+double PlugFlowReactor::evalSurfaces(const double* y, double* resid)
+{
+    const vector_fp& mw = m_thermo->molecularWeights();
+    fill(m_sdot.begin(), m_sdot.end(), 0.0);
+    double mdot_surf = 0.0;
+    for (const auto& s : m_surfaces) {
+        s.kin->getNetProductionRates(m_work.data());
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_sdot[k] += m_work[k] * s.areaToVolume;
+            mdot_surf += m_work[k] * s.areaToVolume * mw[k];
+        }
+        if (resid) {
+            // The coverages sum to one, and the net production rates of
+            // the other surface species are zero
+            size_t nk = s.phase->nSpecies();
+            double rs0 = 1.0 / s.phase->siteDensity();
+            resid[s.start] = -1.0;
+            for (size_t k = 0; k < nk; k++) {
+                resid[s.start] += y[s.start + k];
+            }
+            for (size_t k = 1; k < nk; k++) {
+                resid[s.start + k] = m_work[s.kinStart + k] * rs0
+                                     * s.phase->size(k);
+            }
+        }
+    }
+    return mdot_surf;
+}
+
+int PlugFlowReactor::evalResidNJ(const doublereal t, const doublereal delta_t,
+                                 const doublereal* const y,
+                                 const doublereal* const ydot,
+                                 doublereal* const resid,
+                                 const ResidEval_Type_Enum evalType,
+                                 const int id_x, const doublereal delta_x)
+{
+    try {
+        updateState(t, y);
+        double u = y[0];
+        double rho = y[1];
+        double T = y[3];
+        const double* Y = y + 4;
+        const double* dYdz = ydot + 4;
+        const vector_fp& mw = m_thermo->molecularWeights();
+        m_kin->getNetProductionRates(m_wdot.data());
+        double mdot_surf = evalSurfaces(y, resid);
+
+        // continuity
+        resid[0] = u * ydot[1] + rho * ydot[0] + rho * u * dAdz(t) / area(t)
+                   - mdot_surf;
+
+        // differentiated equation of state, P = rho R T sum_k(Y_k / W_k)
+        double sigma = 0.0, dsigma = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            sigma += Y[k] / mw[k];
+            dsigma += dYdz[k] / mw[k];
+        }
+        resid[1] = ydot[2] - GasConstant * (T * sigma * ydot[1]
+                   + rho * sigma * ydot[3] + rho * T * dsigma);
+
+        // momentum
+        resid[2] = rho * u * ydot[0] + ydot[2] + u * mdot_surf;
+
+        // energy
+        if (m_energy) {
+            m_thermo->getPartialMolarEnthalpies(m_hk.data());
+            resid[3] = rho * u * m_thermo->cp_mass() * ydot[3];
+            for (size_t k = 0; k < m_nsp; k++) {
+                resid[3] += m_hk[k] * m_wdot[k];
+            }
+        } else {
+            resid[3] = ydot[3];
+        }
+
+        // species
+        for (size_t k = 0; k < m_nsp; k++) {
+            resid[4+k] = rho * u * dYdz[k] - mw[k] * (m_wdot[k] + m_sdot[k])
+                         + Y[k] * mdot_surf;
+        }
+    } catch (...) {
+        m_residError = std::current_exception();
+        return -1;
+    }
+    return 1;
+}
+
+int PlugFlowReactor::getInitialConditions(const doublereal t0,
+                                          doublereal* const y,
+                                          doublereal* const ydot)
+{
+    // Solve the governing equations for the derivatives of the gas-phase
+    // variables. The derivatives of the coverages are zero.
+    copy(m_y.begin(), m_y.end(), y);
+    fill(ydot, ydot + neq_, 0.0);
+    updateState(t0, y);
+    double u = y[0];
+    double rho = y[1];
+    double T = y[3];
+    const double* Y = y + 4;
+    const vector_fp& mw = m_thermo->molecularWeights();
+    m_kin->getNetProductionRates(m_wdot.data());
+    double mdot_surf = evalSurfaces(y, 0);
+
+    if (m_energy) {
+        m_thermo->getPartialMolarEnthalpies(m_hk.data());
+        double hdot = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            hdot += m_hk[k] * m_wdot[k];
+        }
+        ydot[3] = - hdot / (rho * u * m_thermo->cp_mass());
+    }
+    double sigma = 0.0, dsigma = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        ydot[4+k] = (mw[k] * (m_wdot[k] + m_sdot[k]) - Y[k] * mdot_surf)
+                    / (rho * u);
+        sigma += Y[k] / mw[k];
+        dsigma += ydot[4+k] / mw[k];
+    }
+
+    // Eliminate rho' and P' from the continuity, momentum and state
+    // equations, which are linear in u', rho' and P'
+    double c = GasConstant * T * sigma; // P / rho
+    double S1 = mdot_surf - rho * u * dAdz(t0) / area(t0);
+    double S2 = - u * mdot_surf;
+    double S3 = GasConstant * rho * (sigma * ydot[3] + T * dsigma);
+    ydot[0] = (S3 - S2 + c * S1 / u) / (rho * (c / u - u));
+    ydot[1] = (S1 - rho * ydot[0]) / u;
+    ydot[2] = S2 - rho * u * ydot[0];
+    return 1;
+}
+
+}
@@ -20,7 +20,9 @@ Reactor::Reactor() :
     m_Q(0.0),
     m_mass(0.0),
     m_chem(false),
+    m_coupled(true),
     m_energy(true),
+    m_tempState(false),
     m_nv(0),
     m_nsens(npos)
 {}
@@ -47,8 +49,13 @@ void Reactor::getState(double* y)
     // set the second component to the total volume
     y[1] = m_vol;
 
-    // set the third component to the total internal energy
-    y[2] = m_thermo->intEnergy_mass() * m_mass;
+    // set the third component to the temperature or the total internal
+    // energy
+    if (m_tempState) {
+        y[2] = m_thermo->temperature();
+    } else {
+        y[2] = m_thermo->intEnergy_mass() * m_mass;
+    }
 
     // set components y+3 ... y+K+2 to the mass fractions of each species
     m_thermo->getMassFractions(y+3);
@@ -79,6 +86,8 @@ void Reactor::initialize(doublereal t0)
     m_thermo->restoreState(m_state);
     m_sdot.resize(m_nsp, 0.0);
     m_wdot.resize(m_nsp, 0.0);
+    m_uk.resize(m_nsp, 0.0);
+    m_vk.resize(m_nsp, 0.0);
     m_nv = m_nsp + 3;
     for (size_t w = 0; w < m_wall.size(); w++) {
         if (m_wall[w]->surface(m_lr[w])) {
@@ -108,6 +117,7 @@ void Reactor::initialize(doublereal t0)
     }
     m_work.resize(maxnt);
     std::sort(m_pnum.begin(), m_pnum.end());
+    std::sort(m_sensSpecies.begin(), m_sensSpecies.end());
 }
 
 size_t Reactor::nSensParams()
@@ -115,7 +125,7 @@ size_t Reactor::nSensParams()
     if (m_nsens == npos) {
         // determine the number of sensitivity parameters
         size_t m, ns;
-        m_nsens = m_pnum.size();
+        m_nsens = m_pnum.size() + m_sensSpecies.size();
         for (m = 0; m < m_wall.size(); m++) {
             ns = m_wall[m]->nSensParams(m_lr[m]);
             m_nsens_wall.push_back(ns);
@@ -125,6 +135,16 @@ size_t Reactor::nSensParams()
     return m_nsens;
 }
 
+void Reactor::setTemperatureState(bool tstate)
+{
+    m_tempState = tstate;
+    if (m_net) {
+        // The number of state variables is unchanged, but their values
+        // need to be recomputed
+        m_net->setNeedsReinit();
+    }
+}
+
 void Reactor::syncState()
 {
     ReactorBase::syncState();
@@ -134,13 +154,16 @@ void Reactor::syncState()
 void Reactor::updateState(doublereal* y)
 {
     // The components of y are [0] the total mass, [1] the total volume,
-    // [2] the total internal energy, [3...K+3] are the mass fractions of each
-    // species, and [K+3...] are the coverages of surface species on each wall.
+    // [2] the total internal energy or the temperature, [3...K+3] are the
+    // mass fractions of each species, and [K+3...] are the coverages of
+    // surface species on each wall.
     m_mass = y[0];
     m_vol = y[1];
     m_thermo->setMassFractions_NoNorm(y+3);
 
-    if (m_energy) {
+    if (m_tempState) {
+        m_thermo->setState_TR(y[2], m_mass / m_vol);
+    } else if (m_energy) {
         // Use a damped Newton's method to determine the mixture temperature.
         // Tight tolerances are required both for Jacobian evaluation and for
         // sensitivity analysis to work correctly.
@@ -237,30 +260,61 @@ void Reactor::evalEqs(doublereal time, doublereal* y,
         ydot[2] = 0.0;
     }
 
-    // add terms for outlets
-    for (size_t i = 0; i < m_outlet.size(); i++) {
-        double mdot_out = m_outlet[i]->massFlowRate(time);
-        dmdt -= mdot_out; // mass flow out of system
-        if (m_energy) {
-            ydot[2] -= mdot_out * m_enthalpy;
+    // The inlets and outlets are omitted while the reaction terms are
+    // integrated separately (see disableCoupling())
+    if (m_coupled) {
+        // add terms for outlets
+        for (size_t i = 0; i < m_outlet.size(); i++) {
+            double mdot_out = m_outlet[i]->massFlowRate(time);
+            dmdt -= mdot_out; // mass flow out of system
+            if (m_energy) {
+                ydot[2] -= mdot_out * m_enthalpy;
+            }
         }
-    }
 
-    // add terms for inlets
-    for (size_t i = 0; i < m_inlet.size(); i++) {
-        double mdot_in = m_inlet[i]->massFlowRate(time);
-        dmdt += mdot_in; // mass flow into system
-        for (size_t n = 0; n < m_nsp; n++) {
-            double mdot_spec = m_inlet[i]->outletSpeciesMassFlowRate(n);
-            // flow of species into system and dilution by other species
-            dYdt[n] += (mdot_spec - mdot_in * Y[n]) / m_mass;
-        }
-        if (m_energy) {
-            ydot[2] += mdot_in * m_inlet[i]->enthalpy_mass();
+        // add terms for inlets
+        for (size_t i = 0; i < m_inlet.size(); i++) {
+            double mdot_in = m_inlet[i]->massFlowRate(time);
+            dmdt += mdot_in; // mass flow into system
+            for (size_t n = 0; n < m_nsp; n++) {
+                double mdot_spec = m_inlet[i]->outletSpeciesMassFlowRate(n);
+                // flow of species into system and dilution by other species
+                dYdt[n] += (mdot_spec - mdot_in * Y[n]) / m_mass;
+            }
+            if (m_energy) {
+                ydot[2] += mdot_in * m_inlet[i]->enthalpy_mass();
+            }
         }
     }
 
     ydot[0] = dmdt;
+
+    if (m_tempState && m_energy) {
+        // Convert dU/dt to dT/dt. With U = U(T, V, n_k),
+        //     dU/dt = m c_v dT/dt + (dU/dV) dV/dt + sum_k (dU/dn_k) dn_k/dt
+        // where the derivatives of U with respect to V and n_k at constant T
+        // are related to the partial molar properties by
+        //     dU/dV = T dP/dT - P,   dU/dn_k = u_k - (dU/dV) v_k
+        // and dP/dT at constant volume is beta / kappa.
+        double dPdT = m_thermo->thermalExpansionCoeff()
+                      / m_thermo->isothermalCompressibility();
+        double P = m_thermo->pressure();
+        double dUdV = temperature() * dPdT - P;
+        // u_k = h_k - P v_k. Some phases (e.g. MixtureFugacityTP) only
+        // return the reference state values from
+        // getPartialMolarIntEnergies(), for which sum_k n_k u_k != U.
+        m_thermo->getPartialMolarEnthalpies(m_uk.data());
+        m_thermo->getPartialMolarVolumes(m_vk.data());
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_uk[k] -= P * m_vk[k];
+        }
+        double mcvdTdt = ydot[2] - dUdV * m_vdot;
+        for (size_t k = 0; k < m_nsp; k++) {
+            double dndt = (dmdt * Y[k] + m_mass * dYdt[k]) / mw[k];
+            mcvdTdt -= (m_uk[k] - dUdV * m_vk[k]) * dndt;
+        }
+        ydot[2] = mcvdTdt / (m_mass * m_thermo->cv_mass());
+    }
     resetSensitivity(params);
 }
 
@@ -268,6 +322,9 @@ void Reactor::evalWalls(double t)
 {
     m_vdot = 0.0;
     m_Q = 0.0;
+    if (!m_coupled) {
+        return;
+    }
     for (size_t i = 0; i < m_wall.size(); i++) {
         int lr = 1 - 2*m_lr[i];
         m_vdot += lr*m_wall[i]->vdot(t);
@@ -324,6 +381,79 @@ void Reactor::addSensitivityReaction(size_t rxn)
     m_mult_save.push_back(1.0);
 }
 
+void Reactor::addSensitivitySpeciesEnthalpy(size_t k)
+{
+    if (k >= m_thermo->nSpecies()) {
+        throw CanteraError("Reactor::addSensitivitySpeciesEnthalpy",
+                           "Species index out of range ({})", k);
+    }
+
+    // Within the parameters of this reactor, the enthalpies follow the
+    // reactions
+    size_t nr = m_kin ? m_kin->nReactions() : 0;
+    network().registerSensitivityReaction(this, nr + k,
+        name() + ": " + m_thermo->speciesName(k) + " enthalpy");
+    m_sensSpecies.push_back(k);
+    m_hf298_save.push_back(0.0);
+}
+
+void Reactor::evalParameterAdjoint(double t, double* y, double* params,
+                                   const double* lambda, double* out)
+{
+    evalParameterAdjointFD(t, y, params, lambda, out, 0);
+}
+
+void Reactor::evalParameterAdjointFD(double t, double* y, double* params,
+                                     const double* lambda, double* out,
+                                     size_t start)
+{
+    size_t np = nSensParams();
+    if (start >= np) {
+        return;
+    }
+    m_adjYdot.resize(2 * m_nv);
+    double* ydot0 = m_adjYdot.data();
+    double* ydot1 = ydot0 + m_nv;
+    m_adjParams.assign(params, params + np);
+    evalEqs(t, y, ydot0, m_adjParams.data());
+    for (size_t j = start; j < np; j++) {
+        double p = m_adjParams[j];
+        double dp = sqrt(DBL_EPSILON) * std::max(fabs(p), 1.0);
+        m_adjParams[j] = p + dp;
+        evalEqs(t, y, ydot1, m_adjParams.data());
+        m_adjParams[j] = p;
+        double sum = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            sum += lambda[i] * (ydot1[i] - ydot0[i]);
+        }
+        out[j] = sum / dp;
+    }
+}
+
+void Reactor::getReactionAdjoint(double* params, const double* a,
+                                 double* out)
+{
+    size_t npar = m_pnum.size();
+    if (!m_chem) {
+        std::fill(out, out + npar, 0.0);
+        return;
+    }
+    // The rates of progress are proportional to the multipliers, so the
+    // derivative of the production rates with respect to parameter n is the
+    // net stoichiometric coefficient times the rate of progress divided by
+    // the multiplier.
+    size_t nr = m_kin->nReactions();
+    vector_fp ropnet(nr), delta(nr);
+    m_thermo->restoreState(m_state);
+    applySensitivity(params);
+    m_kin->getNetRatesOfProgress(ropnet.data());
+    resetSensitivity(params);
+    m_kin->getReactionDelta(a, delta.data());
+    for (size_t n = 0; n < npar; n++) {
+        out[n] = delta[m_pnum[n]] * ropnet[m_pnum[n]] / params[n];
+    }
+}
+
 std::vector<std::pair<void*, int> > Reactor::getSensitivityOrder() const
 {
     std::vector<std::pair<void*, int> > order;
@@ -381,7 +511,9 @@ size_t Reactor::componentIndex(const string& nm) const
                 "disabled after Cantera 2.3. Use 'volume' instead.");
         }
         return 1;
-    } else if (nm == "U" || nm == "int_energy") {
+    } else if (m_tempState && nm == "temperature") {
+        return 2;
+    } else if (!m_tempState && (nm == "U" || nm == "int_energy")) {
         if (nm == "U") {
             warn_deprecated("Reactor::componentIndex(\"U\")",
                 "Using the name 'U' for internal energy is deprecated, and "
@@ -404,6 +536,23 @@ void Reactor::applySensitivity(double* params)
         m_kin->setMultiplier(m_pnum[n], mult*params[n]);
     }
     size_t ploc = npar;
+    bool modified = false;
+    for (size_t n = 0; n < m_sensSpecies.size(); n++) {
+        // Only modify the thermo data if the parameter differs from its
+        // nominal value, so that the cached properties remain valid otherwise
+        double p = params[ploc + n];
+        if (p != 1.0) {
+            size_t k = m_sensSpecies[n];
+            m_hf298_save[n] = m_thermo->Hf298SS(static_cast<int>(k));
+            m_thermo->modifyOneHf298SS(k, m_hf298_save[n]
+                                          + (p - 1.0) * GasConstant * 298.15);
+            modified = true;
+        }
+    }
+    if (modified) {
+        m_kin->invalidateCache();
+    }
+    ploc += m_sensSpecies.size();
     for (size_t m = 0; m < m_wall.size(); m++) {
         if (m_nsens_wall[m] > 0) {
             m_wall[m]->setSensitivityParameters(m_lr[m], params + ploc);
@@ -424,6 +573,17 @@ void Reactor::resetSensitivity(double* params)
         m_kin->setMultiplier(m_pnum[n], mult/params[n]);
     }
     size_t ploc = npar;
+    bool modified = false;
+    for (size_t n = 0; n < m_sensSpecies.size(); n++) {
+        if (params[ploc + n] != 1.0) {
+            m_thermo->modifyOneHf298SS(m_sensSpecies[n], m_hf298_save[n]);
+            modified = true;
+        }
+    }
+    if (modified) {
+        m_kin->invalidateCache();
+    }
+    ploc += m_sensSpecies.size();
     for (size_t m = 0; m < m_wall.size(); m++) {
         if (m_nsens_wall[m] > 0) {
             m_wall[m]->resetSensitivityParameters(m_lr[m]);
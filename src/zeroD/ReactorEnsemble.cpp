@@ -0,0 +1,293 @@
+//! @file ReactorEnsemble.cpp
+
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/base/xml.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+
+//! Guards the construction of objects from the shared XML tree, which may
+//! also be used by ensembles created from the same input file
+std::mutex ensembleSetupMutex;
+
+const double NaN = numeric_limits<double>::quiet_NaN();
+
+}
+
+ReactorEnsemble::ReactorEnsemble(const std::string& infile,
+                                 const std::string& phaseid) :
+    m_phaseNode(0),
+    m_reactorType("IdealGasReactor"),
+    m_tend(1.0),
+    m_rtol(1.0e-9),
+    m_atol(1.0e-15),
+    m_maxstep(0.0),
+    m_criterion(TemperatureRise),
+    m_criterionValue(400.0),
+    m_criterionSpecies(npos),
+    m_nthreads(0),
+    m_nsp(0),
+    m_next(0)
+{
+    unique_lock<mutex> lock(ensembleSetupMutex);
+    XML_Node* root = get_XML_File(infile);
+    m_phaseNode = findXMLPhase(root, phaseid);
+    if (!m_phaseNode) {
+        throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+            "Couldn't find phase named '{}' in file '{}'.", phaseid, infile);
+    }
+    unique_ptr<ThermoPhase> thermo(newPhase(*m_phaseNode));
+    m_nsp = thermo->nSpecies();
+    m_speciesNames = thermo->speciesNames();
+}
+
+void ReactorEnsemble::setReactorType(const std::string& type)
+{
+    unique_ptr<ReactorBase> r(newReactor(type));
+    if (!dynamic_cast<Reactor*>(r.get())) {
+        throw CanteraError("ReactorEnsemble::setReactorType",
+            "'{}' is not a type of Reactor.", type);
+    }
+    m_reactorType = type;
+}
+
+void ReactorEnsemble::setEndTime(double tend)
+{
+    if (tend <= 0.0) {
+        throw CanteraError("ReactorEnsemble::setEndTime",
+                           "End time must be positive. Got {}.", tend);
+    }
+    m_tend = tend;
+}
+
+void ReactorEnsemble::setTolerances(double rtol, double atol)
+{
+    if (rtol >= 0.0) {
+        m_rtol = rtol;
+    }
+    if (atol >= 0.0) {
+        m_atol = atol;
+    }
+}
+
+void ReactorEnsemble::setIgnitionCriterion(const std::string& type,
+                                           double value,
+                                           const std::string& species)
+{
+    if (type == "temperature-rise") {
+        if (value <= 0.0) {
+            throw CanteraError("ReactorEnsemble::setIgnitionCriterion",
+                "Temperature rise must be positive. Got {}.", value);
+        }
+        m_criterion = TemperatureRise;
+        m_criterionValue = value;
+    } else if (type == "max-dTdt") {
+        m_criterion = MaxTemperatureSlope;
+    } else if (type == "max-species") {
+        auto iter = find(m_speciesNames.begin(), m_speciesNames.end(),
+                         species);
+        if (iter == m_speciesNames.end()) {
+            throw CanteraError("ReactorEnsemble::setIgnitionCriterion",
+                               "Unknown species '{}'.", species);
+        }
+        m_criterion = MaxSpecies;
+        m_criterionSpecies = iter - m_speciesNames.begin();
+    } else {
+        throw CanteraError("ReactorEnsemble::setIgnitionCriterion",
+                           "Unknown ignition criterion '{}'.", type);
+    }
+}
+
+void ReactorEnsemble::setOutputTimes(const vector_fp& times)
+{
+    for (size_t i = 0; i < times.size(); i++) {
+        if (times[i] < 0.0 || (i > 0 && times[i] <= times[i-1])) {
+            throw CanteraError("ReactorEnsemble::setOutputTimes",
+                "Output times must be non-negative and increasing.");
+        }
+    }
+    m_outputTimes = times;
+}
+
+void ReactorEnsemble::setInitialStates(size_t n, const double* T,
+                                       const double* P, const double* X)
+{
+    m_T0.assign(T, T + n);
+    m_P0.assign(P, P + n);
+    m_X0.assign(X, X + n * m_nsp);
+    m_ignitionDelays.clear();
+    m_finalStates.clear();
+    m_histories.clear();
+    m_errors.clear();
+}
+
+size_t ReactorEnsemble::nFailures() const
+{
+    size_t n = 0;
+    for (const auto& msg : m_errors) {
+        n += !msg.empty();
+    }
+    return n;
+}
+
+void ReactorEnsemble::solve()
+{
+    if (!m_outputTimes.empty() && m_outputTimes.back() > m_tend) {
+        throw CanteraError("ReactorEnsemble::solve", "Output time {} is "
+            "later than the end time {}.", m_outputTimes.back(), m_tend);
+    }
+    size_t n = nCases();
+    m_ignitionDelays.assign(n, NaN);
+    m_finalStates.assign(n * stateSize(), NaN);
+    m_histories.assign(n * m_outputTimes.size() * stateSize(), NaN);
+    m_errors.assign(n, "");
+    m_next = 0;
+
+    size_t nthreads = m_nthreads;
+    if (nthreads == 0) {
+        nthreads = std::max<size_t>(thread::hardware_concurrency(), 1);
+    }
+    nthreads = std::min(nthreads, n);
+
+    // Errors which are not specific to a single case, e.g. in setting up the
+    // objects used by a worker thread, are rethrown after all threads finish
+    vector<exception_ptr> errors(nthreads);
+    vector<thread> workers;
+    for (size_t i = 0; i < nthreads; i++) {
+        workers.emplace_back([this, &errors, i]() {
+            try {
+                runWorker();
+            } catch (...) {
+                errors[i] = current_exception();
+                m_next = nCases(); // stop the other threads
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (auto& err : errors) {
+        if (err) {
+            rethrow_exception(err);
+        }
+    }
+}
+
+void ReactorEnsemble::runWorker()
+{
+    // Objects used by this thread, in the order in which they need to be
+    // destroyed
+    unique_ptr<ThermoPhase> thermo;
+    unique_ptr<Kinetics> kin;
+    unique_ptr<ReactorBase> reactor;
+    {
+        unique_lock<mutex> lock(ensembleSetupMutex);
+        thermo.reset(newPhase(*m_phaseNode));
+        vector<ThermoPhase*> phases{thermo.get()};
+        kin.reset(newKineticsMgr(*m_phaseNode, phases));
+        reactor.reset(newReactor(m_reactorType));
+    }
+    Reactor& r = dynamic_cast<Reactor&>(*reactor);
+    r.setThermoMgr(*thermo);
+    r.setKineticsMgr(*kin);
+    ReactorNet net;
+    net.addReactor(r);
+    net.setTolerances(m_rtol, m_atol);
+    net.setMaxTimeStep(m_maxstep);
+
+    size_t nstate = stateSize();
+    size_t ntimes = m_outputTimes.size();
+    vector_fp state(nstate), prev(nstate);
+    auto getState = [&](double* s) {
+        s[0] = thermo->temperature();
+        s[1] = thermo->pressure();
+        thermo->getMassFractions(s + 2);
+    };
+
+    while (true) {
+        size_t i = m_next++;
+        if (i >= nCases()) {
+            break;
+        }
+        double* history = m_histories.data() + i * ntimes * nstate;
+        try {
+            thermo->setState_TPX(m_T0[i], m_P0[i], &m_X0[i * m_nsp]);
+            r.syncState();
+            net.setInitialTime(0.0);
+
+            double t = 0.0, tprev = 0.0;
+            double best = 0.0;
+            double tig = NaN;
+            if (m_criterion == MaxSpecies) {
+                best = thermo->moleFraction(m_criterionSpecies);
+            }
+            getState(state.data());
+            size_t nout = 0;
+            while (nout < ntimes && m_outputTimes[nout] == 0.0) {
+                copy(state.begin(), state.end(), history + nout++ * nstate);
+            }
+
+            while (t < m_tend) {
+                prev = state;
+                tprev = t;
+                t = net.step();
+                getState(state.data());
+
+                if (m_criterion == TemperatureRise) {
+                    double Tig = m_T0[i] + m_criterionValue;
+                    if (std::isnan(tig) && state[0] >= Tig) {
+                        tig = tprev + (t - tprev) * (Tig - prev[0])
+                                      / (state[0] - prev[0]);
+                    }
+                } else if (m_criterion == MaxTemperatureSlope) {
+                    double slope = (state[0] - prev[0]) / (t - tprev);
+                    if (slope > best) {
+                        best = slope;
+                        tig = 0.5 * (t + tprev);
+                    }
+                } else {
+                    double x = thermo->moleFraction(m_criterionSpecies);
+                    if (x > best) {
+                        best = x;
+                        tig = t;
+                    }
+                }
+
+                // Interpolate the saved states between the time steps
+                while (nout < ntimes && m_outputTimes[nout] <= t) {
+                    double w = (m_outputTimes[nout] - tprev) / (t - tprev);
+                    double* s = history + nout++ * nstate;
+                    for (size_t k = 0; k < nstate; k++) {
+                        s[k] = prev[k] + w * (state[k] - prev[k]);
+                    }
+                }
+            }
+
+            // The last step generally passes the end time
+            net.advance(m_tend);
+            getState(&m_finalStates[i * nstate]);
+            m_ignitionDelays[i] = (tig <= m_tend) ? tig : NaN;
+        } catch (std::exception& err) {
+            m_errors[i] = err.what();
+            m_ignitionDelays[i] = NaN;
+            fill(history, history + ntimes * nstate, NaN);
+        }
+    }
+}
+
+}
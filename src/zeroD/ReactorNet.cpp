@@ -1,21 +1,161 @@
 //! @file ReactorNet.cpp
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/FlowDevice.h"
+#include "cantera/zeroD/flowControllers.h"
 #include "cantera/zeroD/Wall.h"
+#include "cantera/numerics/SparseMatrix.h"
 
+#include <atomic>
+#include <cfloat>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <thread>
 
 using namespace std;
 
 namespace Cantera
 {
 
+namespace
+{
+
+const uint32_t checkpointMagic = 0x4b434e52; // "RNCK"
+const uint32_t checkpointVersion = 1;
+
+template <class T>
+void writeValue(std::string& data, const T& value)
+{
+    data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+T readValue(const std::string& data, size_t& pos)
+{
+    if (pos + sizeof(T) > data.size()) {
+        throw CanteraError("ReactorNet::restoreCheckpoint",
+                           "Checkpoint data is truncated.");
+    }
+    T value;
+    memcpy(&value, data.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+//! Number of time steps between the checkpoints saved for the adjoint
+//! equations
+const int adjointCheckpointSteps = 100;
+
+//! The integrand of a functional which is the integral of one component of
+//! the state vector
+class ComponentIntegrand : public AdjointIntegrand
+{
+public:
+    ComponentIntegrand(size_t k, size_t nv) : m_k(k), m_nv(nv) {}
+
+    virtual double eval(double t, const double* y) {
+        return y[m_k];
+    }
+
+    virtual void getGradient(double t, const double* y, double* dgdy) {
+        std::fill(dgdy, dgdy + m_nv, 0.0);
+        dgdy[m_k] = 1.0;
+    }
+
+protected:
+    size_t m_k, m_nv;
+};
+
+//! Maximum number of explicit steps taken by ReactorNet::advanceCoupling()
+const int maxCouplingSteps = 100000;
+
+}
+
+//! Integrator for the reaction terms of a single reactor, used by ReactorNet
+//! in the operator-split mode. The terms due to walls and flow devices are
+//! disabled while the reactor is integrated.
+class ReactorChemistry : public FuncEval
+{
+public:
+    ReactorChemistry(Reactor& r, double rtol, double atol, double maxstep,
+                     int maxErrTestFails, bool analyticJac) :
+        m_reactor(&r),
+        m_integ(newIntegrator("CVODE")),
+        m_init(false)
+    {
+        m_integ->setMethod(BDF_Method);
+        m_integ->setIterator(Newton_Iter);
+        bool analytic = analyticJac && r.hasChemistryJacobian();
+        m_integ->setProblemType(analytic ? DENSE + JAC : DENSE + NOJAC);
+        m_integ->setTolerances(rtol, atol);
+        m_integ->setMaxStepSize(maxstep);
+        m_integ->setMaxErrTestFails(maxErrTestFails);
+    }
+
+    virtual size_t neq() {
+        return m_reactor->neq();
+    }
+
+    virtual void getState(double* y) {
+        m_reactor->getState(y);
+    }
+
+    virtual void eval(double t, double* y, double* ydot, double* p) {
+        m_reactor->updateState(y);
+        m_reactor->evalEqs(t, y, ydot, nullptr);
+    }
+
+    //! With coupling disabled, the only nonzero terms of the Jacobian are the
+    //! reaction terms
+    virtual void evalJacobian(double t, double* y, double* ydot, double* p,
+                              Array2D* j) {
+        m_reactor->updateState(y);
+        m_reactor->getChemistryJacobian(nullptr, *j);
+    }
+
+    //! Integrate the reaction terms from time *t* to *t* + *dt*, starting
+    //! from the current state of the reactor, and set the state of the
+    //! reactor to the result.
+    void advance(double t, double dt) {
+        if (!m_reactor->chemistryEnabled()) {
+            return;
+        }
+        m_reactor->disableCoupling();
+        try {
+            if (m_init) {
+                m_integ->reinitialize(t, *this);
+            } else {
+                m_integ->initialize(t, *this);
+                m_init = true;
+            }
+            m_integ->integrate(t + dt);
+            m_reactor->updateState(m_integ->solution());
+        } catch (...) {
+            m_reactor->enableCoupling();
+            throw;
+        }
+        m_reactor->enableCoupling();
+    }
+
+protected:
+    Reactor* m_reactor;
+    std::unique_ptr<Integrator> m_integ;
+    bool m_init;
+};
+
 ReactorNet::ReactorNet() :
     m_integ(0), m_time(0.0), m_init(false), m_integrator_init(false),
-    m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4),
+    m_solutionGeneration(0), m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4),
     m_atols(1.0e-15), m_atolsens(1.0e-4),
     m_maxstep(0.0), m_maxErrTestFails(0),
-    m_verbose(false), m_ntotpar(0)
+    m_verbose(false), m_ntotpar(0), m_linearSolverType("DENSE"),
+    m_analyticJac(false), m_lastEvent(npos), m_split(false),
+    m_splitStep(1.0e-4), m_splitDt(1.0e-4), m_splitRtol(1.0e-6),
+    m_splitAtol(1.0e-12), m_splitCheckInterval(0), m_splitSteps(0),
+    m_splitError(numeric_limits<double>::quiet_NaN()), m_couplingStep(0.0),
+    m_nthreads(0)
 {
     m_integ = newIntegrator("CVODE");
 
@@ -31,6 +171,31 @@ ReactorNet::~ReactorNet()
     delete m_integ;
 }
 
+void ReactorNet::setLinearSolverType(const std::string& type)
+{
+    if (type == "DENSE") {
+        m_integ->setProblemType(m_analyticJac ? DENSE + JAC : DENSE + NOJAC);
+    } else if (type == "SPARSE") {
+        m_integ->setProblemType(SPARSE);
+    } else if (type == "GMRES") {
+        m_integ->setProblemType(GMRES + JAC);
+    } else {
+        throw CanteraError("ReactorNet::setLinearSolverType",
+                           "Unknown linear solver type '{}'", type);
+    }
+    m_linearSolverType = type;
+    m_init = false;
+}
+
+void ReactorNet::setAnalyticJacobian(bool analytic)
+{
+    m_analyticJac = analytic;
+    if (m_linearSolverType == "DENSE") {
+        m_integ->setProblemType(analytic ? DENSE + JAC : DENSE + NOJAC);
+    }
+    m_init = false;
+}
+
 void ReactorNet::initialize()
 {
     size_t n, nv;
@@ -42,6 +207,7 @@ void ReactorNet::initialize()
     }
     size_t sensParamNumber = 0;
     m_start.assign(1, 0);
+    m_nparams.clear();
     for (n = 0; n < m_reactors.size(); n++) {
         Reactor& r = *m_reactors[n];
         r.initialize(m_time);
@@ -66,6 +232,21 @@ void ReactorNet::initialize()
         }
     }
 
+    // The heat transfer coefficients follow the parameters of the reactors
+    for (Wall* w : m_sensWalls) {
+        if (find(m_reactors.begin(), m_reactors.end(), &w->left())
+                == m_reactors.end() &&
+            find(m_reactors.begin(), m_reactors.end(), &w->right())
+                == m_reactors.end()) {
+            throw CanteraError("ReactorNet::initialize", "A wall whose heat"
+                " transfer coefficient is a sensitivity parameter is not "
+                "installed next to a reactor in this network.");
+        }
+        size_t p = m_sensOrder[{w, 2}][0];
+        m_sensIndex.resize(std::max(p + 1, m_sensIndex.size()));
+        m_sensIndex[p] = sensParamNumber++;
+    }
+
     m_ydot.resize(m_nv,0.0);
     m_atol.resize(neq());
     fill(m_atol.begin(), m_atol.end(), m_atols);
@@ -77,16 +258,49 @@ void ReactorNet::initialize()
         writelog("Number of equations: {:d}\n", neq());
         writelog("Maximum time step:   {:14.6g}\n", m_maxstep);
     }
+    for (ReactorEvent* event : m_events) {
+        auto iter = find(m_reactors.begin(), m_reactors.end(),
+                         &event->reactor());
+        if (iter == m_reactors.end()) {
+            throw CanteraError("ReactorNet::initialize", "Reactor '{}' used "
+                "by an event is not part of this network.",
+                event->reactor().name());
+        }
+        size_t k = npos;
+        if (!event->component().empty()) {
+            k = (*iter)->componentIndex(event->component());
+            if (k == npos) {
+                throw CanteraError("ReactorNet::initialize", "Component '{}'"
+                    " used by an event is not part of the state of reactor "
+                    "'{}'.", event->component(), (*iter)->name());
+            }
+            k += m_start[iter - m_reactors.begin()];
+        }
+        event->setStateIndex(k);
+        event->clearTimes();
+    }
+    if (m_split) {
+        initSplitting();
+    }
     m_integ->initialize(m_time, *this);
     m_integrator_init = true;
     m_init = true;
+    m_solutionGeneration++;
 }
 
 void ReactorNet::reinitialize()
 {
     if (m_init) {
         debuglog("Re-initializing reactor network.\n", m_verbose);
+        for (ReactorEvent* event : m_events) {
+            event->clearTimes();
+        }
         m_integ->reinitialize(m_time, *this);
+        if (m_split) {
+            getState(m_splitY.data());
+            m_splitDt = m_splitStep;
+            m_splitSteps = 0;
+        }
         m_integrator_init = true;
     } else {
         initialize();
@@ -100,9 +314,21 @@ void ReactorNet::advance(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
-    m_integ->integrate(time);
-    m_time = time;
-    updateState(m_integ->solution());
+    m_lastEvent = npos;
+    if (m_split) {
+        while (m_time < time) {
+            splitStep(time);
+        }
+        return;
+    }
+    while (true) {
+        m_integ->integrate(time);
+        m_time = m_integ->currentTime();
+        updateState(m_integ->solution());
+        if (!m_integ->rootFound() || handleEvents()) {
+            break;
+        }
+    }
 }
 
 double ReactorNet::step(doublereal time)
@@ -116,11 +342,435 @@ double ReactorNet::step(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
+    m_lastEvent = npos;
+    if (m_split) {
+        splitStep(m_time + m_splitDt);
+        return m_time;
+    }
     m_time = m_integ->step(m_time + 1.0);
     updateState(m_integ->solution());
+    if (m_integ->rootFound()) {
+        handleEvents();
+    }
     return m_time;
 }
 
+void ReactorNet::setSplitTimeStep(double dt)
+{
+    if (dt <= 0.0) {
+        throw CanteraError("ReactorNet::setSplitTimeStep",
+                           "Time step must be positive. Got {}.", dt);
+    }
+    m_splitStep = dt;
+    m_splitDt = dt;
+}
+
+void ReactorNet::checkNotSplit(const std::string& method) const
+{
+    if (m_split) {
+        throw CanteraError("ReactorNet::" + method, "Not supported in the "
+                           "operator-split mode.");
+    }
+}
+
+void ReactorNet::initSplitting()
+{
+    if (m_ntotpar) {
+        throw CanteraError("ReactorNet::initSplitting", "Sensitivity "
+            "parameters are not supported in the operator-split mode.");
+    }
+    if (!m_events.empty()) {
+        throw CanteraError("ReactorNet::initSplitting",
+            "Events are not supported in the operator-split mode.");
+    }
+    size_t nr = m_reactors.size();
+    for (Reactor* r : m_reactors) {
+        if (r->type() == FlowReactorType) {
+            throw CanteraError("ReactorNet::initSplitting", "FlowReactors "
+                "are not supported in the operator-split mode.");
+        }
+        for (size_t i = 0; i < r->nWalls(); i++) {
+            Wall& w = r->wall(i);
+            if ((&w.left() == r && w.kinetics(0)) ||
+                (&w.right() == r && w.kinetics(1))) {
+                throw CanteraError("ReactorNet::initSplitting", "Surface "
+                    "reactions on walls are not supported in the "
+                    "operator-split mode.");
+            }
+        }
+    }
+
+    m_chemSolvers.clear();
+    for (Reactor* r : m_reactors) {
+        m_chemSolvers.emplace_back(new ReactorChemistry(*r, m_rtol, m_atols,
+            m_maxstep, m_maxErrTestFails, m_analyticJac));
+    }
+
+    // Reactors which share a ThermoPhase or Kinetics object can't be
+    // integrated concurrently, so merge them into groups
+    vector<size_t> root(nr);
+    iota(root.begin(), root.end(), 0);
+    auto findRoot = [&](size_t n) {
+        while (root[n] != n) {
+            n = root[n];
+        }
+        return n;
+    };
+    for (size_t i = 0; i < nr; i++) {
+        for (size_t j = 0; j < i; j++) {
+            Reactor& a = *m_reactors[i];
+            Reactor& b = *m_reactors[j];
+            if (&a.contents() == &b.contents() ||
+                &a.kinetics() == &b.kinetics()) {
+                root[findRoot(i)] = findRoot(j);
+            }
+        }
+    }
+    m_chemGroups.clear();
+    vector<size_t> group(nr, npos);
+    for (size_t n = 0; n < nr; n++) {
+        size_t r = findRoot(n);
+        if (group[r] == npos) {
+            group[r] = m_chemGroups.size();
+            m_chemGroups.emplace_back();
+        }
+        m_chemGroups[group[r]].push_back(n);
+    }
+
+    m_splitY.resize(m_nv);
+    getState(m_splitY.data());
+    m_splitDt = m_splitStep;
+    m_splitSteps = 0;
+    m_splitError = numeric_limits<double>::quiet_NaN();
+    m_couplingStep = 0.0;
+}
+
+void ReactorNet::splitStep(double tmax)
+{
+    double t0 = m_time;
+    m_splitY0 = m_splitY;
+    bool check = m_splitCheckInterval &&
+                 (++m_splitSteps % m_splitCheckInterval == 0);
+    double dt;
+    while (true) {
+        if (m_splitDt < 1e-8 * m_splitStep) {
+            throw CanteraError("ReactorNet::splitStep", "The splitting error "
+                "at t = {} can't be reduced below the tolerance. Reduce the "
+                "split time step, or disable the operator-split mode.", t0);
+        }
+        dt = std::min(m_splitDt, tmax - t0);
+
+        // Strang splitting: half step of the coupling terms, full step of
+        // the reaction terms, half step of the coupling terms
+        advanceCoupling(t0, 0.5 * dt);
+        advanceChemistry(t0, dt);
+        advanceCoupling(t0 + 0.5 * dt, 0.5 * dt);
+        if (!check) {
+            break;
+        }
+
+        // Compare with the monolithic solution of the same step
+        updateState(m_splitY0.data());
+        m_integ->reinitialize(t0, *this);
+        m_integ->integrate(t0 + dt);
+        const double* yref = m_integ->solution();
+        double err = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            double w = m_splitRtol * fabs(yref[i]) + m_splitAtol;
+            err += pow((m_splitY[i] - yref[i]) / w, 2);
+        }
+        err = sqrt(err / m_nv);
+        m_splitError = err;
+
+        // The local error of the Strang splitting is of third order in dt
+        double factor = 0.9 * pow(std::max(err, 1e-10), -1.0/3.0);
+        if (err <= 1.0) {
+            copy(yref, yref + m_nv, m_splitY.begin());
+            m_splitDt = std::min(m_splitStep, dt * std::min(factor, 2.0));
+            break;
+        }
+        m_splitDt = dt * std::max(factor, 0.2);
+        m_splitY = m_splitY0;
+    }
+    m_time = (dt == tmax - t0) ? tmax : t0 + dt;
+    updateState(m_splitY.data());
+}
+
+void ReactorNet::advanceCoupling(double t, double dt)
+{
+    // Disable the reaction terms in all of the reactors
+    vector<size_t> chem;
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        if (m_reactors[n]->chemistryEnabled()) {
+            m_reactors[n]->disableChemistry();
+            chem.push_back(n);
+        }
+    }
+
+    // Bogacki-Shampine method of order 3(2), with the first stage of each
+    // step given by the last stage of the previous step
+    double tend = t + dt;
+    double h = (m_couplingStep > 0.0) ? std::min(m_couplingStep, dt) : dt;
+    vector_fp& y = m_splitY;
+    m_rk1.resize(m_nv);
+    m_rk2.resize(m_nv);
+    m_rk3.resize(m_nv);
+    m_rk4.resize(m_nv);
+    m_rkY.resize(m_nv);
+    m_rkYnew.resize(m_nv);
+    try {
+        eval(t, y.data(), m_rk1.data(), nullptr);
+        int nsteps = 0;
+        while (t < tend) {
+            if (++nsteps > maxCouplingSteps) {
+                throw CanteraError("ReactorNet::advanceCoupling", "Too many "
+                    "steps integrating the coupling terms at t = {}. The "
+                    "flows between the reactors may be too fast for the "
+                    "operator-split mode.", t);
+            }
+            // The last step is shortened to end at tend
+            bool last = (h >= tend - t);
+            double hstep = last ? tend - t : h;
+            for (size_t i = 0; i < m_nv; i++) {
+                m_rkY[i] = y[i] + 0.5 * hstep * m_rk1[i];
+            }
+            eval(t + 0.5 * hstep, m_rkY.data(), m_rk2.data(), nullptr);
+            for (size_t i = 0; i < m_nv; i++) {
+                m_rkY[i] = y[i] + 0.75 * hstep * m_rk2[i];
+            }
+            eval(t + 0.75 * hstep, m_rkY.data(), m_rk3.data(), nullptr);
+            for (size_t i = 0; i < m_nv; i++) {
+                m_rkYnew[i] = y[i] + hstep * (2.0/9.0 * m_rk1[i] +
+                    1.0/3.0 * m_rk2[i] + 4.0/9.0 * m_rk3[i]);
+            }
+            eval(t + hstep, m_rkYnew.data(), m_rk4.data(), nullptr);
+
+            // Difference between the third and second order solutions
+            double err = 0.0;
+            for (size_t i = 0; i < m_nv; i++) {
+                double e = hstep * (-5.0/72.0 * m_rk1[i] + 1.0/12.0 * m_rk2[i]
+                                    + 1.0/9.0 * m_rk3[i] - 0.125 * m_rk4[i]);
+                double w = m_splitRtol * std::max(fabs(y[i]),
+                                                  fabs(m_rkYnew[i]))
+                           + m_splitAtol;
+                err += pow(e / w, 2);
+            }
+            err = sqrt(err / m_nv);
+            double factor = (err > 0.0) ? 0.9 * pow(err, -1.0/3.0) : 5.0;
+            factor = std::min(5.0, std::max(0.2, factor));
+            if (err <= 1.0) {
+                t = last ? tend : t + hstep;
+                y.swap(m_rkYnew);
+                m_rk1.swap(m_rk4);
+                if (last) {
+                    // Keep the step size for the next call, rather than
+                    // basing it on the shortened step
+                    break;
+                }
+            }
+            h = hstep * factor;
+        }
+    } catch (...) {
+        for (size_t n : chem) {
+            m_reactors[n]->enableChemistry();
+        }
+        updateState(y.data());
+        throw;
+    }
+    for (size_t n : chem) {
+        m_reactors[n]->enableChemistry();
+    }
+    m_couplingStep = h;
+    updateState(y.data());
+}
+
+void ReactorNet::advanceChemistry(double t, double dt)
+{
+    updateState(m_splitY.data());
+    size_t ngroups = m_chemGroups.size();
+    size_t nthreads = m_nthreads;
+    if (nthreads == 0) {
+        nthreads = std::max<size_t>(thread::hardware_concurrency(), 1);
+    }
+    nthreads = std::min(nthreads, ngroups);
+
+    // Each thread takes the next group of reactors until all are done. The
+    // calling thread is one of the workers.
+    atomic<size_t> next(0);
+    vector<exception_ptr> errors(nthreads);
+    auto work = [&](size_t i) {
+        try {
+            while (true) {
+                size_t g = next++;
+                if (g >= ngroups) {
+                    break;
+                }
+                for (size_t n : m_chemGroups[g]) {
+                    m_chemSolvers[n]->advance(t, dt);
+                }
+            }
+        } catch (...) {
+            errors[i] = current_exception();
+            next = ngroups; // stop the other threads
+        }
+    };
+    vector<thread> workers;
+    for (size_t i = 1; i < nthreads; i++) {
+        workers.emplace_back(work, i);
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (auto& err : errors) {
+        if (err) {
+            rethrow_exception(err);
+        }
+    }
+    getState(m_splitY.data());
+}
+
+std::string ReactorNet::saveCheckpoint()
+{
+    checkNotSplit("saveCheckpoint");
+    if (!m_init) {
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    std::string data;
+    writeValue(data, checkpointMagic);
+    writeValue(data, checkpointVersion);
+    writeValue(data, static_cast<uint64_t>(m_events.size()));
+    for (ReactorEvent* event : m_events) {
+        writeValue(data, static_cast<uint64_t>(event->times().size()));
+        for (double t : event->times()) {
+            writeValue(data, t);
+        }
+    }
+    data += m_integ->saveState();
+    return data;
+}
+
+void ReactorNet::restoreCheckpoint(const std::string& data)
+{
+    checkNotSplit("restoreCheckpoint");
+    if (!m_init) {
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    size_t pos = 0;
+    if (readValue<uint32_t>(data, pos) != checkpointMagic ||
+        readValue<uint32_t>(data, pos) != checkpointVersion) {
+        throw CanteraError("ReactorNet::restoreCheckpoint",
+                           "Invalid checkpoint data.");
+    }
+    size_t nevents = readValue<uint64_t>(data, pos);
+    if (nevents != m_events.size()) {
+        throw CanteraError("ReactorNet::restoreCheckpoint", "Checkpoint has "
+            "{} events, but the network has {}.", nevents, m_events.size());
+    }
+    vector<vector_fp> times(nevents);
+    for (auto& t : times) {
+        t.resize(readValue<uint64_t>(data, pos));
+        for (double& ti : t) {
+            ti = readValue<double>(data, pos);
+        }
+    }
+    m_integ->restoreState(data.substr(pos));
+
+    for (size_t i = 0; i < nevents; i++) {
+        m_events[i]->clearTimes();
+        for (double t : times[i]) {
+            m_events[i]->addTime(t);
+        }
+    }
+    m_lastEvent = npos;
+    m_time = m_integ->currentTime();
+    updateState(m_integ->solution());
+}
+
+const double* ReactorNet::solution()
+{
+    if (!m_init) {
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    return m_split ? m_splitY.data() : m_integ->solution();
+}
+
+void ReactorNet::addEvent(ReactorEvent& event)
+{
+    m_events.push_back(&event);
+    m_init = false;
+}
+
+bool ReactorNet::handleEvents()
+{
+    vector<int> roots(m_events.size());
+    m_integ->getRootInfo(roots.data());
+    for (size_t i = 0; i < m_events.size(); i++) {
+        if (roots[i]) {
+            m_events[i]->addTime(m_time);
+            if (m_events[i]->terminal() && m_lastEvent == npos) {
+                m_lastEvent = i;
+            }
+        }
+    }
+    return m_lastEvent != npos;
+}
+
+void ReactorNet::getRootDirections(int* directions)
+{
+    for (size_t i = 0; i < m_events.size(); i++) {
+        directions[i] = m_events[i]->direction();
+    }
+}
+
+void ReactorNet::evalRootFunctions(double t, double* y, double* g)
+{
+    // Nominal values of the sensitivity parameters
+    m_rootParams.assign(m_ntotpar, 1.0);
+    double* p = m_rootParams.empty() ? nullptr : m_rootParams.data();
+    m_rootYdot.resize(m_nv);
+    eval(t, y, m_rootYdot.data(), p);
+
+    bool second = false;
+    for (ReactorEvent* event : m_events) {
+        second |= event->needsSecondDerivatives();
+    }
+    if (second) {
+        // Approximate the second derivatives by perturbing the state along
+        // ydot, with a time step small enough that the largest relative
+        // change of any component is of order sqrt(epsilon)
+        double rate = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            rate = std::max(rate, fabs(m_rootYdot[i]) / (fabs(y[i]) + m_atol[i]));
+        }
+        m_rootYdot2.assign(m_nv, 0.0);
+        if (rate > 0.0) {
+            double h = sqrt(numeric_limits<double>::epsilon()) / rate;
+            m_rootY.resize(m_nv);
+            for (size_t i = 0; i < m_nv; i++) {
+                m_rootY[i] = y[i] + h * m_rootYdot[i];
+            }
+            eval(t + h, m_rootY.data(), m_rootYdot2.data(), p);
+            for (size_t i = 0; i < m_nv; i++) {
+                m_rootYdot2[i] = (m_rootYdot2[i] - m_rootYdot[i]) / h;
+            }
+            // restore the state of the reactors
+            updateState(y);
+        }
+    }
+
+    for (size_t i = 0; i < m_events.size(); i++) {
+        g[i] = m_events[i]->eval(t, y, m_rootYdot.data(),
+                                 m_rootYdot2.data());
+    }
+}
+
 void ReactorNet::addReactor(Reactor& r)
 {
     r.setNetwork(this);
@@ -133,14 +783,211 @@ void ReactorNet::eval(doublereal t, doublereal* y,
     size_t n;
     size_t pstart = 0;
     updateState(y);
-    for (n = 0; n < m_reactors.size(); n++) {
-        m_reactors[n]->evalEqs(t, y + m_start[n],
-                               ydot + m_start[n], p + pstart);
-        pstart += m_nparams[n];
+    applyWallSensitivity(p);
+    try {
+        for (n = 0; n < m_reactors.size(); n++) {
+            m_reactors[n]->evalEqs(t, y + m_start[n],
+                                   ydot + m_start[n], p + pstart);
+            pstart += m_nparams[n];
+        }
+    } catch (...) {
+        resetWallSensitivity(p);
+        throw;
     }
+    resetWallSensitivity(p);
     checkFinite("ydot", ydot, m_nv);
 }
 
+void ReactorNet::applyWallSensitivity(double* p)
+{
+    if (!p) {
+        return;
+    }
+    size_t pstart = m_ntotpar - m_sensWalls.size();
+    for (size_t i = 0; i < m_sensWalls.size(); i++) {
+        m_wallU[i] = m_sensWalls[i]->getHeatTransferCoeff();
+        m_sensWalls[i]->setHeatTransferCoeff(m_wallU[i] * p[pstart + i]);
+    }
+}
+
+void ReactorNet::resetWallSensitivity(double* p)
+{
+    if (!p) {
+        return;
+    }
+    for (size_t i = 0; i < m_sensWalls.size(); i++) {
+        m_sensWalls[i]->setHeatTransferCoeff(m_wallU[i]);
+    }
+}
+
+void ReactorNet::evalParameterAdjoint(double t, double* y, double* p,
+                                      const double* lambda, double* out)
+{
+    if (m_ntotpar == 0) {
+        return;
+    }
+    updateState(y);
+    size_t pstart = 0;
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_reactors[n]->evalParameterAdjoint(t, y + m_start[n], p + pstart,
+                                            lambda + m_start[n], out + pstart);
+        pstart += m_nparams[n];
+    }
+    if (m_sensWalls.empty()) {
+        return;
+    }
+
+    // The heat transfer coefficients affect the reactors on both sides of
+    // the walls, so differentiate the equations of the whole network
+    m_adjYdot.resize(2 * m_nv);
+    double* ydot0 = m_adjYdot.data();
+    double* ydot1 = ydot0 + m_nv;
+    eval(t, y, ydot0, p);
+    for (size_t j = pstart; j < m_ntotpar; j++) {
+        double pj = p[j];
+        double dp = sqrt(DBL_EPSILON) * std::max(fabs(pj), 1.0);
+        p[j] = pj + dp;
+        eval(t, y, ydot1, p);
+        p[j] = pj;
+        double sum = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            sum += lambda[i] * (ydot1[i] - ydot0[i]);
+        }
+        out[j] = sum / dp;
+    }
+}
+
+double ReactorNet::solveAdjoint(const std::string& type,
+                                const std::string& component, double tend,
+                                double* sens, double threshold,
+                                size_t reactor)
+{
+    checkNotSplit("solveAdjoint");
+    // Restart the integration from the current state
+    if (!m_init) {
+        initialize();
+    } else {
+        reinitialize();
+    }
+    if (reactor >= m_reactors.size()) {
+        throw IndexError("ReactorNet::solveAdjoint", "m_reactors", reactor,
+                         m_reactors.size() - 1);
+    }
+    size_t k = m_reactors[reactor]->componentIndex(component);
+    if (k == npos) {
+        throw CanteraError("ReactorNet::solveAdjoint", "Component '{}' is "
+            "not part of the state of reactor '{}'.", component,
+            m_reactors[reactor]->name());
+    }
+    k += m_start[reactor];
+    double t0 = m_time;
+    if (tend <= t0) {
+        throw CanteraError("ReactorNet::solveAdjoint", "End time {} must be "
+            "later than the current time {}.", tend, t0);
+    }
+
+    // Integrate forward, saving checkpoints, and find the value of the
+    // functional and the final values of the adjoint variables
+    m_integ->initAdjoint(adjointCheckpointSteps);
+    // If an error occurs, the integrator is reinitialized before continuing
+    m_integrator_init = false;
+    vector_fp lambda(m_nv, 0.0), y(m_nv), grad(m_ntotpar);
+    std::unique_ptr<ComponentIntegrand> integrand;
+    double value = 0.0;
+    double tfinal = tend;
+    if (type == "final" || type == "integral") {
+        m_integ->integrate(tend);
+        copy(m_integ->solution(), m_integ->solution() + m_nv, y.begin());
+        if (type == "final") {
+            value = y[k];
+            lambda[k] = 1.0;
+        } else {
+            integrand.reset(new ComponentIntegrand(k, m_nv));
+        }
+    } else if (type == "crossing") {
+        double ha = m_integ->solution()[k] - threshold;
+        if (ha == 0.0) {
+            throw CanteraError("ReactorNet::solveAdjoint", "Component '{}' "
+                "is already at the threshold value {}.", component, threshold);
+        }
+        double ta = t0, tb, hb;
+        while (true) {
+            tb = m_integ->step(tend);
+            hb = m_integ->solution()[k] - threshold;
+            if (ha * hb <= 0.0) {
+                break;
+            } else if (tb >= tend) {
+                throw CanteraError("ReactorNet::solveAdjoint", "Component "
+                    "'{}' does not reach the threshold value {} before time "
+                    "{}.", component, threshold, tend);
+            }
+            ta = tb;
+            ha = hb;
+        }
+        copy(m_integ->solution(), m_integ->solution() + m_nv, y.begin());
+
+        // Locate the crossing within the last time step using the
+        // interpolated solution and the Illinois variant of regula falsi
+        double tol = 1e-10 * (tb - ta);
+        for (int i = 0; i < 100 && hb != 0.0 && fabs(tb - ta) > tol; i++) {
+            double tc = (ta * hb - tb * ha) / (hb - ha);
+            m_integ->getInterpolatedSolution(tc, y.data());
+            double hc = y[k] - threshold;
+            if (hc * hb < 0.0) {
+                ta = tb;
+                ha = hb;
+            } else {
+                ha *= 0.5;
+            }
+            tb = tc;
+            hb = hc;
+        }
+        tfinal = tb;
+        if (tfinal > tend) {
+            throw CanteraError("ReactorNet::solveAdjoint", "Component '{}' "
+                "does not reach the threshold value {} before time {}.",
+                component, threshold, tend);
+        }
+
+        // The sensitivity of the crossing time follows from the sensitivity
+        // of the component at the crossing time and its rate of change
+        vector_fp ydot(m_nv), params(m_ntotpar, 1.0);
+        eval(tfinal, y.data(), ydot.data(),
+             params.empty() ? nullptr : params.data());
+        if (ydot[k] == 0.0) {
+            throw CanteraError("ReactorNet::solveAdjoint", "Component '{}' "
+                "is stationary at the threshold crossing.", component);
+        }
+        lambda[k] = -1.0 / ydot[k];
+        value = tfinal - t0;
+    } else {
+        throw CanteraError("ReactorNet::solveAdjoint",
+                           "Unknown functional type '{}'.", type);
+    }
+
+    double integral = m_integ->solveAdjoint(tfinal, lambda.data(),
+                                            integrand.get(), grad.data());
+    if (integrand) {
+        value = integral;
+    }
+
+    // Continue the integration from the end of the functional
+    m_time = tfinal;
+    updateState(y.data());
+    reinitialize();
+
+    if (value == 0.0) {
+        throw CanteraError("ReactorNet::solveAdjoint", "The '{}' functional "
+            "of component '{}' is zero, so the sensitivities can't be "
+            "normalized.", type, component);
+    }
+    // The gradient is in the order used by the integrator
+    for (size_t p = 0; p < m_ntotpar; p++) {
+        sens[p] = grad[m_sensIndex[p]] / value;
+    }
+    return value;
+}
+
 void ReactorNet::evalJacobian(doublereal t, doublereal* y,
                               doublereal* ydot, doublereal* p, Array2D* j)
 {
@@ -149,21 +996,293 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
 
     //evaluate the unperturbed ydot
     eval(t, y, ydot, p);
-    for (size_t n = 0; n < m_nv; n++) {
-        // perturb x(n)
-        ysave = y[n];
-        dy = m_atol[n] + fabs(ysave)*m_rtol;
-        y[n] = ysave + dy;
-        dy = y[n] - ysave;
 
-        // calculate perturbed residual
-        eval(t, y, m_ydot.data(), p);
+    // exclude the reaction terms which are differentiated analytically
+    double* ydot0 = ydot;
+    vector<size_t> analytic = disableAnalyticChemistry();
+    try {
+        if (!analytic.empty()) {
+            m_ydotNoChem.resize(m_nv);
+            eval(t, y, m_ydotNoChem.data(), p);
+            ydot0 = m_ydotNoChem.data();
+        }
+        for (size_t n = 0; n < m_nv; n++) {
+            // perturb x(n)
+            ysave = y[n];
+            dy = m_atol[n] + fabs(ysave)*m_rtol;
+            y[n] = ysave + dy;
+            dy = y[n] - ysave;
+
+            // calculate perturbed residual
+            eval(t, y, m_ydot.data(), p);
 
-        // compute nth column of Jacobian
-        for (size_t m = 0; m < m_nv; m++) {
-            jac(m,n) = (m_ydot[m] - ydot[m])/dy;
+            // compute nth column of Jacobian
+            for (size_t m = 0; m < m_nv; m++) {
+                jac(m,n) = (m_ydot[m] - ydot0[m])/dy;
+            }
+            y[n] = ysave;
+        }
+    } catch (...) {
+        enableAnalyticChemistry(analytic);
+        throw;
+    }
+    enableAnalyticChemistry(analytic);
+
+    if (!analytic.empty()) {
+        updateState(y);
+        for (size_t n : analytic) {
+            m_reactors[n]->getChemistryJacobian(p, m_chemJac);
+            size_t start = m_start[n];
+            for (size_t k = 0; k < m_chemJac.nColumns(); k++) {
+                for (size_t i = 0; i < m_chemJac.nRows(); i++) {
+                    jac(start + i, start + k) += m_chemJac(i, k);
+                }
+            }
+        }
+    }
+}
+
+vector<size_t> ReactorNet::disableAnalyticChemistry()
+{
+    vector<size_t> analytic;
+    bool gmres = (m_linearSolverType == "GMRES");
+    if (!m_analyticJac && !gmres) {
+        return analytic;
+    }
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        Reactor& r = *m_reactors[n];
+        bool skip = gmres ? (n < m_hasPrecond.size() && m_hasPrecond[n])
+                          : r.hasChemistryJacobian();
+        if (r.chemistryEnabled() && skip) {
+            r.disableChemistry();
+            analytic.push_back(n);
+        }
+    }
+    return analytic;
+}
+
+void ReactorNet::enableAnalyticChemistry(const vector<size_t>& reactors)
+{
+    for (size_t n : reactors) {
+        m_reactors[n]->enableChemistry();
+    }
+}
+
+void ReactorNet::findReactorDependencies()
+{
+    size_t nr = m_reactors.size();
+    map<const ReactorBase*, size_t> index;
+    for (size_t n = 0; n < nr; n++) {
+        index[m_reactors[n]] = n;
+    }
+    m_depends.assign(nr, vector<size_t>());
+    for (size_t n = 0; n < nr; n++) {
+        m_depends[n].push_back(n);
+    }
+
+    // Mark reactors a and b as depending on each other. Reservoirs and
+    // reactors from other networks have no state variables in this network.
+    auto connect = [&](const ReactorBase& a, const ReactorBase& b) {
+        auto ia = index.find(&a);
+        auto ib = index.find(&b);
+        if (ia != index.end() && ib != index.end()) {
+            m_depends[ia->second].push_back(ib->second);
+            m_depends[ib->second].push_back(ia->second);
+        }
+    };
+
+    for (size_t n = 0; n < nr; n++) {
+        Reactor& r = *m_reactors[n];
+        for (size_t i = 0; i < r.nWalls(); i++) {
+            Wall& w = r.wall(i);
+            connect(w.left(), w.right());
+        }
+        vector<FlowDevice*> devices;
+        for (size_t i = 0; i < r.nInlets(); i++) {
+            devices.push_back(&r.inlet(i));
+        }
+        for (size_t i = 0; i < r.nOutlets(); i++) {
+            devices.push_back(&r.outlet(i));
+        }
+        for (FlowDevice* dev : devices) {
+            connect(dev->in(), dev->out());
+            // The flow rate through a PressureController depends on the
+            // flow rate through its master device
+            FlowDevice* master = dev;
+            for (size_t depth = 0; depth < m_reactors.size() + 1; depth++) {
+                PressureController* pc = dynamic_cast<PressureController*>(master);
+                if (!pc || !pc->master()) {
+                    break;
+                }
+                master = pc->master();
+                connect(dev->in(), master->in());
+                connect(dev->in(), master->out());
+                connect(dev->out(), master->in());
+                connect(dev->out(), master->out());
+            }
+        }
+    }
+    for (auto& deps : m_depends) {
+        sort(deps.begin(), deps.end());
+        deps.erase(unique(deps.begin(), deps.end()), deps.end());
+    }
+
+    // Greedy distance-2 coloring of the reactor graph: two reactors can be
+    // perturbed together if no reactor depends on both of them.
+    vector<size_t> color(nr, npos);
+    m_jacGroups.clear();
+    vector<char> used;
+    for (size_t n = 0; n < nr; n++) {
+        used.assign(m_jacGroups.size(), 0);
+        for (size_t i : m_depends[n]) {
+            for (size_t j : m_depends[i]) {
+                if (color[j] != npos) {
+                    used[color[j]] = 1;
+                }
+            }
+        }
+        size_t c = find(used.begin(), used.end(), 0) - used.begin();
+        if (c == m_jacGroups.size()) {
+            m_jacGroups.emplace_back();
+        }
+        color[n] = c;
+        m_jacGroups[c].push_back(n);
+    }
+}
+
+void ReactorNet::getJacobianPattern(std::vector<std::vector<size_t>>& rows)
+{
+    findReactorDependencies();
+    bool gmres = (m_linearSolverType == "GMRES");
+    m_hasPrecond.assign(m_reactors.size(), 0);
+    rows.assign(m_nv, vector<size_t>());
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        size_t start = m_start[n];
+        if (gmres && m_reactors[n]->hasPreconditioner()) {
+            m_hasPrecond[n] = 1;
+            vector<vector<size_t>> local;
+            m_reactors[n]->getPreconditionerPattern(local);
+            for (size_t i = 0; i < local.size(); i++) {
+                for (size_t j : local[i]) {
+                    rows[start + i].push_back(start + j);
+                }
+            }
+            continue;
+        }
+        vector<size_t> cols;
+        for (size_t s : m_depends[n]) {
+            if (gmres && s != n) {
+                // only the diagonal blocks are used by the preconditioner
+                continue;
+            }
+            for (size_t j = m_start[s]; j < m_start[s+1]; j++) {
+                cols.push_back(j);
+            }
+        }
+        for (size_t i = m_start[n]; i < m_start[n+1]; i++) {
+            rows[i] = cols;
+        }
+    }
+}
+
+void ReactorNet::evalSparseJacobian(double t, double* y, double* ydot,
+                                    double* p, SparseMatrix& jac)
+{
+    size_t nvmax = 0;
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        nvmax = std::max(nvmax, m_start[n+1] - m_start[n]);
+    }
+    vector_fp ysave(m_nv), dy(m_nv);
+    jac.zero();
+
+    // With the "GMRES" linear solver, only the diagonal blocks are needed,
+    // and the blocks of the reactors which provide a preconditioner are not
+    // differentiated numerically at all
+    bool gmres = (m_linearSolverType == "GMRES");
+    bool numeric = !gmres || (std::find(m_hasPrecond.begin(),
+                                        m_hasPrecond.end(), 0)
+                              != m_hasPrecond.end());
+
+    // exclude the reaction terms which are differentiated analytically
+    double* ydot0 = ydot;
+    vector<size_t> analytic = disableAnalyticChemistry();
+    try {
+        if (!analytic.empty() && numeric) {
+            m_ydotNoChem.resize(m_nv);
+            eval(t, y, m_ydotNoChem.data(), p);
+            ydot0 = m_ydotNoChem.data();
+        }
+        for (const auto& group : m_jacGroups) {
+            if (!numeric) {
+                break;
+            }
+            for (size_t k = 0; k < nvmax; k++) {
+                // perturb the k-th variable of each reactor in the group
+                bool perturbed = false;
+                for (size_t s : group) {
+                    size_t j = m_start[s] + k;
+                    if (j < m_start[s+1] && !(gmres && m_hasPrecond[s])) {
+                        ysave[j] = y[j];
+                        y[j] = ysave[j] + m_atol[j] + fabs(ysave[j])*m_rtol;
+                        dy[j] = y[j] - ysave[j];
+                        perturbed = true;
+                    }
+                }
+                if (!perturbed) {
+                    continue;
+                }
+
+                // calculate perturbed residual
+                eval(t, y, m_ydot.data(), p);
+
+                // compute the corresponding columns of the Jacobian, which
+                // only have entries for the reactors depending on the
+                // perturbed one
+                for (size_t s : group) {
+                    size_t j = m_start[s] + k;
+                    if (j >= m_start[s+1] || (gmres && m_hasPrecond[s])) {
+                        continue;
+                    }
+                    for (size_t r : m_depends[s]) {
+                        if (gmres && r != s) {
+                            continue;
+                        }
+                        for (size_t i = m_start[r]; i < m_start[r+1]; i++) {
+                            jac.value(i, j) = (m_ydot[i] - ydot0[i])/dy[j];
+                        }
+                    }
+                    y[j] = ysave[j];
+                }
+            }
+        }
+    } catch (...) {
+        enableAnalyticChemistry(analytic);
+        throw;
+    }
+    enableAnalyticChemistry(analytic);
+
+    // restore the state of the reactors
+    updateState(y);
+
+    if (gmres) {
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            if (m_hasPrecond[n]) {
+                m_reactors[n]->evalPreconditioner(p, jac, m_start[n]);
+            }
+        }
+        return;
+    }
+
+    for (size_t n : analytic) {
+        m_reactors[n]->getChemistryJacobian(p, m_chemJac);
+        size_t start = m_start[n];
+        for (size_t k = 0; k < m_chemJac.nColumns(); k++) {
+            for (size_t i = 0; i < m_chemJac.nRows(); i++) {
+                if (m_chemJac(i, k) != 0.0) {
+                    jac.value(start + i, start + k) += m_chemJac(i, k);
+                }
+            }
         }
-        y[n] = ysave;
     }
 }
 
@@ -197,6 +1316,15 @@ size_t ReactorNet::globalComponentIndex(const string& component, size_t reactor)
     return m_start[reactor] + m_reactors[reactor]->componentIndex(component);
 }
 
+void ReactorNet::addSensitivityHeatTransferCoeff(Wall& w)
+{
+    registerSensitivityReaction(&w, 0, fmt::format("heat transfer coefficient"
+        " of wall between '{}' and '{}'", w.left().name(), w.right().name()),
+        2);
+    m_sensWalls.push_back(&w);
+    m_wallU.push_back(w.getHeatTransferCoeff());
+}
+
 void ReactorNet::registerSensitivityReaction(void* reactor,
         size_t reactionIndex, const std::string& name, int leftright)
 {
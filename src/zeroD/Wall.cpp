@@ -158,6 +158,20 @@ void Wall::addSensitivityReaction(int leftright, size_t rxn)
     }
 }
 
+void Wall::addSensitivityHeatTransferCoeff()
+{
+    // The parameter belongs to the network of the reactor on either side
+    Reactor* r = dynamic_cast<Reactor*>(m_left);
+    if (!r) {
+        r = dynamic_cast<Reactor*>(m_right);
+    }
+    if (!r) {
+        throw CanteraError("Wall::addSensitivityHeatTransferCoeff",
+                           "The wall is not installed next to a reactor.");
+    }
+    r->network().addSensitivityHeatTransferCoeff(*this);
+}
+
 void Wall::setSensitivityParameters(int lr, double* params)
 {
     // process sensitivity parameters